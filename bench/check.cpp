@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "bench/check.h"
+
+namespace bench
+{
+	// one frame from a log: the frame line and its entity lines, if any
+	struct hash_frame
+	{
+		std::string					line;
+		std::map<uint32_t, std::string>	entities;
+	};
+
+	class hash_log
+	{
+		std::ifstream	file;
+		std::string		pending;
+		bool			has_pending = false;
+
+	public:
+		const std::string	path;
+
+		hash_log(const std::string &path) :
+			file(path),
+			path(path)
+		{
+		}
+
+		bool is_open() const { return file.is_open(); }
+
+		// read the next frame; false at the end of the log
+		bool next(hash_frame &frame)
+		{
+			std::string text;
+
+			frame.line.clear();
+			frame.entities.clear();
+
+			if (has_pending)
+			{
+				frame.line = std::move(pending);
+				has_pending = false;
+			}
+			else
+			{
+				do
+				{
+					if (!std::getline(file, text))
+						return false;
+				} while (text.empty() || text[0] == '\t');
+
+				frame.line = std::move(text);
+			}
+
+			while (std::getline(file, text))
+			{
+				if (text.empty())
+					continue;
+
+				if (text[0] != '\t')
+				{
+					pending = std::move(text);
+					has_pending = true;
+					break;
+				}
+
+				const uint32_t number = (uint32_t) strtoul(text.c_str() + 1, nullptr, 10);
+				frame.entities[number] = text.substr(1);
+			}
+
+			return true;
+		}
+	};
+
+	static void Check_PrintEntities(const hash_frame &a, const hash_frame &b)
+	{
+		constexpr size_t max_printed = 20;
+		size_t printed = 0, differing = 0;
+
+		auto print = [&](uint32_t number, const std::string *x, const std::string *y) {
+			differing++;
+
+			if (printed++ < max_printed)
+				printf("  entity %u:\n    a: %s\n    b: %s\n", number, x ? x->c_str() : "(none)", y ? y->c_str() : "(none)");
+		};
+
+		auto ia = a.entities.begin(), ib = b.entities.begin();
+
+		while (ia != a.entities.end() || ib != b.entities.end())
+		{
+			if (ib == b.entities.end() || (ia != a.entities.end() && ia->first < ib->first))
+			{
+				print(ia->first, &ia->second, nullptr);
+				ia++;
+			}
+			else if (ia == a.entities.end() || ib->first < ia->first)
+			{
+				print(ib->first, nullptr, &ib->second);
+				ib++;
+			}
+			else
+			{
+				if (ia->second != ib->second)
+					print(ia->first, &ia->second, &ib->second);
+
+				ia++;
+				ib++;
+			}
+		}
+
+		if (differing > max_printed)
+			printf("  ...and %zu more\n", differing - max_printed);
+	}
+
+	int32_t Check_Run(const std::string &a_path, const std::string &b_path)
+	{
+		hash_log a(a_path), b(b_path);
+
+		for (hash_log *log : { &a, &b })
+		{
+			if (!log->is_open())
+			{
+				fprintf(stderr, "check: can't open %s\n", log->path.c_str());
+				return 1;
+			}
+		}
+
+		hash_frame fa, fb;
+		size_t frames = 0;
+
+		while (true)
+		{
+			const bool more_a = a.next(fa), more_b = b.next(fb);
+
+			if (!more_a || !more_b)
+			{
+				if (more_a == more_b)
+					break;
+
+				printf("logs match for %zu frames, then %s ends\n", frames, more_a ? "b" : "a");
+				return 1;
+			}
+
+			if (fa.line != fb.line)
+			{
+				// "<level time> <live entities> <hash>"
+				printf("logs differ at frame %zu\n  a: %s\n  b: %s\n", frames, fa.line.c_str(), fb.line.c_str());
+
+				if (!fa.entities.empty() && !fb.entities.empty())
+					Check_PrintEntities(fa, fb);
+				else
+					printf("  (no entity lines; log with g_framehash_entities 1 to see which entities differ)\n");
+
+				return 1;
+			}
+
+			frames++;
+		}
+
+		printf("logs match: %zu frames\n", frames);
+		return 0;
+	}
+}
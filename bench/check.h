@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Compares two frame hash logs written by the game's g_framehash (see
+// game/framehash.h). Prints the first frame where they differ and, if
+// both logs have entity lines, the entities that differ in it.
+// Returns 0 if the logs match frame for frame, 1 otherwise.
+
+namespace bench
+{
+	int32_t Check_Run(const std::string &a_path, const std::string &b_path);
+}
@@ -0,0 +1,1045 @@
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+#include "bench/engine.h"
+
+namespace bench
+{
+	world			sv_world;
+	game_export		*ge;
+	engine_stats	sv_stats;
+	bool			sv_verbose;
+
+	// the trace code treats a null surface as a runaway trace,
+	// so everything must return a valid surface.
+	static const csurface null_surface {};
+
+	// distance traces stop short of a surface
+	constexpr float DIST_EPSILON = 0.03125f;
+
+	// time a call into the engine, excluding nested calls
+	// (Pmove calls back into the game, which calls trace)
+	struct engine_timer
+	{
+		static inline int32_t depth = 0;
+		std::chrono::steady_clock::time_point start;
+
+		engine_timer()
+		{
+			if (!depth++)
+				start = std::chrono::steady_clock::now();
+		}
+
+		~engine_timer()
+		{
+			if (!--depth)
+			{
+				sv_stats.calls++;
+				sv_stats.time += std::chrono::steady_clock::now() - start;
+			}
+		}
+	};
+
+	edict *EDICT_NUM(size_t n)
+	{
+		return (edict *) (ge->edicts + (ge->edict_size * n));
+	}
+
+	size_t NUM_FOR_EDICT(const edict *e)
+	{
+		return ((const uint8_t *) e - ge->edicts) / ge->edict_size;
+	}
+
+	/*
+	===============================================================================
+
+	PRINTING
+
+	===============================================================================
+	*/
+
+	static void PF_vprintf(bool print, const char *fmt, va_list args)
+	{
+		if (!print)
+			return;
+
+		vprintf(fmt, args);
+	}
+
+	static void PF_bprintf(int32_t, const char *fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		PF_vprintf(sv_verbose, fmt, args);
+		va_end(args);
+	}
+
+	static void PF_dprintf(const char *fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		PF_vprintf(sv_verbose, fmt, args);
+		va_end(args);
+	}
+
+	static void PF_cprintf(edict *ent, int32_t, const char *fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		// null entity prints go to the console
+		PF_vprintf(sv_verbose || !ent, fmt, args);
+		va_end(args);
+	}
+
+	static void PF_centerprintf(edict *, const char *fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		PF_vprintf(sv_verbose, fmt, args);
+		va_end(args);
+	}
+
+	[[noreturn]] static void PF_error(const char *fmt, ...)
+	{
+		char buffer[1024];
+		va_list args;
+		va_start(args, fmt);
+		vsnprintf(buffer, sizeof(buffer), fmt, args);
+		va_end(args);
+
+		throw game_error { buffer };
+	}
+
+	/*
+	===============================================================================
+
+	MEMORY
+
+	===============================================================================
+	*/
+
+	struct alignas(16) tag_header
+	{
+		tag_header	*prev, *next;
+		uint32_t	tag;
+		uint32_t	size;
+	};
+
+	static tag_header tag_chain = { &tag_chain, &tag_chain, 0, 0 };
+
+	static void *PF_TagMalloc(uint32_t size, uint32_t tag)
+	{
+		tag_header *z = (tag_header *) calloc(1, sizeof(tag_header) + size);
+
+		if (!z)
+			PF_error("TagMalloc: failed on allocation of %u bytes", size);
+
+		z->tag = tag;
+		z->size = size;
+		z->next = tag_chain.next;
+		z->prev = &tag_chain;
+		tag_chain.next->prev = z;
+		tag_chain.next = z;
+
+		return z + 1;
+	}
+
+	static void PF_TagFree(void *block)
+	{
+		if (!block)
+			return;
+
+		tag_header *z = ((tag_header *) block) - 1;
+		z->prev->next = z->next;
+		z->next->prev = z->prev;
+		free(z);
+	}
+
+	static void PF_FreeTags(uint32_t tag)
+	{
+		for (tag_header *z = tag_chain.next, *next; z != &tag_chain; z = next)
+		{
+			next = z->next;
+
+			if (z->tag == tag)
+				PF_TagFree(z + 1);
+		}
+	}
+
+	/*
+	===============================================================================
+
+	CONFIGSTRINGS
+
+	===============================================================================
+	*/
+
+	static std::vector<std::string> sv_configstrings(MAX_CONFIGSTRINGS);
+
+	static void PF_Configstring(int32_t num, const char *string)
+	{
+		if (num < 0 || num >= MAX_CONFIGSTRINGS)
+			PF_error("configstring: bad index %i", num);
+
+		sv_configstrings[num] = string ? string : "";
+	}
+
+	// same linear search the real server does; it is part of
+	// the cost the game pays for an index lookup.
+	static int32_t SV_FindIndex(const char *name, int32_t start, int32_t max)
+	{
+		if (!name || !name[0])
+			return 0;
+
+		int32_t i;
+
+		for (i = 1; i < max && !sv_configstrings[start + i].empty(); i++)
+			if (sv_configstrings[start + i] == name)
+				return i;
+
+		if (i == max)
+			PF_error("*Index: overflow");
+
+		sv_configstrings[start + i] = name;
+		return i;
+	}
+
+	static int32_t PF_ModelIndex(const char *name)
+	{
+		engine_timer timer;
+		return SV_FindIndex(name, CS_MODELS, MAX_MODELS);
+	}
+
+	static int32_t PF_SoundIndex(const char *name)
+	{
+		engine_timer timer;
+		return SV_FindIndex(name, CS_SOUNDS, MAX_SOUNDS);
+	}
+
+	static int32_t PF_ImageIndex(const char *name)
+	{
+		engine_timer timer;
+		return SV_FindIndex(name, CS_IMAGES, MAX_IMAGES);
+	}
+
+	/*
+	===============================================================================
+
+	WORLD LINKS
+
+	===============================================================================
+	*/
+
+	// all linked entities, and each entity's slot in that list
+	static std::vector<edict *>	sv_linked;
+	static std::vector<int32_t>	sv_linkslot;
+	// linked entities point their area at this, so that the
+	// game's is_linked check works
+	static link sv_area;
+
+	static void PF_UnlinkEdict(edict *ent)
+	{
+		engine_timer timer;
+
+		if (!ent->area.prev)
+			return;
+
+		const size_t num = NUM_FOR_EDICT(ent);
+		const int32_t slot = sv_linkslot[num];
+
+		edict *last = sv_linked.back();
+		sv_linked[slot] = last;
+		sv_linkslot[NUM_FOR_EDICT(last)] = slot;
+		sv_linked.pop_back();
+		sv_linkslot[num] = -1;
+
+		ent->area.prev = ent->area.next = nullptr;
+	}
+
+	static void PF_LinkEdict(edict *ent)
+	{
+		engine_timer timer;
+
+		if (ent == EDICT_NUM(0))
+			return;
+
+		for (int32_t i = 0; i < 3; i++)
+			ent->size[i] = ent->maxs[i] - ent->mins[i];
+
+		if (ent->solid == SOLID_BSP && (ent->s.angles[0] || ent->s.angles[1] || ent->s.angles[2]))
+		{
+			// expand for rotation
+			float max = 0;
+
+			for (int32_t i = 0; i < 3; i++)
+				max = std::fmax(max, std::fmax(std::fabs(ent->mins[i]), std::fabs(ent->maxs[i])));
+
+			for (int32_t i = 0; i < 3; i++)
+			{
+				ent->absmin[i] = ent->s.origin[i] - max;
+				ent->absmax[i] = ent->s.origin[i] + max;
+			}
+		}
+		else
+		{
+			for (int32_t i = 0; i < 3; i++)
+			{
+				ent->absmin[i] = ent->s.origin[i] + ent->mins[i];
+				ent->absmax[i] = ent->s.origin[i] + ent->maxs[i];
+			}
+		}
+
+		// because movement is clipped an epsilon away from an actual edge,
+		// we must fully check even when bounding boxes don't quite touch
+		for (int32_t i = 0; i < 3; i++)
+		{
+			ent->absmin[i] -= 1;
+			ent->absmax[i] += 1;
+		}
+
+		ent->linkcount++;
+		ent->num_clusters = 0;
+		ent->areanum = ent->areanum2 = 0;
+
+		if (ent->area.prev)
+			return;
+
+		const size_t num = NUM_FOR_EDICT(ent);
+
+		if (sv_linkslot.size() <= num)
+			sv_linkslot.resize(ge->max_edicts, -1);
+
+		sv_linkslot[num] = (int32_t) sv_linked.size();
+		sv_linked.push_back(ent);
+		ent->area.prev = ent->area.next = &sv_area;
+	}
+
+	void SV_ClearWorld()
+	{
+		for (edict *e : sv_linked)
+			e->area.prev = e->area.next = nullptr;
+
+		sv_linked.clear();
+		sv_linkslot.assign(ge ? ge->max_edicts : 0, -1);
+
+		for (auto &cs : sv_configstrings)
+			cs.clear();
+	}
+
+	static void PF_SetModel(edict *ent, const char *name)
+	{
+		if (!name)
+			PF_error("setmodel: NULL");
+
+		ent->s.modelindex = PF_ModelIndex(name);
+
+		// if it is an inline model, get the size information for it
+		if (name[0] == '*')
+		{
+			const size_t index = (size_t) atoi(name + 1);
+
+			if (index >= 1 && index <= sv_world.models.size())
+			{
+				const box &mod = sv_world.models[index - 1];
+				memcpy(ent->mins, mod.mins, sizeof(vec3));
+				memcpy(ent->maxs, mod.maxs, sizeof(vec3));
+			}
+
+			PF_LinkEdict(ent);
+		}
+	}
+
+	static int32_t PF_BoxEdicts(const float *mins, const float *maxs, edict **list, int32_t maxcount, int32_t areatype)
+	{
+		engine_timer timer;
+		int32_t count = 0;
+
+		for (edict *check : sv_linked)
+		{
+			if (check->solid == SOLID_NOT)
+				continue;
+			else if (areatype == AREA_TRIGGERS && check->solid != SOLID_TRIGGER)
+				continue;
+			else if (areatype == AREA_SOLID && check->solid == SOLID_TRIGGER)
+				continue;
+
+			if (check->absmin[0] > maxs[0] || check->absmin[1] > maxs[1] || check->absmin[2] > maxs[2] ||
+				check->absmax[0] < mins[0] || check->absmax[1] < mins[1] || check->absmax[2] < mins[2])
+				continue;
+
+			if (count == maxcount)
+				break;
+
+			list[count++] = check;
+		}
+
+		return count;
+	}
+
+	/*
+	===============================================================================
+
+	COLLISION
+
+	===============================================================================
+	*/
+
+	// contents that a solid entity presents to a trace
+	static int32_t SV_EdictContents(const edict *ent)
+	{
+		if (ent->solid == SOLID_BSP)
+			return CONTENTS_SOLID;
+		else if (ent->svflags & SVF_DEADMONSTER)
+			return CONTENTS_DEADMONSTER;
+		else if (ent->svflags & SVF_MONSTER)
+			return CONTENTS_MONSTER;
+
+		return CONTENTS_SOLID;
+	}
+
+	// fetch the box of a solid entity in world space
+	static void SV_EdictBox(const edict *ent, vec3 mins, vec3 maxs)
+	{
+		for (int32_t i = 0; i < 3; i++)
+		{
+			mins[i] = ent->s.origin[i] + ent->mins[i];
+			maxs[i] = ent->s.origin[i] + ent->maxs[i];
+		}
+	}
+
+	/*
+	==================
+	SV_ClipToBox
+
+	Sweep the box [mins, maxs] from start to end against a solid box,
+	by expanding the solid by the moving box and testing a ray against
+	its slabs.
+	==================
+	*/
+	static void SV_ClipToBox(const float *start, const float *end, const float *mins, const float *maxs,
+		const float *bmins, const float *bmaxs, int32_t contents, edict *ent, trace &tr)
+	{
+		float enter = -1, exit = 1;
+		int32_t enter_axis = -1;
+		float enter_sign = 0;
+		bool startout = false, getout = false;
+
+		for (int32_t i = 0; i < 3; i++)
+		{
+			const float lo = bmins[i] - maxs[i];
+			const float hi = bmaxs[i] - mins[i];
+			const float d = end[i] - start[i];
+
+			if (start[i] <= lo || start[i] >= hi)
+				startout = true;
+			if (end[i] <= lo || end[i] >= hi)
+				getout = true;
+
+			if (d == 0)
+			{
+				if (start[i] <= lo || start[i] >= hi)
+					return;
+
+				continue;
+			}
+
+			float t1 = (lo - start[i]) / d;
+			float t2 = (hi - start[i]) / d;
+			float sign = -1;
+
+			if (t1 > t2)
+			{
+				std::swap(t1, t2);
+				sign = 1;
+			}
+
+			if (t1 > enter)
+			{
+				enter = t1;
+				enter_axis = i;
+				enter_sign = sign;
+			}
+
+			exit = std::fmin(exit, t2);
+
+			if (enter > exit)
+				return;
+		}
+
+		if (!startout)
+		{
+			// original point was inside brush
+			tr.startsolid = true;
+
+			if (!getout)
+			{
+				tr.allsolid = true;
+				tr.fraction = 0;
+				tr.contents = contents;
+				tr.ent = ent;
+			}
+
+			return;
+		}
+
+		if (enter_axis == -1 || enter < 0 || enter > 1)
+			return;
+
+		float length = 0;
+
+		for (int32_t i = 0; i < 3; i++)
+			length += (end[i] - start[i]) * (end[i] - start[i]);
+
+		length = std::sqrt(length);
+
+		const float fraction = std::fmax(0.f, enter - (DIST_EPSILON / length));
+
+		if (fraction >= tr.fraction)
+			return;
+
+		tr.fraction = fraction;
+		memset(&tr.plane, 0, sizeof(tr.plane));
+		tr.plane.normal[enter_axis] = enter_sign;
+		tr.plane.type = (uint8_t) enter_axis;
+		tr.contents = contents;
+		tr.ent = ent;
+	}
+
+	static trace PF_Trace(const float *start, const float *mins, const float *maxs, const float *end, edict *passent, int32_t contentmask)
+	{
+		engine_timer timer;
+		static const vec3 zero = { 0, 0, 0 };
+
+		if (!mins)
+			mins = zero;
+		if (!maxs)
+			maxs = zero;
+
+		trace tr {};
+		tr.fraction = 1;
+		tr.surface = &null_surface;
+		tr.ent = EDICT_NUM(0);
+
+		for (const box &brush : sv_world.brushes)
+			if (brush.contents & contentmask)
+				SV_ClipToBox(start, end, mins, maxs, brush.mins, brush.maxs, brush.contents, EDICT_NUM(0), tr);
+
+		if (!tr.allsolid)
+		{
+			for (edict *touch : sv_linked)
+			{
+				if (touch->solid == SOLID_NOT || touch->solid == SOLID_TRIGGER)
+					continue;
+				else if (touch == passent)
+					continue;
+				else if (passent && (touch->owner == passent || passent->owner == touch))
+					continue;
+
+				const int32_t contents = SV_EdictContents(touch);
+
+				if (!(contents & contentmask))
+					continue;
+
+				vec3 bmins, bmaxs;
+				SV_EdictBox(touch, bmins, bmaxs);
+				SV_ClipToBox(start, end, mins, maxs, bmins, bmaxs, contents, touch, tr);
+
+				if (tr.allsolid)
+					break;
+			}
+		}
+
+		for (int32_t i = 0; i < 3; i++)
+			tr.endpos[i] = start[i] + tr.fraction * (end[i] - start[i]);
+
+		return tr;
+	}
+
+	static int32_t PF_PointContents(const float *point)
+	{
+		engine_timer timer;
+		int32_t contents = 0;
+
+		for (const box &brush : sv_world.brushes)
+			if (point[0] >= brush.mins[0] && point[0] <= brush.maxs[0] &&
+				point[1] >= brush.mins[1] && point[1] <= brush.maxs[1] &&
+				point[2] >= brush.mins[2] && point[2] <= brush.maxs[2])
+				contents |= brush.contents;
+
+		for (edict *touch : sv_linked)
+		{
+			if (touch->solid == SOLID_NOT || touch->solid == SOLID_TRIGGER)
+				continue;
+
+			vec3 bmins, bmaxs;
+			SV_EdictBox(touch, bmins, bmaxs);
+
+			if (point[0] >= bmins[0] && point[0] <= bmaxs[0] &&
+				point[1] >= bmins[1] && point[1] <= bmaxs[1] &&
+				point[2] >= bmins[2] && point[2] <= bmaxs[2])
+				contents |= SV_EdictContents(touch);
+		}
+
+		return contents;
+	}
+
+	// there is no vis data, so everything can see everything
+	static qboolean PF_inPVS(const float *, const float *)
+	{
+		return true;
+	}
+
+	static void PF_SetAreaPortalState(int32_t, qboolean)
+	{
+	}
+
+	static qboolean PF_AreasConnected(int32_t, int32_t)
+	{
+		return true;
+	}
+
+	/*
+	===============================================================================
+
+	PLAYER MOVEMENT
+
+	A simplified stand-in for the shared pmove code. It walks, jumps,
+	falls and slides along planes through the game's own trace callback,
+	which is enough to keep players moving through the world and
+	touching triggers; it is not meant to be prediction-accurate.
+
+	===============================================================================
+	*/
+
+	constexpr int32_t PM_SPECTATOR = 1;
+	constexpr int32_t PM_DEAD = 2;
+	constexpr int32_t PM_FREEZE = 4;
+
+	constexpr uint8_t PMF_JUMP_HELD = 1 << 1;
+	constexpr uint8_t PMF_ON_GROUND = 1 << 2;
+
+	constexpr float SHORT2ANGLE = 360.0f / 65536;
+	constexpr float MAX_SPEED = 300;
+	constexpr float JUMP_SPEED = 270;
+
+	static void PM_AddTouch(pmove *pm, edict *ent)
+	{
+		if (!ent || ent == EDICT_NUM(0) || pm->numtouch == MAX_TOUCH)
+			return;
+
+		for (int32_t i = 0; i < pm->numtouch; i++)
+			if (pm->touchents[i] == ent)
+				return;
+
+		pm->touchents[pm->numtouch++] = ent;
+	}
+
+	static void PM_CategorizePosition(pmove *pm, const vec3 origin)
+	{
+		const vec3 down = { origin[0], origin[1], origin[2] - 0.25f };
+		const trace tr = pm->trace(origin, pm->mins, pm->maxs, down);
+
+		if (tr.fraction < 1 && tr.plane.normal[2] > 0.7f && !tr.startsolid)
+		{
+			pm->groundentity = tr.ent;
+			pm->s.pm_flags |= PMF_ON_GROUND;
+		}
+		else
+		{
+			pm->groundentity = nullptr;
+			pm->s.pm_flags &= ~PMF_ON_GROUND;
+		}
+
+		const vec3 feet = { origin[0], origin[1], origin[2] + pm->mins[2] + 1 };
+		pm->watertype = pm->pointcontents(feet);
+		pm->waterlevel = (pm->watertype & (1 << 3 | 1 << 4 | 1 << 5)) ? 1 : 0;
+	}
+
+	static void PF_Pmove(pmove *pm)
+	{
+		engine_timer timer;
+
+		pm->numtouch = 0;
+		pm->viewheight = 22;
+
+		for (int32_t i = 0; i < 3; i++)
+			pm->viewangles[i] = SHORT2ANGLE * (int16_t) (pm->cmd.angles[i] + pm->s.delta_angles[i]);
+
+		pm->mins[0] = pm->mins[1] = -16;
+		pm->maxs[0] = pm->maxs[1] = 16;
+		pm->mins[2] = -24;
+		pm->maxs[2] = 32;
+
+		if (pm->s.pm_type >= PM_DEAD)
+		{
+			pm->maxs[2] = -8;
+			pm->viewheight = -2;
+		}
+
+		vec3 origin, velocity;
+
+		for (int32_t i = 0; i < 3; i++)
+		{
+			origin[i] = pm->s.origin[i] * 0.125f;
+			velocity[i] = pm->s.velocity[i] * 0.125f;
+		}
+
+		if (pm->s.pm_type == PM_FREEZE)
+			return;
+
+		const float frametime = pm->cmd.msec * 0.001f;
+		const float yaw = pm->viewangles[1] * (3.14159265f / 180);
+		const float fmove = std::fmax(-MAX_SPEED, std::fmin(MAX_SPEED, (float) pm->cmd.forwardmove));
+		const float smove = std::fmax(-MAX_SPEED, std::fmin(MAX_SPEED, (float) pm->cmd.sidemove));
+		const float wish[2] = {
+			std::cos(yaw) * fmove + std::sin(yaw) * smove,
+			std::sin(yaw) * fmove - std::cos(yaw) * smove
+		};
+
+		if (pm->s.pm_type == PM_SPECTATOR)
+		{
+			origin[0] += wish[0] * frametime;
+			origin[1] += wish[1] * frametime;
+			origin[2] += pm->cmd.upmove * frametime;
+		}
+		else
+		{
+			const bool onground = pm->s.pm_flags & PMF_ON_GROUND;
+
+			if (onground && pm->s.pm_type < PM_DEAD)
+			{
+				velocity[0] = wish[0];
+				velocity[1] = wish[1];
+
+				if (pm->cmd.upmove >= 10 && !(pm->s.pm_flags & PMF_JUMP_HELD))
+				{
+					velocity[2] = JUMP_SPEED;
+					pm->s.pm_flags |= PMF_JUMP_HELD;
+				}
+			}
+			else
+				velocity[2] -= pm->s.gravity * frametime;
+
+			if (pm->cmd.upmove < 10)
+				pm->s.pm_flags &= ~PMF_JUMP_HELD;
+
+			// slide along at most two planes
+			float time_left = frametime;
+
+			for (int32_t bump = 0; bump < 2 && time_left > 0; bump++)
+			{
+				const vec3 end = {
+					origin[0] + velocity[0] * time_left,
+					origin[1] + velocity[1] * time_left,
+					origin[2] + velocity[2] * time_left
+				};
+				const trace tr = pm->trace(origin, pm->mins, pm->maxs, end);
+
+				if (tr.allsolid)
+				{
+					velocity[0] = velocity[1] = velocity[2] = 0;
+					break;
+				}
+
+				memcpy(origin, tr.endpos, sizeof(vec3));
+
+				if (tr.fraction == 1)
+					break;
+
+				PM_AddTouch(pm, tr.ent);
+
+				const float backoff = velocity[0] * tr.plane.normal[0] + velocity[1] * tr.plane.normal[1] + velocity[2] * tr.plane.normal[2];
+
+				for (int32_t i = 0; i < 3; i++)
+					velocity[i] -= tr.plane.normal[i] * backoff;
+
+				time_left -= time_left * tr.fraction;
+			}
+
+			PM_CategorizePosition(pm, origin);
+
+			if ((pm->s.pm_flags & PMF_ON_GROUND) && velocity[2] < 0)
+				velocity[2] = 0;
+		}
+
+		for (int32_t i = 0; i < 3; i++)
+		{
+			pm->s.origin[i] = (int16_t) (origin[i] * 8);
+			pm->s.velocity[i] = (int16_t) (velocity[i] * 8);
+		}
+	}
+
+	/*
+	===============================================================================
+
+	NETWORK
+
+	Nothing is sent anywhere; messages are only counted.
+
+	===============================================================================
+	*/
+
+	static void PF_sound(edict *, int32_t, int32_t, float, float, float)
+	{
+	}
+
+	static void PF_positioned_sound(const float *, edict *, int32_t, int32_t, float, float, float)
+	{
+	}
+
+	static void PF_multicast(const float *, int32_t)
+	{
+	}
+
+	static void PF_unicast(edict *, qboolean)
+	{
+	}
+
+	static void PF_WriteInt(int32_t)
+	{
+	}
+
+	static void PF_WriteFloat(float)
+	{
+	}
+
+	static void PF_WriteString(const char *)
+	{
+	}
+
+	static void PF_WriteVector(const float *)
+	{
+	}
+
+	/*
+	===============================================================================
+
+	CVARS / COMMANDS
+
+	===============================================================================
+	*/
+
+	struct engine_cvar
+	{
+		bench::cvar	var;
+		std::string	name;
+		std::string	string;
+	};
+
+	static std::unordered_map<std::string, std::unique_ptr<engine_cvar>> sv_cvars;
+
+	static bench::cvar *Cvar_Update(engine_cvar &cv, const char *value)
+	{
+		cv.string = value ? value : "";
+		cv.var.string = cv.string.c_str();
+		cv.var.value = (float) atof(cv.var.string);
+		cv.var.modified = true;
+		return &cv.var;
+	}
+
+	static engine_cvar &Cvar_Get(const char *name, const char *value, int32_t flags, bool &created)
+	{
+		auto &slot = sv_cvars[name];
+
+		created = !slot;
+
+		if (created)
+		{
+			slot = std::make_unique<engine_cvar>();
+			slot->name = name;
+			slot->var.name = slot->name.c_str();
+			Cvar_Update(*slot, value);
+		}
+
+		slot->var.flags |= flags;
+		return *slot;
+	}
+
+	static bench::cvar *PF_cvar(const char *name, const char *value, int32_t flags)
+	{
+		bool created;
+		return &Cvar_Get(name, value, flags, created).var;
+	}
+
+	static bench::cvar *PF_cvar_set(const char *name, const char *value)
+	{
+		bool created;
+		engine_cvar &cv = Cvar_Get(name, value, 0, created);
+
+		if (created)
+			return &cv.var;
+
+		return Cvar_Update(cv, value);
+	}
+
+	void Cvar_Set(const char *name, const char *value)
+	{
+		PF_cvar_set(name, value);
+	}
+
+	static std::vector<std::string>	cmd_argv;
+	static std::string				cmd_args;
+	static char						cmd_null_string[1];
+
+	void Cmd_TokenizeString(const std::string &text)
+	{
+		cmd_argv.clear();
+		cmd_args.clear();
+
+		size_t i = 0;
+
+		while (true)
+		{
+			while (i < text.size() && (unsigned char) text[i] <= ' ')
+				i++;
+
+			if (i == text.size())
+				break;
+
+			// everything after the first token is args
+			if (cmd_argv.size() == 1)
+				cmd_args = text.substr(i);
+
+			std::string token;
+
+			if (text[i] == '\"')
+			{
+				for (i++; i < text.size() && text[i] != '\"'; i++)
+					token += text[i];
+
+				if (i < text.size())
+					i++;
+			}
+			else
+			{
+				for (; i < text.size() && (unsigned char) text[i] > ' '; i++)
+					token += text[i];
+			}
+
+			cmd_argv.push_back(std::move(token));
+		}
+	}
+
+	static int32_t PF_argc()
+	{
+		return (int32_t) cmd_argv.size();
+	}
+
+	static char *PF_argv(int32_t n)
+	{
+		if (n < 0 || (size_t) n >= cmd_argv.size())
+			return cmd_null_string;
+
+		return cmd_argv[n].data();
+	}
+
+	static char *PF_args()
+	{
+		return cmd_args.data();
+	}
+
+	void SV_ServerCommand(const std::string &text)
+	{
+		// the game's ServerCommand sees "sv" as argv(0)
+		Cmd_TokenizeString("sv " + text);
+		ge->ServerCommand();
+	}
+
+	void SV_ClientCommand(edict *ent, const std::string &text)
+	{
+		Cmd_TokenizeString(text);
+		ge->ClientCommand(ent);
+	}
+
+	static void PF_AddCommandString(const char *text)
+	{
+		if (sv_verbose)
+			printf("AddCommandString: %s", text);
+	}
+
+	static void PF_DebugGraph(float, int32_t)
+	{
+	}
+
+	game_import SV_GetGameImports()
+	{
+		game_import import {};
+
+		import.bprintf = PF_bprintf;
+		import.dprintf = PF_dprintf;
+		import.cprintf = PF_cprintf;
+		import.centerprintf = PF_centerprintf;
+		import.sound = PF_sound;
+		import.positioned_sound = PF_positioned_sound;
+
+		import.configstring = PF_Configstring;
+
+		import.error = PF_error;
+
+		import.modelindex = PF_ModelIndex;
+		import.soundindex = PF_SoundIndex;
+		import.imageindex = PF_ImageIndex;
+
+		import.setmodel = PF_SetModel;
+
+		import.trace = PF_Trace;
+		import.pointcontents = PF_PointContents;
+		import.inPVS = PF_inPVS;
+		import.inPHS = PF_inPVS;
+		import.SetAreaPortalState = PF_SetAreaPortalState;
+		import.AreasConnected = PF_AreasConnected;
+
+		import.linkentity = PF_LinkEdict;
+		import.unlinkentity = PF_UnlinkEdict;
+		import.BoxEdicts = PF_BoxEdicts;
+		import.Pmove = PF_Pmove;
+
+		import.multicast = PF_multicast;
+		import.unicast = PF_unicast;
+		import.WriteChar = PF_WriteInt;
+		import.WriteByte = PF_WriteInt;
+		import.WriteShort = PF_WriteInt;
+		import.WriteLong = PF_WriteInt;
+		import.WriteFloat = PF_WriteFloat;
+		import.WriteString = PF_WriteString;
+		import.WritePosition = PF_WriteVector;
+		import.WriteDir = PF_WriteVector;
+		import.WriteAngle = PF_WriteFloat;
+
+		import.TagMalloc = PF_TagMalloc;
+		import.TagFree = PF_TagFree;
+		import.FreeTags = PF_FreeTags;
+
+		import.cvar = PF_cvar;
+		import.cvar_set = PF_cvar_set;
+		import.cvar_forceset = PF_cvar_set;
+
+		import.argc = PF_argc;
+		import.argv = PF_argv;
+		import.args = PF_args;
+
+		import.AddCommandString = PF_AddCommandString;
+
+		import.DebugGraph = PF_DebugGraph;
+
+		return import;
+	}
+
+	void SV_Shutdown()
+	{
+		SV_ClearWorld();
+
+		for (tag_header *z = tag_chain.next, *next; z != &tag_chain; z = next)
+		{
+			next = z->next;
+			free(z);
+		}
+
+		tag_chain.prev = tag_chain.next = &tag_chain;
+	}
+}
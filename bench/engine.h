@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "bench/shared.h"
+
+// The headless engine is a minimal stand-in for a Quake II server.
+// It implements every game import without a renderer, network or
+// BSP; collision is done against a flat list of axis-aligned boxes
+// loaded from the benchmark script, which is enough to exercise the
+// game's physics, triggers and AI code paths.
+
+namespace bench
+{
+	// an axis-aligned box with contents; used for world
+	// brushes and for inline (brush) models.
+	struct box
+	{
+		vec3	mins, maxs;
+		int32_t	contents;
+	};
+
+	// the in-memory world that replaces a BSP
+	struct world
+	{
+		// static world geometry, owned by the world entity
+		std::vector<box>	brushes;
+		// inline models; "*1" is models[0]
+		std::vector<box>	models;
+	};
+
+	// time spent inside the engine stand-in, so that it
+	// can be separated out from the game's own cost.
+	struct engine_stats
+	{
+		uint64_t					calls;
+		std::chrono::nanoseconds	time;
+	};
+
+	extern world		sv_world;
+	extern game_export	*ge;
+	extern engine_stats	sv_stats;
+
+	// print game dprintf/bprintf/cprintf output
+	extern bool	sv_verbose;
+
+	// fetch the import table to hand to GetGameAPI
+	game_import SV_GetGameImports();
+
+	// fetch an edict by number
+	edict *EDICT_NUM(size_t n);
+
+	// fetch an edict's number
+	size_t NUM_FOR_EDICT(const edict *e);
+
+	// pre-set a cvar; the game's own gi.cvar call will not
+	// overwrite the value, just like a command line +set
+	void Cvar_Set(const char *name, const char *value);
+
+	// tokenize a command line into the buffer that the
+	// game reads through gi.argc/argv/args
+	void Cmd_TokenizeString(const std::string &text);
+
+	// run a server command through the game's ServerCommand
+	void SV_ServerCommand(const std::string &text);
+
+	// run a client command through the game's ClientCommand
+	void SV_ClientCommand(edict *ent, const std::string &text);
+
+	// clear links and configstrings for a new level
+	void SV_ClearWorld();
+
+	// release everything the game allocated
+	void SV_Shutdown();
+
+	// thrown when the game calls gi.error
+	struct game_error
+	{
+		std::string	message;
+	};
+}
@@ -0,0 +1,598 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "bench/engine.h"
+#include "bench/check.h"
+#include "game/record.h"
+
+// Frame-time benchmark for the game module.
+//
+// Loads the game the same way a server does, spawns the level described
+// by a script into the headless engine, connects bots that send a fixed
+// usercmd stream and reports frame time percentiles. Usage:
+//
+//   bench <script> [-game <module>] [-frames <n>] [-v] [+set <cvar> <value>]...
+//   bench [<script>] -replay <log> [-game <module>] [-v] [+set <cvar> <value>]...
+//   bench -check <a> <b>
+//
+// The second form plays back a log the game recorded with g_record (see
+// game/record.h) as fast as it will go, in place of the bots; the script,
+// if there is one, only provides the world boxes and cvars. The third
+// compares two frame hash logs written with g_framehash (see
+// game/framehash.h) instead of running anything.
+//
+// Script commands, one per line; '#' and '//' start comments:
+//
+//   map <name>                          map name passed to SpawnEntities
+//   brush <x1 y1 z1> <x2 y2 z2> [cont]  static world box (default contents 1)
+//   model <x1 y1 z1> <x2 y2 z2> [cont]  inline model; the first is "*1"
+//   cvar <name> <value>                 pre-set a cvar before Init
+//   clients <n>                         number of bots (default 1)
+//   cmdrate <n>                         usercmds per client per frame (default 1)
+//   warmup <n>                          frames to run before measuring (default 10)
+//   frames <n>                          frames to measure (default 1000)
+//   move <fwd> <side> <up> [yaw] [btn]  bot usercmd; yaw is degrees per frame
+//   sv <command>                        run a server command after spawning
+//   entfile <path>                      read the entity string from a file
+//   entities ... end                    inline entity string
+
+namespace bench
+{
+	using clock = std::chrono::steady_clock;
+
+	struct script
+	{
+		std::string					mapname = "bench";
+		std::string					entities;
+		std::vector<std::string>	server_commands;
+		size_t	clients = 1;
+		size_t	cmdrate = 1;
+		size_t	warmup = 10;
+		size_t	frames = 1000;
+		int16_t	forwardmove = 0, sidemove = 0, upmove = 0;
+		float	yawspeed = 0;
+		uint8_t	buttons = 0;
+	};
+
+	[[noreturn]] static void Sys_Error(const std::string &message)
+	{
+		fprintf(stderr, "bench: %s\n", message.c_str());
+		exit(1);
+	}
+
+	static void Script_ReadBox(std::istringstream &line, box &b)
+	{
+		b.contents = CONTENTS_SOLID;
+
+		if (!(line >> b.mins[0] >> b.mins[1] >> b.mins[2] >> b.maxs[0] >> b.maxs[1] >> b.maxs[2]))
+			Sys_Error("box needs six coordinates");
+
+		line >> b.contents;
+	}
+
+	static std::string Script_ReadFile(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::binary);
+
+		if (!file)
+			Sys_Error("can't open " + path);
+
+		std::ostringstream buffer;
+		buffer << file.rdbuf();
+		return buffer.str();
+	}
+
+	static script Script_Load(const std::string &path)
+	{
+		std::istringstream input(Script_ReadFile(path));
+		script s;
+		std::string text;
+		size_t line_number = 0;
+
+		while (std::getline(input, text))
+		{
+			line_number++;
+
+			if (const size_t comment = std::min(text.find('#'), text.find("//")); comment != std::string::npos)
+				text.erase(comment);
+
+			std::istringstream line(text);
+			std::string cmd;
+
+			if (!(line >> cmd))
+				continue;
+
+			if (cmd == "map")
+				line >> s.mapname;
+			else if (cmd == "brush")
+				Script_ReadBox(line, sv_world.brushes.emplace_back());
+			else if (cmd == "model")
+				Script_ReadBox(line, sv_world.models.emplace_back());
+			else if (cmd == "cvar")
+			{
+				std::string name, value;
+				line >> name >> value;
+				Cvar_Set(name.c_str(), value.c_str());
+			}
+			else if (cmd == "clients")
+				line >> s.clients;
+			else if (cmd == "cmdrate")
+				line >> s.cmdrate;
+			else if (cmd == "warmup")
+				line >> s.warmup;
+			else if (cmd == "frames")
+				line >> s.frames;
+			else if (cmd == "move")
+			{
+				int32_t buttons = 0;
+				line >> s.forwardmove >> s.sidemove >> s.upmove >> s.yawspeed >> buttons;
+				s.buttons = (uint8_t) buttons;
+			}
+			else if (cmd == "sv")
+			{
+				std::string rest;
+				std::getline(line, rest);
+				s.server_commands.push_back(rest);
+			}
+			else if (cmd == "entfile")
+			{
+				std::string file;
+				line >> file;
+				s.entities += Script_ReadFile(file);
+			}
+			else if (cmd == "entities")
+			{
+				while (std::getline(input, text))
+				{
+					line_number++;
+
+					if (text == "end")
+						break;
+
+					s.entities += text;
+					s.entities += '\n';
+				}
+			}
+			else
+				Sys_Error(path + ":" + std::to_string(line_number) + ": unknown command \"" + cmd + "\"");
+		}
+
+		return s;
+	}
+
+	static get_game_api Sys_LoadGame(const std::string &path)
+	{
+#ifdef _WIN32
+		HMODULE module = LoadLibraryA(path.c_str());
+
+		if (!module)
+			Sys_Error("can't load " + path);
+
+		return (get_game_api) GetProcAddress(module, "GetGameAPI");
+#else
+		void *module = dlopen(path.c_str(), RTLD_NOW);
+
+		if (!module)
+			Sys_Error(dlerror());
+
+		return (get_game_api) dlsym(module, "GetGameAPI");
+#endif
+	}
+
+	// collected samples for one measurement, in nanoseconds
+	struct samples
+	{
+		const char				*name;
+		std::vector<int64_t>	values;
+
+		void print()
+		{
+			if (values.empty())
+				return;
+
+			std::sort(values.begin(), values.end());
+
+			auto at = [this](double p) {
+				return values[std::min(values.size() - 1, (size_t) (p * values.size()))] / 1000.0;
+			};
+
+			double mean = 0;
+
+			for (int64_t v : values)
+				mean += v;
+
+			mean /= values.size() * 1000.0;
+
+			printf("%-12s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", name, mean, at(0.5), at(0.9), at(0.99), at(0.999), values.back() / 1000.0);
+		}
+	};
+
+	static int32_t Bench_Run(const script &s, const std::string &game_path)
+	{
+		const get_game_api GetGameAPI = Sys_LoadGame(game_path);
+
+		if (!GetGameAPI)
+			Sys_Error("no GetGameAPI in " + game_path);
+
+		game_import import = SV_GetGameImports();
+		ge = GetGameAPI(&import);
+
+		if (ge->apiversion != 3)
+			Sys_Error("game is version " + std::to_string(ge->apiversion) + ", not 3");
+
+		Cvar_Set("maxclients", std::to_string(std::max((size_t) 1, s.clients)).c_str());
+
+		ge->Init();
+
+		if (s.clients > ge->max_edicts - 1)
+			Sys_Error("too many clients");
+
+		SV_ClearWorld();
+		ge->SpawnEntities(s.mapname.c_str(), s.entities.c_str(), "");
+
+		for (const std::string &cmd : s.server_commands)
+			SV_ServerCommand(cmd);
+
+		std::vector<edict *> clients;
+
+		for (size_t i = 0; i < s.clients; i++)
+		{
+			edict *ent = EDICT_NUM(i + 1);
+			char userinfo[MAX_INFO_STRING];
+			snprintf(userinfo, sizeof(userinfo), "\\name\\bench%zu\\skin\\male/grunt\\hand\\0", i);
+
+			if (!ge->ClientConnect(ent, userinfo))
+				Sys_Error("client " + std::to_string(i) + " refused");
+
+			ge->ClientBegin(ent);
+			clients.push_back(ent);
+		}
+
+		samples frame { "frame", {} }, runframe { "RunFrame", {} }, think { "ClientThink", {} }, engine { "engine", {} }, game { "game", {} };
+		usercmd cmd {};
+		float yaw = 0;
+
+		cmd.msec = (uint8_t) (100 / std::max((size_t) 1, s.cmdrate));
+		cmd.forwardmove = s.forwardmove;
+		cmd.sidemove = s.sidemove;
+		cmd.upmove = s.upmove;
+		cmd.buttons = s.buttons;
+
+		for (size_t f = 0; f < s.warmup + s.frames; f++)
+		{
+			const bool measure = f >= s.warmup;
+			sv_stats = {};
+
+			const auto frame_start = clock::now();
+
+			for (size_t c = 0; c < s.cmdrate; c++)
+			{
+				yaw += s.yawspeed / s.cmdrate;
+				cmd.angles[1] = (int16_t) (yaw * 65536 / 360);
+
+				for (edict *ent : clients)
+					ge->ClientThink(ent, &cmd);
+			}
+
+			const auto think_end = clock::now();
+
+			ge->RunFrame();
+
+			const auto frame_end = clock::now();
+
+			if (!measure)
+				continue;
+
+			frame.values.push_back((frame_end - frame_start).count());
+			think.values.push_back((think_end - frame_start).count());
+			runframe.values.push_back((frame_end - think_end).count());
+			engine.values.push_back(sv_stats.time.count());
+			game.values.push_back((frame_end - frame_start - sv_stats.time).count());
+		}
+
+		printf("%zu frames, %zu clients, %u/%u entities\n", s.frames, s.clients, ge->num_edicts, ge->max_edicts);
+		printf("%-12s %10s %10s %10s %10s %10s %10s\n", "(usec)", "mean", "p50", "p90", "p99", "p99.9", "max");
+
+		for (samples *set : { &frame, &runframe, &think, &engine, &game })
+			set->print();
+
+		for (edict *ent : clients)
+			ge->ClientDisconnect(ent);
+
+		ge->Shutdown();
+		SV_Shutdown();
+
+		return 0;
+	}
+
+	// a g_record log, read front to back
+	class replay_log
+	{
+		std::string	data;
+		size_t		pos = 0;
+
+	public:
+		replay_log(std::string data) :
+			data(std::move(data))
+		{
+		}
+
+		bool empty() const { return pos >= data.size(); }
+
+		void read(void *out, size_t length)
+		{
+			if (data.size() - pos < length)
+				Sys_Error("replay log is truncated");
+
+			memcpy(out, data.data() + pos, length);
+			pos += length;
+		}
+
+		template<typename T>
+		T read()
+		{
+			T value;
+			read(&value, sizeof(value));
+			return value;
+		}
+
+		uint64_t read_varint()
+		{
+			uint64_t value = 0;
+
+			for (uint32_t shift = 0; ; shift += 7)
+			{
+				const uint8_t b = read<uint8_t>();
+				value |= (uint64_t) (b & 0x7f) << shift;
+
+				if (!(b & 0x80))
+					return value;
+			}
+		}
+
+		std::string read_string()
+		{
+			std::string s(read_varint(), '\0');
+			read(s.data(), s.size());
+			return s;
+		}
+	};
+
+	static int32_t Replay_Run(const std::string &log_path, const std::string &game_path)
+	{
+		static_assert(sizeof(usercmd) == RECORD_USERCMD_SIZE, "usercmd doesn't match the recording format");
+
+		replay_log log(Script_ReadFile(log_path));
+
+		if (log.read<uint32_t>() != RECORD_MAGIC)
+			Sys_Error(log_path + " isn't a recording");
+		else if (const uint32_t version = log.read<uint32_t>(); version != RECORD_VERSION)
+			Sys_Error(log_path + " is version " + std::to_string(version) + ", not " + std::to_string(RECORD_VERSION));
+
+		const uint32_t maxclients = log.read<uint32_t>();
+
+		const get_game_api GetGameAPI = Sys_LoadGame(game_path);
+
+		if (!GetGameAPI)
+			Sys_Error("no GetGameAPI in " + game_path);
+
+		game_import import = SV_GetGameImports();
+		ge = GetGameAPI(&import);
+
+		if (ge->apiversion != 3)
+			Sys_Error("game is version " + std::to_string(ge->apiversion) + ", not 3");
+
+		// the client slots have to line up with the recording
+		Cvar_Set("maxclients", std::to_string(maxclients).c_str());
+
+		ge->Init();
+
+		if (maxclients > ge->max_edicts - 1)
+			Sys_Error("too many clients");
+
+		// the last usercmd for each entity number; deltas apply to these
+		std::vector<usercmd> cmds(maxclients + 1);
+
+		auto read_client = [&]() {
+			const uint64_t n = log.read_varint();
+
+			if (n < 1 || n > maxclients)
+				Sys_Error("replay log has a bad client number");
+
+			return EDICT_NUM(n);
+		};
+
+		samples frame { "frame", {} }, runframe { "RunFrame", {} }, think { "ClientThink", {} }, engine { "engine", {} }, game { "game", {} };
+		size_t levels = 0;
+		// game time spent since the last RunFrame, and in the engine during it
+		std::chrono::nanoseconds frame_time {}, think_time {}, engine_time {};
+
+		const auto replay_start = clock::now();
+
+		while (!log.empty())
+		{
+			const record_op op = (record_op) log.read<uint8_t>();
+
+			// everything but the frame itself counts towards the frame it precedes
+			const auto call_start = clock::now();
+			sv_stats = {};
+
+			switch (op)
+			{
+			case REC_SPAWN: {
+				const std::string mapname = log.read_string(), entities = log.read_string(), spawnpoint = log.read_string();
+
+				SV_ClearWorld();
+				ge->SpawnEntities(mapname.c_str(), entities.c_str(), spawnpoint.c_str());
+				std::fill(cmds.begin(), cmds.end(), usercmd {});
+				levels++;
+				break; }
+			case REC_CONNECT: {
+				edict *ent = read_client();
+				const std::string info = log.read_string();
+				char userinfo[MAX_INFO_STRING] {};
+
+				info.copy(userinfo, sizeof(userinfo) - 1);
+				cmds[NUM_FOR_EDICT(ent)] = {};
+
+				if (!ge->ClientConnect(ent, userinfo))
+					Sys_Error("client " + std::to_string(NUM_FOR_EDICT(ent)) + " refused");
+				break; }
+			case REC_BEGIN:
+				ge->ClientBegin(read_client());
+				break;
+			case REC_USERINFO: {
+				edict *ent = read_client();
+				std::string info = log.read_string();
+
+				ge->ClientUserinfoChanged(ent, info.data());
+				break; }
+			case REC_DISCONNECT:
+				ge->ClientDisconnect(read_client());
+				break;
+			case REC_COMMAND: {
+				edict *ent = read_client();
+
+				SV_ClientCommand(ent, log.read_string());
+				break; }
+			case REC_SERVER:
+				SV_ServerCommand(log.read_string());
+				break;
+			case REC_THINK: {
+				edict *ent = read_client();
+				usercmd &cmd = cmds[NUM_FOR_EDICT(ent)];
+				const uint16_t changed = log.read<uint16_t>();
+				uint8_t *bytes = (uint8_t *) &cmd;
+
+				for (size_t i = 0; i < RECORD_USERCMD_SIZE; i++)
+					if (changed & (1 << i))
+						bytes[i] = log.read<uint8_t>();
+
+				const auto think_start = clock::now();
+				ge->ClientThink(ent, &cmd);
+				think_time += clock::now() - think_start;
+				break; }
+			case REC_FRAME: {
+				const auto frame_start = clock::now();
+				ge->RunFrame();
+				const auto frame_end = clock::now();
+
+				engine_time += sv_stats.time;
+				frame_time += frame_end - call_start;
+
+				frame.values.push_back(frame_time.count());
+				think.values.push_back(think_time.count());
+				runframe.values.push_back((frame_end - frame_start).count());
+				engine.values.push_back(engine_time.count());
+				game.values.push_back((frame_time - engine_time).count());
+
+				frame_time = think_time = engine_time = {};
+				continue; }
+			default:
+				Sys_Error("replay log has a bad op " + std::to_string(op));
+			}
+
+			frame_time += clock::now() - call_start;
+			engine_time += sv_stats.time;
+		}
+
+		const std::chrono::duration<double> elapsed = clock::now() - replay_start;
+
+		printf("%zu frames, %zu levels, %u/%u entities in %.2fs (%.1f frames/sec)\n", frame.values.size(), levels, ge->num_edicts, ge->max_edicts,
+			elapsed.count(), frame.values.size() / elapsed.count());
+		printf("%-12s %10s %10s %10s %10s %10s %10s\n", "(usec)", "mean", "p50", "p90", "p99", "p99.9", "max");
+
+		for (samples *set : { &frame, &runframe, &think, &engine, &game })
+			set->print();
+
+		ge->Shutdown();
+		SV_Shutdown();
+
+		return 0;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	using namespace bench;
+
+	std::string script_path, game_path, replay_path;
+	size_t frames = 0;
+
+#ifdef _WIN32
+#ifdef _WIN64
+	game_path = "gamex86_64.dll";
+#else
+	game_path = "gamex86.dll";
+#endif
+#else
+	game_path = "./game.so";
+#endif
+
+	// +set goes through after the script so the command line wins
+	std::vector<std::pair<std::string, std::string>> sets;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+
+		if (arg == "-check" && i + 2 < argc)
+			return Check_Run(argv[i + 1], argv[i + 2]);
+		else if (arg == "-replay" && i + 1 < argc)
+			replay_path = argv[++i];
+		else if (arg == "-game" && i + 1 < argc)
+			game_path = argv[++i];
+		else if (arg == "-frames" && i + 1 < argc)
+			frames = strtoul(argv[++i], nullptr, 10);
+		else if (arg == "-v")
+			sv_verbose = true;
+		else if (arg == "+set" && i + 2 < argc)
+		{
+			sets.emplace_back(argv[i + 1], argv[i + 2]);
+			i += 2;
+		}
+		else if (script_path.empty())
+			script_path = arg;
+		else
+			Sys_Error("unknown argument " + arg);
+	}
+
+	if (script_path.empty() && replay_path.empty())
+	{
+		fprintf(stderr, "usage: bench <script> [-game <module>] [-frames <n>] [-v] [+set <cvar> <value>]...\n");
+		fprintf(stderr, "       bench [<script>] -replay <log> [-game <module>] [-v] [+set <cvar> <value>]...\n");
+		fprintf(stderr, "       bench -check <a> <b>\n");
+		return 1;
+	}
+
+	script s = script_path.empty() ? script {} : Script_Load(script_path);
+
+	if (frames)
+		s.frames = frames;
+
+	for (auto &[name, value] : sets)
+		Cvar_Set(name.c_str(), value.c_str());
+
+	try
+	{
+		if (!replay_path.empty())
+			return Replay_Run(replay_path, game_path);
+
+		return Bench_Run(s, game_path);
+	}
+	catch (const game_error &err)
+	{
+		Sys_Error("game error: " + err.message);
+	}
+}
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Engine-side view of the structures shared with the game module.
+// The game describes these with its own types in lib/protocol.h,
+// lib/gi.h and main.cpp; the headless engine only ever sees them
+// through the C ABI, the same way a real server does, so these
+// must be kept bit-compatible with the game's definitions.
+
+namespace bench
+{
+	using vec3 = float[3];
+	using qboolean = int32_t;
+
+	struct edict;
+
+	constexpr size_t MAX_QPATH = 64;
+	constexpr size_t MAX_INFO_STRING = 512;
+	constexpr size_t MAX_ENT_CLUSTERS = 16;
+	constexpr size_t MAX_TOUCH = 32;
+
+	// per-level limits; must match lib/protocol.h
+	constexpr size_t MAX_CLIENTS = 256;
+	constexpr size_t MAX_LIGHTSTYLES = 256;
+	constexpr size_t MAX_MODELS = 256;
+	constexpr size_t MAX_SOUNDS = 256;
+	constexpr size_t MAX_IMAGES = 256;
+	constexpr size_t MAX_ITEMS = 256;
+	constexpr size_t MAX_GENERAL = MAX_CLIENTS * 2;
+
+	constexpr int32_t CS_MODELS = 32;
+	constexpr int32_t CS_SOUNDS = CS_MODELS + MAX_MODELS;
+	constexpr int32_t CS_IMAGES = CS_SOUNDS + MAX_SOUNDS;
+	constexpr int32_t CS_LIGHTS = CS_IMAGES + MAX_IMAGES;
+	constexpr int32_t CS_ITEMS = CS_LIGHTS + MAX_LIGHTSTYLES;
+	constexpr int32_t CS_PLAYERSKINS = CS_ITEMS + MAX_ITEMS;
+	constexpr int32_t CS_GENERAL = CS_PLAYERSKINS + MAX_CLIENTS;
+	constexpr int32_t MAX_CONFIGSTRINGS = CS_GENERAL + MAX_GENERAL;
+
+	// content flags the engine has to know about
+	constexpr int32_t CONTENTS_SOLID = 1 << 0;
+	constexpr int32_t CONTENTS_WINDOW = 1 << 1;
+	constexpr int32_t CONTENTS_PLAYERCLIP = 1 << 16;
+	constexpr int32_t CONTENTS_MONSTER = 1 << 25;
+	constexpr int32_t CONTENTS_DEADMONSTER = 1 << 26;
+	constexpr int32_t MASK_PLAYERSOLID = CONTENTS_SOLID | CONTENTS_PLAYERCLIP | CONTENTS_WINDOW | CONTENTS_MONSTER;
+
+	constexpr uint32_t SVF_DEADMONSTER = 1 << 1;
+	constexpr uint32_t SVF_MONSTER = 1 << 2;
+
+	enum solidity : uint32_t
+	{
+		SOLID_NOT,
+		SOLID_TRIGGER,
+		SOLID_BBOX,
+		SOLID_BSP
+	};
+
+	constexpr int32_t AREA_SOLID = 1;
+	constexpr int32_t AREA_TRIGGERS = 2;
+
+	struct csurface
+	{
+		char		name[16];
+		int32_t		flags;
+		int32_t		value;
+	};
+
+	struct cplane
+	{
+		vec3	normal;
+		float	dist;
+		uint8_t	type;
+		uint8_t	signbits;
+		uint8_t	pad[2];
+	};
+
+	struct trace
+	{
+		qboolean		allsolid;
+		qboolean		startsolid;
+		float			fraction;
+		vec3			endpos;
+		cplane			plane;
+		const csurface	*surface;
+		int32_t			contents;
+		edict			*ent;
+	};
+
+	struct cvar
+	{
+		const char	*name;
+		const char	*string;
+		const char	*latched_string;
+		int32_t		flags;
+		qboolean	modified;
+		float		value;
+		cvar		*next;
+	};
+
+	struct link
+	{
+		link	*prev, *next;
+	};
+
+	struct entity_state
+	{
+		uint32_t	number;
+
+		vec3	origin;
+		vec3	angles;
+		vec3	old_origin;
+		int32_t	modelindex;
+		int32_t	modelindex2, modelindex3, modelindex4;
+		int32_t	frame;
+		int32_t	skinnum;
+		uint32_t	effects;
+		int32_t	renderfx;
+		int32_t	solid;
+		int32_t	sound;
+		int32_t	event;
+	};
+
+	// the part of an entity that the engine is allowed to see;
+	// the rest of the entity is opaque and owned by the game.
+	struct edict
+	{
+		entity_state	s;
+		void			*client;
+		qboolean		inuse;
+		int32_t			linkcount;
+
+		link	area;
+
+		int32_t	num_clusters;
+		int32_t	clusternums[MAX_ENT_CLUSTERS];
+		int32_t	headnode;
+		int32_t	areanum, areanum2;
+
+		uint32_t	svflags;
+		vec3		mins, maxs;
+		vec3		absmin, absmax, size;
+		solidity	solid;
+		int32_t		clipmask;
+		edict		*owner;
+	};
+
+	struct usercmd
+	{
+		uint8_t	msec;
+		uint8_t	buttons;
+		int16_t	angles[3];
+		int16_t	forwardmove, sidemove, upmove;
+		uint8_t	impulse;
+		uint8_t	lightlevel;
+	};
+
+	struct pmove_state
+	{
+		int32_t	pm_type;
+		int16_t	origin[3];
+		int16_t	velocity[3];
+		uint8_t	pm_flags;
+		uint8_t	pm_time;
+		int16_t	gravity;
+		int16_t	delta_angles[3];
+	};
+
+	struct pmove
+	{
+		pmove_state	s;
+
+		usercmd		cmd;
+		qboolean	snapinitial;
+
+		int32_t	numtouch;
+		edict	*touchents[MAX_TOUCH];
+
+		vec3	viewangles;
+		float	viewheight;
+
+		vec3	mins, maxs;
+
+		edict	*groundentity;
+		int32_t	watertype;
+		int32_t	waterlevel;
+
+		bench::trace	(*trace)(const float *start, const float *mins, const float *maxs, const float *end);
+		int32_t	(*pointcontents)(const float *point);
+	};
+
+	// must match game_import_impl in lib/gi.h
+	struct game_import
+	{
+		void (*bprintf)(int32_t printlevel, const char *fmt, ...);
+		void (*dprintf)(const char *fmt, ...);
+		void (*cprintf)(edict *ent, int32_t printlevel, const char *fmt, ...);
+		void (*centerprintf)(edict *ent, const char *fmt, ...);
+		void (*sound)(edict *ent, int32_t channel, int32_t soundindex, float volume, float attenuation, float time_offset);
+		void (*positioned_sound)(const float *origin, edict *ent, int32_t channel, int32_t soundindex, float volume, float attenuation, float time_offset);
+
+		void (*configstring)(int32_t num, const char *string);
+
+		void (*error)(const char *fmt, ...);
+
+		int32_t (*modelindex)(const char *name);
+		int32_t (*soundindex)(const char *name);
+		int32_t (*imageindex)(const char *name);
+
+		void (*setmodel)(edict *ent, const char *name);
+
+		bench::trace (*trace)(const float *start, const float *mins, const float *maxs, const float *end, edict *passent, int32_t contentmask);
+		int32_t (*pointcontents)(const float *point);
+		qboolean (*inPVS)(const float *p1, const float *p2);
+		qboolean (*inPHS)(const float *p1, const float *p2);
+		void (*SetAreaPortalState)(int32_t portalnum, qboolean open);
+		qboolean (*AreasConnected)(int32_t area1, int32_t area2);
+
+		void (*linkentity)(edict *ent);
+		void (*unlinkentity)(edict *ent);
+		int32_t (*BoxEdicts)(const float *mins, const float *maxs, edict **list, int32_t maxcount, int32_t areatype);
+		void (*Pmove)(bench::pmove *pmove);
+
+		void (*multicast)(const float *origin, int32_t to);
+		void (*unicast)(edict *ent, qboolean reliable);
+		void (*WriteChar)(int32_t c);
+		void (*WriteByte)(int32_t c);
+		void (*WriteShort)(int32_t c);
+		void (*WriteLong)(int32_t c);
+		void (*WriteFloat)(float f);
+		void (*WriteString)(const char *s);
+		void (*WritePosition)(const float *pos);
+		void (*WriteDir)(const float *pos);
+		void (*WriteAngle)(float f);
+
+		void *(*TagMalloc)(uint32_t size, uint32_t tag);
+		void (*TagFree)(void *block);
+		void (*FreeTags)(uint32_t tag);
+
+		bench::cvar *(*cvar)(const char *var_name, const char *value, int32_t flags);
+		bench::cvar *(*cvar_set)(const char *var_name, const char *value);
+		bench::cvar *(*cvar_forceset)(const char *var_name, const char *value);
+
+		int32_t (*argc)();
+		char *(*argv)(int32_t n);
+		char *(*args)();
+
+		void (*AddCommandString)(const char *text);
+
+		void (*DebugGraph)(float value, int32_t color);
+	};
+
+	// must match game_export in main.cpp
+	struct game_export
+	{
+		int32_t	apiversion;
+
+		void (*Init)();
+		void (*Shutdown)();
+
+		void (*SpawnEntities)(const char *mapname, const char *entstring, const char *spawnpoint);
+
+		void (*WriteGame)(const char *filename, qboolean autosave);
+		void (*ReadGame)(const char *filename);
+
+		void (*WriteLevel)(const char *filename);
+		void (*ReadLevel)(const char *filename);
+
+		qboolean (*ClientConnect)(edict *ent, char *userinfo);
+		void (*ClientBegin)(edict *ent);
+		void (*ClientUserinfoChanged)(edict *ent, char *userinfo);
+		void (*ClientDisconnect)(edict *ent);
+		void (*ClientCommand)(edict *ent);
+		void (*ClientThink)(edict *ent, usercmd *cmd);
+
+		void (*RunFrame)();
+
+		void (*ServerCommand)();
+
+		uint8_t		*edicts;
+		uint32_t	edict_size;
+		uint32_t	num_edicts;
+		uint32_t	max_edicts;
+	};
+
+	using get_game_api = game_export *(*)(game_import *);
+}
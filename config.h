@@ -36,8 +36,14 @@
 /*@@ { "macro": "CUSTOM_PMOVE", "desc": "By default, this codebase uses the PMove export from the engine; if you wish to create a custom player movement system, you can use Y here and edit pmove.cpp." } @@*/
 //#define CUSTOM_PMOVE
 
+/*@@ { "macro": "PROFILING", "desc": "Compile in the frame profiler, which times think, touch and physics calls. It does nothing until started with \"sv prof start\"; see profile.cpp." } @@*/
+#define PROFILING
+
 /*@@ { "macro": "SAVING", "desc": "Allow save/load code.", "depends": [ "SINGLE_PLAYER" ] } @@*/
 #define SAVING
 
 /*@@ { "macro": "SAVING", "desc": "Save/load in JSON rather than binary. This format is slower, but allows for compatibility between save code as long as names haven't changed.", "depends": [ "SAVING" ] } @@*/
-#define JSON_SAVE_FORMAT
\ No newline at end of file
+#define JSON_SAVE_FORMAT
+
+/*@@ { "macro": "COMPACT_SAVE_FORMAT", "desc": "Save/load in a compact tagged binary format. Like JSON, saves remain loadable between builds as long as member names haven't changed, but files are much smaller and faster to read and write. JSON_SAVE_FORMAT takes precedence, so turn that off to use this.", "depends": [ "SAVING" ] } @@*/
+//#define COMPACT_SAVE_FORMAT
@@ -5,6 +5,7 @@
 #include "game.h"
 #include "move.h"
 #include "ai.h"
+#include "monster.h"
 #include "game/weaponry.h"
 
 #include "lib/gi.h"
@@ -54,6 +55,28 @@ void AI_SetSightClient()
 	}
 }
 
+bool AI_ClientInPVS(const entity &self)
+{
+	for (entity &ent : entity_range(1, game.maxclients))
+		if (ent.inuse && gi.inPVS(self.origin, ent.origin))
+			return true;
+
+	return false;
+}
+
+void AI_WakeDormant(vector where)
+{
+	for (entity &ent : G_IterateLive(game.maxclients + 1))
+	{
+		if (!(ent.svflags & SVF_MONSTER) || !std::as_const(ent.monsterinfo)->dormant)
+			continue;
+
+		// same test FindTarget uses for hearing
+		if (gi.inPHS(where, ent.origin))
+			M_Wake(ent, WAKE_SOUND);
+	}
+}
+
 //============================================================================
 
 void ai_move(entity &self, float dist)
@@ -64,13 +87,13 @@ void ai_move(entity &self, float dist)
 // records sighting of an enemy
 inline void ai_enemy_visible(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_LOST_SIGHT;
-	self.monsterinfo.last_sighting = self.enemy->origin;
-	self.monsterinfo.trail_time = level.time;
+	self.monsterinfo->aiflags &= ~AI_LOST_SIGHT;
+	self.monsterinfo->last_sighting = self.enemy->origin;
+	self.monsterinfo->trail_time = level.time;
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blind_fire_target = self.enemy->origin;
-	self.monsterinfo.blind_fire_framedelay = gtime::zero();
+	self.monsterinfo->blind_fire_target = self.enemy->origin;
+	self.monsterinfo->blind_fire_framedelay = gtime::zero();
 #endif
 }
 
@@ -79,20 +102,20 @@ void ai_stand(entity &self, float dist)
 	if (dist)
 		M_walkmove(self, self.angles[YAW], dist);
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		if (self.enemy.has_value())
 		{
 			self.ideal_yaw = vectoyaw(self.enemy->origin - self.origin);
 
-			if (self.angles[YAW] != self.ideal_yaw && self.monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+			if (self.angles[YAW] != self.ideal_yaw && self.monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
 			{
-				self.monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self.monsterinfo.run(self);
+				self.monsterinfo->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				self.monsterinfo->run(self);
 			}
 			
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-			if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+			if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 				M_ChangeYaw (self);
 
@@ -116,21 +139,21 @@ void ai_stand(entity &self, float dist)
 	if (FindTarget(self))
 		return;
 
-	if (level.time > self.monsterinfo.pause_time)
+	if (level.time > self.monsterinfo->pause_time)
 	{
-		self.monsterinfo.walk(self);
+		self.monsterinfo->walk(self);
 		return;
 	}
 
-	if (!(self.spawnflags & 1) && self.monsterinfo.idle && (level.time > self.monsterinfo.idle_time))
+	if (!(self.spawnflags & 1) && self.monsterinfo->idle && (level.time > self.monsterinfo->idle_time))
 	{
-		if (self.monsterinfo.idle_time != gtime::zero())
+		if (self.monsterinfo->idle_time != gtime::zero())
 		{
-			self.monsterinfo.idle(self);
-			self.monsterinfo.idle_time = level.time + random(15s, 30s);
+			self.monsterinfo->idle(self);
+			self.monsterinfo->idle_time = level.time + random(15s, 30s);
 		}
 		else
-			self.monsterinfo.idle_time = level.time + random(15s);
+			self.monsterinfo->idle_time = level.time + random(15s);
 	}
 }
 
@@ -143,15 +166,15 @@ void ai_walk(entity &self, float dist)
 	if (FindTarget(self))
 		return;
 
-	if (self.monsterinfo.search && (level.time > self.monsterinfo.idle_time))
+	if (self.monsterinfo->search && (level.time > self.monsterinfo->idle_time))
 	{
-		if (self.monsterinfo.idle_time != gtime::zero())
+		if (self.monsterinfo->idle_time != gtime::zero())
 		{
-			self.monsterinfo.search(self);
-			self.monsterinfo.idle_time = level.time + random(15s, 30s);
+			self.monsterinfo->search(self);
+			self.monsterinfo->idle_time = level.time + random(15s, 30s);
 		}
 		else
-			self.monsterinfo.idle_time = level.time + random(15s);
+			self.monsterinfo->idle_time = level.time + random(15s);
 	}
 }
 
@@ -164,13 +187,13 @@ void ai_charge(entity &self, float dist)
 #ifdef ROGUE_AI
 	// save blindfire target
 	if (visible(self, self.enemy))
-		self.monsterinfo.blind_fire_target = self.enemy->origin;
+		self.monsterinfo->blind_fire_target = self.enemy->origin;
 #endif
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
 	// PMM - made AI_MANUAL_STEERING affect things differently here .. they turn, but
 	// don't set the ideal_yaw
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 		self.ideal_yaw = vectoyaw(self.enemy->origin - self.origin);
 
@@ -179,13 +202,13 @@ void ai_charge(entity &self, float dist)
 	if (dist)
 	{
 #ifdef ROGUE_AI
-		if (self.monsterinfo.aiflags & AI_CHARGING)
+		if (self.monsterinfo->aiflags & AI_CHARGING)
 		{
 			M_MoveToGoal (self, dist);
 			return;
 		}
 		// circle strafe support
-		if (self.monsterinfo.attack_state == AS_SLIDING)
+		if (self.monsterinfo->attack_state == AS_SLIDING)
 		{
 			float ofs;
 
@@ -195,7 +218,7 @@ void ai_charge(entity &self, float dist)
 				ofs = 0;
 			else 
 #endif
-			if (self.monsterinfo.lefty)
+			if (self.monsterinfo->lefty)
 				ofs = 90.f;
 			else
 				ofs = -90.f;
@@ -203,7 +226,7 @@ void ai_charge(entity &self, float dist)
 			if (M_walkmove (self, self.ideal_yaw + ofs, dist))
 				return;
 				
-			self.monsterinfo.lefty = !self.monsterinfo.lefty;
+			self.monsterinfo->lefty = !self.monsterinfo->lefty;
 			M_walkmove (self, self.ideal_yaw - ofs, dist);
 		}
 		else
@@ -222,7 +245,7 @@ void ai_turn(entity &self, float dist)
 		return;
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 		M_ChangeYaw(self);
 }
@@ -230,22 +253,22 @@ void ai_turn(entity &self, float dist)
 //============================================================================
 void AttackFinished(entity &self, gtimef time)
 {
-	self.monsterinfo.attack_finished = duration_cast<gtime>(level.time + time);
+	self.monsterinfo->attack_finished = duration_cast<gtime>(level.time + time);
 }
 
 void HuntTarget(entity &self)
 {	
 	self.goalentity = self.enemy;
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.stand(self);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->stand(self);
 	else
-		self.monsterinfo.run(self);
+		self.monsterinfo->run(self);
 
 	self.ideal_yaw = vectoyaw(self.enemy->origin - self.origin);
 
 	// wait a while before first attack
-	if (!(self.monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(self.monsterinfo->aiflags & AI_STAND_GROUND))
 		AttackFinished(self, 1s);
 }
 
@@ -264,12 +287,12 @@ void FoundTarget(entity &self)
 
 	self.show_hostile = level.time + 1s;   // wake up other monsters
 
-	self.monsterinfo.last_sighting = self.enemy->origin;
-	self.monsterinfo.trail_time = level.time;
+	self.monsterinfo->last_sighting = self.enemy->origin;
+	self.monsterinfo->trail_time = level.time;
 	
 #ifdef ROGUE_AI
-	self.monsterinfo.blind_fire_target = self.enemy->origin;
-	self.monsterinfo.blind_fire_framedelay = gtime::zero();
+	self.monsterinfo->blind_fire_target = self.enemy->origin;
+	self.monsterinfo->blind_fire_framedelay = gtime::zero();
 #endif
 
 	if (!self.combattarget)
@@ -289,14 +312,14 @@ void FoundTarget(entity &self)
 
 	// clear out our combattarget, these are a one shot deal
 	self.combattarget = nullptr;
-	self.monsterinfo.aiflags |= AI_COMBAT_POINT;
+	self.monsterinfo->aiflags |= AI_COMBAT_POINT;
 
 	// clear the targetname, that point is ours!
-	self.movetarget->targetname = nullptr;
-	self.monsterinfo.pause_time = gtime::zero();
+	G_SetTargetname(self.movetarget, nullptr);
+	self.monsterinfo->pause_time = gtime::zero();
 
 	// run for it
-	self.monsterinfo.run(self);
+	self.monsterinfo->run(self);
 }
 
 // temp
@@ -304,7 +327,7 @@ static entity_type ET_TARGET_ACTOR;
 
 bool FindTarget(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_GOOD_GUY) {
+	if (self.monsterinfo->aiflags & AI_GOOD_GUY) {
 		if (self.goalentity.has_value() && self.goalentity->inuse && self.goalentity->type) {
 			if (self.goalentity->type == ET_TARGET_ACTOR)
 				return false;
@@ -315,7 +338,7 @@ bool FindTarget(entity &self)
 	}
 
 	// if we're going to a combat point, just proceed
-	if (self.monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self.monsterinfo->aiflags & AI_COMBAT_POINT)
 		return false;
 
 // if the first spawnflag bit is set, the monster will only wake up on
@@ -358,7 +381,7 @@ bool FindTarget(entity &self)
 		return true;    // JDC false;
 
 #ifdef ROGUE_AI
-	if ((self.monsterinfo.aiflags & AI_HINT_PATH) && coop)
+	if ((self.monsterinfo->aiflags & AI_HINT_PATH) && coop)
 		heardit = false;
 #endif
 
@@ -401,7 +424,7 @@ bool FindTarget(entity &self)
 		self.enemy = cl;
 
 		if (self.enemy->type != ET_PLAYER_NOISE) {
-			self.monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+			self.monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 			if (!self.enemy->is_client) {
 				self.enemy = self.enemy->enemy;
@@ -433,12 +456,12 @@ bool FindTarget(entity &self)
 		self.ideal_yaw = vectoyaw(temp);
 		
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-		if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+		if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 			M_ChangeYaw(self);
 
 		// hunt the sound for a bit; hopefully find the real player
-		self.monsterinfo.aiflags |= AI_SOUND_TARGET;
+		self.monsterinfo->aiflags |= AI_SOUND_TARGET;
 		self.enemy = cl;
 	}
 
@@ -447,15 +470,15 @@ bool FindTarget(entity &self)
 //
 #ifdef ROGUE_AI
 	// PMM - if we got an enemy, we need to bail out of hint paths, so take over here
-	if (self.monsterinfo.aiflags & AI_HINT_PATH)
+	if (self.monsterinfo->aiflags & AI_HINT_PATH)
 		// this calls foundtarget for us
 		hintpath_stop (self);
 	else
 #endif
 		FoundTarget(self);
 
-	if (!(self.monsterinfo.aiflags & AI_SOUND_TARGET) && (self.monsterinfo.sight))
-		self.monsterinfo.sight(self, self.enemy);
+	if (!(self.monsterinfo->aiflags & AI_SOUND_TARGET) && (self.monsterinfo->sight))
+		self.monsterinfo->sight(self, self.enemy);
 
 	return true;
 }
@@ -511,21 +534,21 @@ bool M_CheckAttack(entity &self)
 				// PMM - if we can't see our target, and we're not blocked by a monster, go into blind fire if available
 				if (!(tr.ent.svflags & SVF_MONSTER) && !visible(self, self.enemy))
 				{
-					if (self.monsterinfo.blindfire && (self.monsterinfo.blind_fire_framedelay <= 20s))
+					if (self.monsterinfo->blindfire && (self.monsterinfo->blind_fire_framedelay <= 20s))
 					{
-						if (level.time < self.monsterinfo.attack_finished)
+						if (level.time < self.monsterinfo->attack_finished)
 							return false;
 
-						if (level.time < (self.monsterinfo.trail_time + self.monsterinfo.blind_fire_framedelay))
+						if (level.time < (self.monsterinfo->trail_time + self.monsterinfo->blind_fire_framedelay))
 							// wait for our time
 							return false;
 
 						// make sure we're not going to shoot a monster
-						tr = gi.traceline(spot1, self.monsterinfo.blind_fire_target, self, CONTENTS_MONSTER);
+						tr = gi.traceline(spot1, self.monsterinfo->blind_fire_target, self, CONTENTS_MONSTER);
 						if (tr.allsolid || tr.startsolid || ((tr.fraction < 1.0) && (tr.ent != self.enemy)))
 							return false;
 
-						self.monsterinfo.attack_state = AS_BLIND;
+						self.monsterinfo->attack_state = AS_BLIND;
 						return true;
 					}
 				}
@@ -541,34 +564,34 @@ bool M_CheckAttack(entity &self)
 	// melee attack
 	if (enemy_range <= RANGE_MELEE)
 	{
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 
 		// don't always melee in easy mode
 		if (!skill && random() > 0.25f)
 			return false;
 
-		if (self.monsterinfo.melee && (!self.monsterinfo.attack || !(Q_rand_uniform(4) % (skill + 1))))
-			self.monsterinfo.attack_state = AS_MELEE;
+		if (self.monsterinfo->melee && (!self.monsterinfo->attack || !(Q_rand_uniform(4) % (skill + 1))))
+			self.monsterinfo->attack_state = AS_MELEE;
 		else
-			self.monsterinfo.attack_state = AS_MISSILE;
+			self.monsterinfo->attack_state = AS_MISSILE;
 
 		return true;
 	}
 
 // missile attack
-	if (!self.monsterinfo.attack)
+	if (!self.monsterinfo->attack)
 	{
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 		return false;
 	}
 
-	if (level.time < self.monsterinfo.attack_finished)
+	if (level.time < self.monsterinfo->attack_finished)
 		return false;
 
 	if (enemy_range > RANGE_MID)
 		return false;
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND) {
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND) {
 		chance = 0.4f;
 	} else if (enemy_range < RANGE_MELEE) {
 		chance = 0.2f;
@@ -587,8 +610,8 @@ bool M_CheckAttack(entity &self)
 
 	if (random() < chance || self.enemy->solid == SOLID_NOT)
 	{
-		self.monsterinfo.attack_state = AS_MISSILE;
-		self.monsterinfo.attack_finished = level.time + random(2s);
+		self.monsterinfo->attack_state = AS_MISSILE;
+		self.monsterinfo->attack_finished = level.time + random(2s);
 		return true;
 	}
 
@@ -613,18 +636,18 @@ bool M_CheckAttack(entity &self)
 #else
 		if (random() < 0.3f)
 #endif
-			self.monsterinfo.attack_state = AS_SLIDING;
+			self.monsterinfo->attack_state = AS_SLIDING;
 		else
-			self.monsterinfo.attack_state = AS_STRAIGHT;
+			self.monsterinfo->attack_state = AS_STRAIGHT;
 	}
 
 #ifdef ROGUE_AI
 	else
 	{
 		if (random() < 0.4)
-			self.monsterinfo.attack_state = AS_SLIDING;
+			self.monsterinfo->attack_state = AS_SLIDING;
 		else
-			self.monsterinfo.attack_state = AS_STRAIGHT;
+			self.monsterinfo->attack_state = AS_STRAIGHT;
 	}
 #endif
 
@@ -645,14 +668,14 @@ static void ai_run_melee(entity &self)
 	self.ideal_yaw = enemy_yaw;
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 		M_ChangeYaw(self);
 
 	if (FacingIdeal(self))
 	{
-		self.monsterinfo.melee(self);
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+		self.monsterinfo->melee(self);
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 	}
 }
 
@@ -669,18 +692,18 @@ static void ai_run_missile(entity &self)
 	self.ideal_yaw = enemy_yaw;
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 #endif
 		M_ChangeYaw(self);
 
 	if (FacingIdeal(self))
 	{
-		self.monsterinfo.attack(self);
+		self.monsterinfo->attack(self);
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)	
-		if (self.monsterinfo.attack_state == AS_MISSILE || self.monsterinfo.attack_state == AS_BLIND)
+		if (self.monsterinfo->attack_state == AS_MISSILE || self.monsterinfo->attack_state == AS_BLIND)
 #endif
-			self.monsterinfo.attack_state = AS_STRAIGHT;
+			self.monsterinfo->attack_state = AS_STRAIGHT;
 	}
 }
 
@@ -702,7 +725,7 @@ static void ai_run_slide(entity &self, float distance)
 	self.ideal_yaw = enemy_yaw;
 
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 		M_ChangeYaw(self);
 
 #endif
@@ -711,7 +734,7 @@ static void ai_run_slide(entity &self, float distance)
 		distance = min(distance, MAX_SIDESTEP);
 
 #endif
-	if (self.monsterinfo.lefty)
+	if (self.monsterinfo->lefty)
 		ofs = 90.f;
 	else
 		ofs = -90.f;
@@ -721,27 +744,27 @@ static void ai_run_slide(entity &self, float distance)
 
 #ifdef ROGUE_AI
 	// PMM - if we're dodging, give up on it and go straight
-	if (self.monsterinfo.aiflags & AI_DODGING)
+	if (self.monsterinfo->aiflags & AI_DODGING)
 	{
 		monster_done_dodge (self);
 		// by setting as_straight, caller will know to try straight move
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 		return;
 	}
 #endif
 
-	self.monsterinfo.lefty = !self.monsterinfo.lefty;
+	self.monsterinfo->lefty = !self.monsterinfo->lefty;
 
 #ifdef ROGUE_AI
 	if (M_walkmove (self, self.ideal_yaw - ofs, distance))
 		return;
 
 	// if we're dodging, give up on it and go straight
-	if (self.monsterinfo.aiflags & AI_DODGING)
+	if (self.monsterinfo->aiflags & AI_DODGING)
 		monster_done_dodge (self);
 
 	// the move failed, so signal the caller (ai_run) to try going straight
-	self.monsterinfo.attack_state = AS_STRAIGHT;
+	self.monsterinfo->attack_state = AS_STRAIGHT;
 #else
 	M_walkmove(self, self.ideal_yaw - ofs, distance);
 #endif
@@ -753,10 +776,10 @@ bool ai_checkattack(entity &self, float)
 // this causes monsters to run blindly to the combat point w/o firing
 	if (self.goalentity.has_value())
 	{
-		if (self.monsterinfo.aiflags & AI_COMBAT_POINT)
+		if (self.monsterinfo->aiflags & AI_COMBAT_POINT)
 			return false;
 
-		if (self.monsterinfo.aiflags & AI_SOUND_TARGET)
+		if (self.monsterinfo->aiflags & AI_SOUND_TARGET)
 		{
 			if ((level.time - self.enemy->last_sound_time) > 5s)
 			{
@@ -767,9 +790,9 @@ bool ai_checkattack(entity &self, float)
 					else
 						self.goalentity = null_entity;
 				}
-				self.monsterinfo.aiflags &= ~AI_SOUND_TARGET;
-				if (self.monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
-					self.monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				self.monsterinfo->aiflags &= ~AI_SOUND_TARGET;
+				if (self.monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
+					self.monsterinfo->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
 			}
 			else
 			{
@@ -786,14 +809,14 @@ bool ai_checkattack(entity &self, float)
 
 	if ((!self.enemy.has_value()) || (!self.enemy->inuse))
 		hesDeadJim = true;
-	else if (self.monsterinfo.aiflags & AI_MEDIC)
+	else if (self.monsterinfo->aiflags & AI_MEDIC)
 	{
 		if (!(self.enemy->inuse) || self.enemy->health > 0)
 			hesDeadJim = true;
 	}
 	else
 	{
-		if (self.monsterinfo.aiflags & AI_BRUTAL)
+		if (self.monsterinfo->aiflags & AI_BRUTAL)
 		{
 			if (self.enemy->health <= -80)
 				hesDeadJim = true;
@@ -807,7 +830,7 @@ bool ai_checkattack(entity &self, float)
 
 	if (hesDeadJim)
 	{
-		self.monsterinfo.aiflags &= ~AI_MEDIC;
+		self.monsterinfo->aiflags &= ~AI_MEDIC;
 		self.enemy = 0;
 		// FIXME: look all around for other targets
 		if (self.oldenemy.has_value() && self.oldenemy->health > 0)
@@ -817,11 +840,11 @@ bool ai_checkattack(entity &self, float)
 			HuntTarget(self);
 		}
 #ifdef ROGUE_AI
-		else if (self.monsterinfo.last_player_enemy.has_value() && self.monsterinfo.last_player_enemy->health > 0)
+		else if (self.monsterinfo->last_player_enemy.has_value() && self.monsterinfo->last_player_enemy->health > 0)
 		{
-			self.enemy = self.monsterinfo.last_player_enemy;
+			self.enemy = self.monsterinfo->last_player_enemy;
 			self.oldenemy = 0;
-			self.monsterinfo.last_player_enemy = 0;
+			self.monsterinfo->last_player_enemy = 0;
 			HuntTarget (self);
 		}
 #endif
@@ -829,14 +852,14 @@ bool ai_checkattack(entity &self, float)
 		{
 			if (self.movetarget.has_value()) {
 				self.goalentity = self.movetarget;
-				self.monsterinfo.walk(self);
+				self.monsterinfo->walk(self);
 			} else {
 				// we need the pausetime otherwise the stand code
 				// will just revert to walking with no target and
 				// the monsters will wonder around aimlessly trying
 				// to hunt the world entity
-				self.monsterinfo.pause_time = gtime::max();
-				self.monsterinfo.stand(self);
+				self.monsterinfo->pause_time = gtime::max();
+				self.monsterinfo->stand(self);
 			}
 			return true;
 		}
@@ -848,7 +871,7 @@ bool ai_checkattack(entity &self, float)
 	enemy_vis = visible(self, self.enemy);
 	if (enemy_vis)
 	{
-		self.monsterinfo.search_time = level.time + 5s;
+		self.monsterinfo->search_time = level.time + 5s;
 		ai_enemy_visible(self);
 	}
 
@@ -859,7 +882,7 @@ bool ai_checkattack(entity &self, float)
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
 	// PMM -- reordered so the monster specific checkattack is called before the run_missle/melee/checkvis
 	// stuff .. this allows for, among other things, circle strafing and attacking while in ai_run
-	bool retval = self.monsterinfo.checkattack (self);
+	bool retval = self.monsterinfo->checkattack (self);
 
 	if (!retval)
 		return false;
@@ -869,16 +892,16 @@ bool ai_checkattack(entity &self, float)
 	if (!enemy_vis)
 		return false;
 
-	if (self.monsterinfo.attack_state == AS_MISSILE
+	if (self.monsterinfo->attack_state == AS_MISSILE
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-		|| self.monsterinfo.attack_state == AS_BLIND
+		|| self.monsterinfo->attack_state == AS_BLIND
 #endif
 		)
 	{
 		ai_run_missile(self);
 		return true;
 	}
-	else if (self.monsterinfo.attack_state == AS_MELEE)
+	else if (self.monsterinfo->attack_state == AS_MELEE)
 	{
 		ai_run_melee(self);
 		return true;
@@ -887,7 +910,7 @@ bool ai_checkattack(entity &self, float)
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
 	return true;
 #else
-	return self.monsterinfo.checkattack(self);
+	return self.monsterinfo->checkattack(self);
 #endif
 }
 
@@ -902,7 +925,7 @@ void ai_run(entity &self, float dist)
 	bool	alreadyMoved = false;
 
 	// if we're going to a combat point, just proceed
-	if (self.monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self.monsterinfo->aiflags & AI_COMBAT_POINT)
 	{
 		M_MoveToGoal(self, dist);
 		return;
@@ -912,13 +935,13 @@ void ai_run(entity &self, float dist)
 	bool		gotcha = false;
 	entityref	realEnemy;
 
-	if (self.monsterinfo.aiflags & AI_DUCKED)
-		self.monsterinfo.aiflags &= ~AI_DUCKED;
-	if (self.bounds.maxs[2] != self.monsterinfo.base_height)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
+		self.monsterinfo->aiflags &= ~AI_DUCKED;
+	if (self.bounds.maxs[2] != self.monsterinfo->base_height)
 		monster_duck_up (self);
 
 	// if we're currently looking for a hint path
-	if (self.monsterinfo.aiflags & AI_HINT_PATH)
+	if (self.monsterinfo->aiflags & AI_HINT_PATH)
 	{
 		M_MoveToGoal (self, dist);
 
@@ -973,12 +996,12 @@ void ai_run(entity &self, float dist)
 	}
 #endif
 
-	if (self.monsterinfo.aiflags & AI_SOUND_TARGET)
+	if (self.monsterinfo->aiflags & AI_SOUND_TARGET)
 	{
 		if (!self.enemy.has_value() || VectorLength(self.origin - self.enemy->origin) < 64)
 		{
-			self.monsterinfo.aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-			self.monsterinfo.stand(self);
+			self.monsterinfo->aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+			self.monsterinfo->stand(self);
 			return;
 		}
 
@@ -997,17 +1020,17 @@ void ai_run(entity &self, float dist)
 	bool retval = ai_checkattack (self, dist);
 
 	// don't strafe if we can't see our enemy
-	if (!enemy_vis && self.monsterinfo.attack_state == AS_SLIDING)
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+	if (!enemy_vis && self.monsterinfo->attack_state == AS_SLIDING)
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 	// unless we're dodging (dodging out of view looks smart)
-	if (self.monsterinfo.aiflags & AI_DODGING)
-		self.monsterinfo.attack_state = AS_SLIDING;
+	if (self.monsterinfo->aiflags & AI_DODGING)
+		self.monsterinfo->attack_state = AS_SLIDING;
 #else
 	if (ai_checkattack(self, dist))
 		return;
 #endif
 
-	if (self.monsterinfo.attack_state == AS_SLIDING)
+	if (self.monsterinfo->attack_state == AS_SLIDING)
 	{
 		// protect against double moves
 		if (!alreadyMoved)
@@ -1018,15 +1041,15 @@ void ai_run(entity &self, float dist)
 		// move succeeded.  If the move succeeded, and we're still sliding, we're done in here (since we've
 		// had our chance to shoot in ai_checkattack, and have moved).
 		// if the move failed, our state is as_straight, and it will be taken care of below
-		if (!retval && self.monsterinfo.attack_state == AS_SLIDING)
+		if (!retval && self.monsterinfo->attack_state == AS_SLIDING)
 #endif
 			return;
 	}
 #ifdef ROGUE_AI
-	else if (self.monsterinfo.aiflags & AI_CHARGING)
+	else if (self.monsterinfo->aiflags & AI_CHARGING)
 	{
 		self.ideal_yaw = enemy_yaw;
-		if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+		if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 			M_ChangeYaw (self);
 	}
 
@@ -1034,7 +1057,7 @@ void ai_run(entity &self, float dist)
 	{
 		// PMM - is this useful? Monsters attacking usually call the ai_charge routine..
 		// the only monster this affects should be the soldier
-		if (dist != 0 && !alreadyMoved && self.monsterinfo.attack_state == AS_STRAIGHT && !(self.monsterinfo.aiflags & AI_STAND_GROUND))
+		if (dist != 0 && !alreadyMoved && self.monsterinfo->attack_state == AS_STRAIGHT && !(self.monsterinfo->aiflags & AI_STAND_GROUND))
 			M_MoveToGoal (self, dist);
 
 		if (self.enemy.has_value() && self.enemy->inuse && enemy_vis)
@@ -1058,13 +1081,13 @@ void ai_run(entity &self, float dist)
 
 #ifdef ROGUE_AI
 	// if we've been looking (unsuccessfully) for the player for 5 seconds
-	if ((self.monsterinfo.trail_time + 5s) <= level.time)
+	if ((self.monsterinfo->trail_time + 5s) <= level.time)
 	{
 		// and we haven't checked for valid hint paths in the last 10 seconds
-		if ((self.monsterinfo.last_hint_time + 10s) <= level.time)
+		if ((self.monsterinfo->last_hint_time + 10s) <= level.time)
 		{
 			// check for hint_paths.
-			self.monsterinfo.last_hint_time = level.time;
+			self.monsterinfo->last_hint_time = level.time;
 
 			if (monsterlost_checkhint(self))
 				return;
@@ -1080,11 +1103,11 @@ void ai_run(entity &self, float dist)
 			return;
 	}
 
-	if (self.monsterinfo.search_time != gtime::zero() && (level.time > (self.monsterinfo.search_time + 20s)))
+	if (self.monsterinfo->search_time != gtime::zero() && (level.time > (self.monsterinfo->search_time + 20s)))
 	{
 		if (!alreadyMoved)
 			M_MoveToGoal(self, dist);
-		self.monsterinfo.search_time = gtime::zero();
+		self.monsterinfo->search_time = gtime::zero();
 		return;
 	}
 
@@ -1095,51 +1118,51 @@ void ai_run(entity &self, float dist)
 
 	isNew = false;
 
-	if (!(self.monsterinfo.aiflags & AI_LOST_SIGHT)) {
+	if (!(self.monsterinfo->aiflags & AI_LOST_SIGHT)) {
 		// just lost sight of the player, decide where to go first
-		self.monsterinfo.aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
-		self.monsterinfo.aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
+		self.monsterinfo->aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
+		self.monsterinfo->aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
 		isNew = true;
 	}
 
-	if (self.monsterinfo.aiflags & AI_PURSUE_NEXT) {
-		self.monsterinfo.aiflags &= ~AI_PURSUE_NEXT;
+	if (self.monsterinfo->aiflags & AI_PURSUE_NEXT) {
+		self.monsterinfo->aiflags &= ~AI_PURSUE_NEXT;
 
 		// give ourself more time since we got this far
-		self.monsterinfo.search_time = level.time + 5s;
+		self.monsterinfo->search_time = level.time + 5s;
 
-		if (self.monsterinfo.aiflags & AI_PURSUE_TEMP) {
-			self.monsterinfo.aiflags &= ~AI_PURSUE_TEMP;
+		if (self.monsterinfo->aiflags & AI_PURSUE_TEMP) {
+			self.monsterinfo->aiflags &= ~AI_PURSUE_TEMP;
 			marker = 0;
-			self.monsterinfo.last_sighting = self.monsterinfo.saved_goal;
+			self.monsterinfo->last_sighting = self.monsterinfo->saved_goal;
 			isNew = true;
-		} else if (self.monsterinfo.aiflags & AI_PURSUIT_LAST_SEEN) {
-			self.monsterinfo.aiflags &= ~AI_PURSUIT_LAST_SEEN;
+		} else if (self.monsterinfo->aiflags & AI_PURSUIT_LAST_SEEN) {
+			self.monsterinfo->aiflags &= ~AI_PURSUIT_LAST_SEEN;
 			marker = PlayerTrail_PickFirst(self);
 		} else {
 			marker = PlayerTrail_PickNext(self);
 		}
 
 		if (marker.has_value()) {
-			self.monsterinfo.last_sighting = marker->origin;
-			self.monsterinfo.trail_time = marker->timestamp;
+			self.monsterinfo->last_sighting = marker->origin;
+			self.monsterinfo->trail_time = marker->timestamp;
 			self.angles[YAW] = self.ideal_yaw = marker->angles[YAW];
 
 			isNew = true;
 		}
 	}
 
-	vector v = self.origin - self.monsterinfo.last_sighting;
+	vector v = self.origin - self.monsterinfo->last_sighting;
 	d1 = VectorLength(v);
 	if (d1 <= dist) {
-		self.monsterinfo.aiflags |= AI_PURSUE_NEXT;
+		self.monsterinfo->aiflags |= AI_PURSUE_NEXT;
 		dist = d1;
 	}
 
-	self.goalentity->origin = self.monsterinfo.last_sighting;
+	self.goalentity->origin = self.monsterinfo->last_sighting;
 
 	if (isNew) {
-		tr = gi.trace(self.origin, self.bounds, self.monsterinfo.last_sighting, self, MASK_PLAYERSOLID);
+		tr = gi.trace(self.origin, self.bounds, self.monsterinfo->last_sighting, self, MASK_PLAYERSOLID);
 		if (tr.fraction < 1) {
 			v = self.goalentity->origin - self.origin;
 			d1 = VectorLength(v);
@@ -1166,10 +1189,10 @@ void ai_run(entity &self, float dist)
 					v = { d2 * left * 0.5f, -16, 0 };
 					left_target = G_ProjectSource(self.origin, v, v_forward, v_right);
 				}
-				self.monsterinfo.saved_goal = self.monsterinfo.last_sighting;
-				self.monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				self.monsterinfo->saved_goal = self.monsterinfo->last_sighting;
+				self.monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				self.goalentity->origin = left_target;
-				self.monsterinfo.last_sighting = left_target;
+				self.monsterinfo->last_sighting = left_target;
 				v = self.goalentity->origin - self.origin;
 				self.angles[YAW] = self.ideal_yaw = vectoyaw(v);
 			}
@@ -1180,10 +1203,10 @@ void ai_run(entity &self, float dist)
 					v = { d2 * right * 0.5f, 16, 0 };
 					right_target = G_ProjectSource(self.origin, v, v_forward, v_right);
 				}
-				self.monsterinfo.saved_goal = self.monsterinfo.last_sighting;
-				self.monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				self.monsterinfo->saved_goal = self.monsterinfo->last_sighting;
+				self.monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				self.goalentity->origin = right_target;
-				self.monsterinfo.last_sighting = right_target;
+				self.monsterinfo->last_sighting = right_target;
 				v = self.goalentity->origin - self.origin;
 				self.angles[YAW] = self.ideal_yaw = vectoyaw(v);
 			}
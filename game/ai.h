@@ -35,6 +35,12 @@ In coop games, sight_client will cycle between the clients.
 */
 void AI_SetSightClient();
 
+// whether any client is in the entity's PVS
+bool AI_ClientInPVS(const entity &self);
+
+// wake every dormant monster that could hear a noise made at where
+void AI_WakeDormant(vector where);
+
 /*
 =============
 ai_move
@@ -142,7 +148,7 @@ constexpr gtime DUCK_INTERVAL	= 500ms;
 // this is for the count of monsters
 inline int SELF_SLOTS_LEFT(entity &self)
 {
-	return (self.monsterinfo.monster_slots - self.monsterinfo.monster_used);
+	return (self.monsterinfo->monster_slots - self.monsterinfo->monster_used);
 };
 #endif
 
@@ -13,12 +13,12 @@ void check_dodge(entity &self, vector start, vector dir, int32_t speed)
 	vector end = start + (8192 * dir);
 	trace tr = gi.traceline(start, end, self, MASK_SHOT);
 
-	if (!tr.ent.is_world() && (tr.ent.svflags & SVF_MONSTER) && (tr.ent.health > 0) && tr.ent.monsterinfo.dodge && infront(tr.ent, self))
+	if (!tr.ent.is_world() && (tr.ent.svflags & SVF_MONSTER) && (tr.ent.health > 0) && std::as_const(tr.ent.monsterinfo)->dodge && infront(tr.ent, self))
 	{
 		vector v = tr.endpos - start;
 		gtimef eta { (VectorLength(v) - tr.ent.bounds.maxs.x) / speed };
 
-		tr.ent.monsterinfo.dodge(tr.ent, self, eta
+		tr.ent.monsterinfo->dodge(tr.ent, self, eta
 #ifdef ROGUE_AI
 			, tr
 #endif
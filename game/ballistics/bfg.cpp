@@ -43,7 +43,7 @@ static void bfg_explode(entity &self)
 		}
 	}
 
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 	self.frame++;
 	if (self.frame == 5)
 		self.think = SAVABLE(G_FreeEdict);
@@ -82,7 +82,7 @@ static void bfg_touch(entity &self, entity &other, vector normal, const surface
 	self.sound = SOUND_NONE;
 	self.effects &= ~EF_ANIM_ALLFAST;
 	self.think = SAVABLE(bfg_explode);
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 	self.enemy = other;
 
 	gi.ConstructMessage(svc_temp_entity, TE_BFG_BIGEXPLOSION, self.origin).multicast(self.origin, MULTICAST_PVS);
@@ -166,7 +166,7 @@ static void bfg_think(entity &self)
 		gi.ConstructMessage(svc_temp_entity, TE_BFG_LASER, self.origin, tr.endpos).multicast(self.origin, MULTICAST_PHS);
 	}
 
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 }
 
 REGISTER_STATIC_SAVABLE(bfg_think);
@@ -177,21 +177,21 @@ void fire_bfg(entity &self, vector start, vector dir, int32_t damage, int32_t sp
 	bfg.origin = start;
 	bfg.angles = vectoangles(dir);
 	bfg.velocity = dir * speed;
-	bfg.movetype = MOVETYPE_FLYMISSILE;
+	bfg.set_movetype(MOVETYPE_FLYMISSILE);
 	bfg.clipmask = MASK_SHOT;
 	bfg.solid = SOLID_BBOX;
 	bfg.effects |= EF_BFG | EF_ANIM_ALLFAST;
 	bfg.modelindex = gi.modelindex("sprites/s_bfg1.sp2");
 	bfg.owner = self;
 	bfg.touch = SAVABLE(bfg_touch);
-	bfg.nextthink = level.time + seconds(8000 / speed);
+	bfg.set_nextthink(level.time + seconds(8000 / speed));
 	bfg.think = SAVABLE(G_FreeEdict);
 	bfg.radius_dmg = damage;
 	bfg.dmg_radius = damage_radius;
 	bfg.sound = gi.soundindex("weapons/bfg__l1a.wav");
 
 	bfg.think = SAVABLE(bfg_think);
-	bfg.nextthink = level.time + 100ms;
+	bfg.set_nextthink(level.time + 100ms);
 
 #ifdef SINGLE_PLAYER
 	if (self.is_client)
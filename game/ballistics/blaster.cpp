@@ -117,7 +117,7 @@ void fire_blaster(entity &self, vector start, vector dir, int32_t damage, int32_
 	bolt.old_origin = start;
 	bolt.angles = vectoangles(dir);
 	bolt.velocity = dir * speed;
-	bolt.movetype = MOVETYPE_FLYMISSILE;
+	bolt.set_movetype(MOVETYPE_FLYMISSILE);
 	bolt.clipmask = MASK_SHOT;
 	bolt.solid = SOLID_BBOX;
 #ifdef THE_RECKONING
@@ -141,7 +141,7 @@ void fire_blaster(entity &self, vector start, vector dir, int32_t damage, int32_
 	bolt.sound = gi.soundindex("misc/lasfly.wav");
 	bolt.owner = self;
 	bolt.touch = SAVABLE(blaster_touch);
-	bolt.nextthink = level.time + 2s;
+	bolt.set_nextthink(level.time + 2s);
 	bolt.think = SAVABLE(G_FreeEdict);
 	bolt.dmg = damage;
 	if (hyper)
@@ -99,18 +99,18 @@ void fire_grenade(entity &self, vector start, vector aimdir, int32_t damage, int
 	scale = crandom(10.f);
 	grenade.velocity += (scale * right);
 	grenade.avelocity = { 300, 300, 300 };
-	grenade.movetype = MOVETYPE_BOUNCE;
+	grenade.set_movetype(MOVETYPE_BOUNCE);
 	grenade.clipmask = MASK_SHOT;
 	grenade.solid = SOLID_BBOX;
 	grenade.effects |= EF_GRENADE;
 	grenade.modelindex = gi.modelindex("models/objects/grenade/tris.md2");
 	grenade.owner = self;
 	grenade.touch = SAVABLE(Grenade_Touch);
-	grenade.nextthink = duration_cast<gtime>(level.time + timer);
+	grenade.set_nextthink(duration_cast<gtime>(level.time + timer));
 	grenade.think = SAVABLE(Grenade_Explode);
 	grenade.dmg = damage;
 	grenade.dmg_radius = damage_radius;
-	grenade.type = ET_GRENADE;
+	G_SetType(grenade, ET_GRENADE);
 
 	gi.linkentity(grenade);
 }
@@ -132,18 +132,18 @@ void fire_grenade2(entity &self, vector start, vector aimdir, int32_t damage, in
 	scale = crandom(10.f);
 	grenade.velocity += (scale * right);
 	grenade.avelocity = { 300, 300, 300 };
-	grenade.movetype = MOVETYPE_BOUNCE;
+	grenade.set_movetype(MOVETYPE_BOUNCE);
 	grenade.clipmask = MASK_SHOT;
 	grenade.solid = SOLID_BBOX;
 	grenade.effects |= EF_GRENADE;
 	grenade.modelindex = gi.modelindex("models/objects/grenade2/tris.md2");
 	grenade.owner = self;
 	grenade.touch = SAVABLE(Grenade_Touch);
-	grenade.nextthink = duration_cast<gtime>(level.time + timer);
+	grenade.set_nextthink(duration_cast<gtime>(level.time + timer));
 	grenade.think = SAVABLE(Grenade_Explode);
 	grenade.dmg = damage;
 	grenade.dmg_radius = damage_radius;
-	grenade.type = ET_GRENADE;
+	G_SetType(grenade, ET_GRENADE);
 	grenade.spawnflags = GRENADE_IS_HAND;
 	if (held)
 		grenade.spawnflags |= GRENADE_IS_HELD;
@@ -64,14 +64,14 @@ entity &fire_rocket(entity &self, vector start, vector dir, int32_t damage, int3
 	rocket.origin = start;
 	rocket.angles = vectoangles(dir);
 	rocket.velocity = dir * speed;
-	rocket.movetype = MOVETYPE_FLYMISSILE;
+	rocket.set_movetype(MOVETYPE_FLYMISSILE);
 	rocket.clipmask = MASK_SHOT;
 	rocket.solid = SOLID_BBOX;
 	rocket.effects |= EF_ROCKET;
 	rocket.modelindex = gi.modelindex("models/objects/rocket/tris.md2");
 	rocket.owner = self;
 	rocket.touch = SAVABLE(rocket_touch);
-	rocket.nextthink = level.time + seconds(8000 / speed);
+	rocket.set_nextthink(level.time + seconds(8000 / speed));
 	rocket.think = SAVABLE(G_FreeEdict);
 	rocket.dmg = damage;
 	rocket.radius_dmg = radius_damage;
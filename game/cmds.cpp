@@ -363,14 +363,14 @@ static void Cmd_Noclip_f(entity &ent)
 
 	stringlit msg;
 
-	if (ent.movetype == MOVETYPE_NOCLIP)
+	if (ent.get_movetype() == MOVETYPE_NOCLIP)
 	{
-		ent.movetype = MOVETYPE_WALK;
+		ent.set_movetype(MOVETYPE_WALK);
 		msg = "noclip OFF\n";
 	}
 	else
 	{
-		ent.movetype = MOVETYPE_NOCLIP;
+		ent.set_movetype(MOVETYPE_NOCLIP);
 		msg = "noclip ON\n";
 	}
 
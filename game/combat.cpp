@@ -92,8 +92,8 @@ static inline int32_t CheckPowerArmor(entity &ent, vector point, vector normal,
 #ifdef SINGLE_PLAYER
 	else if (ent.svflags & SVF_MONSTER)
 	{
-		power_armor_type = ent.monsterinfo.power_armor_type;
-		power = ent.monsterinfo.power_armor_power;
+		power_armor_type = std::as_const(ent.monsterinfo)->power_armor_type;
+		power = std::as_const(ent.monsterinfo)->power_armor_power;
 	}
 #endif
 	else
@@ -156,7 +156,7 @@ static inline int32_t CheckPowerArmor(entity &ent, vector point, vector normal,
 		ent.client.pers.inventory[ITEM_CELLS] = max(0, ent.client.pers.inventory[ITEM_CELLS] - power_used);
 #ifdef SINGLE_PLAYER
 	else
-		ent.monsterinfo.power_armor_power -= power_used;
+		ent.monsterinfo->power_armor_power -= power_used;
 #endif
 	return save;
 }
@@ -280,13 +280,14 @@ static inline void Killed(entity &targ, entity &inflictor, entity &attacker, int
 		targ.health = -999;
 
 #if defined(ROGUE_AI) && defined(SINGLE_PLAYER)
-	if (targ.monsterinfo.aiflags & AI_MEDIC)
+	// const, so that things that aren't monsters don't get a monsterinfo
+	if (std::as_const(targ.monsterinfo)->aiflags & AI_MEDIC)
 	{
 		if (targ.enemy.has_value())  // god, I hope so
 			cleanupHealTarget(targ.enemy);
 
 		// clean up self
-		targ.monsterinfo.aiflags &= ~AI_MEDIC;
+		targ.monsterinfo->aiflags &= ~AI_MEDIC;
 	}
 #endif
 
@@ -298,24 +299,24 @@ static inline void Killed(entity &targ, entity &inflictor, entity &attacker, int
 		if (targ.svflags & SVF_MONSTER)
 		{
 #ifdef GROUND_ZERO
-			if (targ.monsterinfo.commander.has_value() && targ.monsterinfo.commander->inuse)
+			if (targ.monsterinfo->commander.has_value() && targ.monsterinfo->commander->inuse)
 			{
-				entityref commander = targ.monsterinfo.commander;
+				entityref commander = targ.monsterinfo->commander;
 
 				//ROGUE - free up slot for spawned monster if it's spawned
-				if (((targ.monsterinfo.aiflags & AI_SPAWNED_CARRIER) && commander->type == ET_MONSTER_CARRIER) ||
-					((targ.monsterinfo.aiflags & AI_SPAWNED_MEDIC_C) && commander->type == ET_MONSTER_MEDIC_COMMANDER))
-					commander->monsterinfo.monster_slots++;
-				else if (targ.monsterinfo.aiflags & AI_SPAWNED_WIDOW)
+				if (((targ.monsterinfo->aiflags & AI_SPAWNED_CARRIER) && commander->type == ET_MONSTER_CARRIER) ||
+					((targ.monsterinfo->aiflags & AI_SPAWNED_MEDIC_C) && commander->type == ET_MONSTER_MEDIC_COMMANDER))
+					commander->monsterinfo->monster_slots++;
+				else if (targ.monsterinfo->aiflags & AI_SPAWNED_WIDOW)
 				{
 					if (commander->type == ET_MONSTER_WIDOW || commander->type == ET_MONSTER_WIDOW2)
-						if (commander->monsterinfo.monster_used)
-							commander->monsterinfo.monster_used--;
+						if (commander->monsterinfo->monster_used)
+							commander->monsterinfo->monster_used--;
 				}
 			}
 #endif
 
-			if (!(targ.monsterinfo.aiflags & AI_GOOD_GUY_MASK))
+			if (!(targ.monsterinfo->aiflags & AI_GOOD_GUY_MASK))
 			{
 				level.killed_monsters++;
 
@@ -348,6 +349,9 @@ void T_Damage(entity &targ, entity &inflictor, entity &attacker, vector dir, vec
 		return;
 #ifdef SINGLE_PLAYER
 
+	if (targ.svflags & SVF_MONSTER)
+		M_Wake(targ, WAKE_DAMAGE);
+
 	// easy mode takes half damage
 	if (!skill && !deathmatch && targ.is_client)
 	{
@@ -366,10 +370,10 @@ void T_Damage(entity &targ, entity &inflictor, entity &attacker, vector dir, vec
 	VectorNormalize(dir);
 
 	// bonus damage for surprising a monster
-	if (!(style.flags & DAMAGE_RADIUS) && (targ.svflags & SVF_MONSTER) && attacker.is_client && (!targ.enemy.has_value() || targ.monsterinfo.surprise_time > level.time) && (targ.health > 0))
+	if (!(style.flags & DAMAGE_RADIUS) && (targ.svflags & SVF_MONSTER) && attacker.is_client && (!targ.enemy.has_value() || std::as_const(targ.monsterinfo)->surprise_time > level.time) && (targ.health > 0))
 	{
 		damage *= 2;
-		targ.monsterinfo.surprise_time = level.time + 1ms;
+		targ.monsterinfo->surprise_time = level.time + 1ms;
 	}
 
 	if (targ.flags & FL_NO_KNOCKBACK)
@@ -377,7 +381,7 @@ void T_Damage(entity &targ, entity &inflictor, entity &attacker, vector dir, vec
 	// figure momentum add
 	else if (knockback && !(style.flags & DAMAGE_NO_KNOCKBACK))
 	{
-		if ((targ.movetype != MOVETYPE_NONE) && (targ.movetype != MOVETYPE_BOUNCE) && (targ.movetype != MOVETYPE_PUSH) && (targ.movetype != MOVETYPE_STOP))
+		if ((targ.get_movetype() != MOVETYPE_NONE) && (targ.get_movetype() != MOVETYPE_BOUNCE) && (targ.get_movetype() != MOVETYPE_PUSH) && (targ.get_movetype() != MOVETYPE_STOP))
 		{
 			vector kvel;
 			const float	calc_mass = max(50.f, (float) targ.mass);
@@ -404,7 +408,7 @@ void T_Damage(entity &targ, entity &inflictor, entity &attacker, vector dir, vec
 	// check for invincibility
 	if (!(style.flags & DAMAGE_NO_PROTECTION) && (targ.is_client && targ.client.invincible_time > level.time)
 #if defined(GROUND_ZERO) && defined(SINGLE_PLAYER)
-		|| ((targ.svflags & SVF_MONSTER) && targ.monsterinfo.invincible_time > level.time)
+		|| ((targ.svflags & SVF_MONSTER) && std::as_const(targ.monsterinfo)->invincible_time > level.time)
 #endif
 		)
 	{
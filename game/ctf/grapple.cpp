@@ -222,7 +222,7 @@ static void CTFFireGrapple(entity &self, vector start, vector dir, int damage, i
 	grapple.origin = grapple.old_origin = start;
 	grapple.angles = vectoangles(dir);
 	grapple.velocity = dir * speed;
-	grapple.movetype = MOVETYPE_FLYMISSILE;
+	grapple.set_movetype(MOVETYPE_FLYMISSILE);
 	grapple.clipmask = MASK_SHOT;
 	grapple.solid = SOLID_BBOX;
 	grapple.count = offhand;
@@ -330,7 +330,7 @@ void GrappleCmd(entity &ent)
 
 	if (cmd == "fire")
 	{
-		if (ent.health && ent.movetype != MOVETYPE_NOCLIP)
+		if (ent.health && ent.get_movetype() != MOVETYPE_NOCLIP)
 			CTFGrappleFire(ent, 10, true);
 	}
 	else if (cmd == "release")
@@ -3,11 +3,13 @@
 #include "config.h"
 #include "lib/protocol.h"
 #include "lib/string.h"
+#include "lib/string/atom.h"
 #include "game/items/itemlist.h"
 #include "lib/types.h"
 #include "lib/math/vector.h"
 #include "savables.h"
 #include "lib/types/enum.h"
+#include "lib/types/pool.h"
 #include "entity_types.h"
 #include "game_types.h"
 
@@ -284,6 +286,11 @@ struct monsterinfo
 
 	gtime		surprise_time;
 
+	// idling on a slow tick until a client can see us; see M_Wake
+	bool		dormant;
+	// when the next slow tick runs while dormant
+	gtime		dormant_tick_time;
+
 #ifdef ROGUE_AI
 	savable<mblockedfunc> blocked;
 	gtime		last_hint_time;		// last time the monster checked for hintpaths.
@@ -366,48 +373,78 @@ private:
 	void __free();
 
 public:
-	move_type	movetype;
+	// everything that RunFrame and the physics code touch on every entity
+	// every frame comes first, so that it shares as few cache lines as
+	// possible; big blocks that most entities never use are pooled.
+private:
+	// whether RunFrame can skip the entity depends on these (game/think.h),
+	// so they can only be changed through set_movetype and set_prethink
+	move_type		movetype;
 
+public:
 	entity_flags	flags;
+	content_flags	watertype;
+	water_level		waterlevel;
+	float			gravity;
+	int32_t			groundentity_linkcount;
+	entityref		groundentity;
+	entityref		teamchain;
+	vector			velocity;
+	vector			avelocity;
+
+private:
+	savable<ethinkfunc>	prethink;
+
+public:
+	savable<ethinkfunc>	think;
+	savable<blockedfunc>	blocked;
 
 	string	model;
 	gtime	freeframenum;
 
 	string		message;
+	// indexed; only change this through G_SetType
 	entity_type_ref	type;
 	spawn_flag	spawnflags;
 
 	gtime		timestamp;
 	float		angle;
-	string		target;
-	string		targetname;
-	string		killtarget;
-	string		team;
-	string		pathtarget;
-	string		deathtarget;
-	string		combattarget;
+	atom		target;
+	// indexed; only change this through G_SetTargetname
+	atom		targetname;
+	atom		killtarget;
+	atom		team;
+	atom		pathtarget;
+	atom		deathtarget;
+	atom		combattarget;
 	entityref	target_ent;
 
 	float	speed, accel, decel;
 	vector	movedir;
 	vector	pos1, pos2;
 
-	vector	velocity;
-	vector	avelocity;
 	int32_t	mass;
 	gtime	air_finished_time;
-	float	gravity;
 
 	entityref	goalentity;
 	entityref	movetarget;
 	float		yaw_speed;
 	float		ideal_yaw;
 
+private:
+	// scheduled in the think wheel (game/think.h) whenever it's set
 	gtime		nextthink;
-	savable<ethinkfunc>	prethink;
-	savable<ethinkfunc>	think;
 
-	savable<blockedfunc>	blocked;
+public:
+	void set_nextthink(gtime time);
+	constexpr gtime get_nextthink() const { return nextthink; }
+
+	void set_movetype(move_type type);
+	constexpr move_type get_movetype() const { return movetype; }
+
+	void set_prethink(savable<ethinkfunc> func);
+	constexpr savable<ethinkfunc> get_prethink() const { return prethink; }
+
 	savable<touchfunc>		touch;
 	savable<usefunc>		use;
 	savable<painfunc>		pain;
@@ -443,9 +480,6 @@ public:
 	entityref	enemy;
 	entityref	oldenemy;
 	entityref	activator;
-	entityref	groundentity;
-	int32_t		groundentity_linkcount;
-	entityref	teamchain;
 	entityref	teammaster;
 
 	entityref	mynoise;
@@ -462,9 +496,6 @@ public:
 
 	gtime	last_sound_time;
 
-	content_flags	watertype;
-	water_level		waterlevel;
-
 	vector	move_origin;
 	vector	move_angles;
 
@@ -484,10 +515,10 @@ public:
 	size_t		hint_chain_id;
 #endif
 
-	moveinfo moveinfo;
+	pooled<moveinfo> moveinfo;
 
 #ifdef SINGLE_PLAYER
-	monsterinfo monsterinfo;
+	pooled<monsterinfo> monsterinfo;
 	uint8_t power_cube_id;
 #endif
 
@@ -0,0 +1,124 @@
+#include "config.h"
+#include "lib/gi.h"
+#include "lib/string/format.h"
+#include "game.h"
+#include "entity.h"
+#include "util.h"
+#include "framehash.h"
+
+static cvarref g_framehash;
+static cvarref g_framehash_entities;
+
+static std::ofstream framehash_log;
+
+// 64-bit FNV-1a over the raw bytes of whatever is added, so that
+// floats only match if they are the same down to the last bit
+class frame_hasher
+{
+	uint64_t	hash = 14695981039346656037ull;
+
+	inline void add_bytes(const void *data, size_t length)
+	{
+		for (const uint8_t *p = (const uint8_t *) data, *end = p + length; p != end; p++)
+			hash = (hash ^ *p) * 1099511628211ull;
+	}
+
+public:
+	template<typename T> requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+	inline void add(const T &v) { add_bytes(&v, sizeof(v)); }
+
+	inline void add(const vector &v) { add(v.x); add(v.y); add(v.z); }
+
+	template<typename rep, typename period>
+	inline void add(const std::chrono::duration<rep, period> &d) { add(d.count()); }
+
+	// the terminator goes in too, so that "ab" + "c" and "a" + "bc" differ
+	inline void add(stringlit s) { add_bytes(s, strlen(s) + 1); }
+
+	// callbacks go in by name, which stays the same between builds
+	template<typename T>
+	inline void add_savable(const T &s)
+	{
+#ifdef SAVING
+		add(s ? s.registry->name : "");
+#else
+		add((bool) s);
+#endif
+	}
+
+	inline uint64_t value() const { return hash; }
+};
+
+static uint64_t G_HashEntity(const entity &ent)
+{
+	frame_hasher h;
+
+	h.add(ent.number);
+	h.add(ent.type->id ? ent.type->id : "");
+	h.add(ent.origin);
+	h.add(ent.velocity);
+	h.add(ent.frame);
+	h.add(ent.health);
+	h.add(ent.get_movetype());
+	h.add(ent.get_nextthink());
+	h.add_savable(ent.get_prethink());
+	h.add_savable(ent.think);
+	h.add_savable(ent.blocked);
+	h.add_savable(ent.touch);
+	h.add_savable(ent.use);
+	h.add_savable(ent.pain);
+	h.add_savable(ent.die);
+#ifdef SINGLE_PLAYER
+	h.add_savable(ent.monsterinfo->currentmove);
+#endif
+
+	return h.value();
+}
+
+void G_FrameHashInit()
+{
+	g_framehash = gi.cvar("g_framehash", "", CVAR_NONE);
+	g_framehash_entities = gi.cvar("g_framehash_entities", "0", CVAR_NONE);
+}
+
+void G_FrameHashEndFrame()
+{
+	if (g_framehash.modified)
+	{
+		// fetch it again; the string we have is stale
+		g_framehash = gi.cvar("g_framehash", "", CVAR_NONE);
+		g_framehash.modified = false;
+
+		if (framehash_log.is_open())
+			framehash_log.close();
+
+		if (g_framehash)
+		{
+			framehash_log.open(g_framehash.string, std::ios::out | std::ios::trunc);
+
+			if (!framehash_log.is_open())
+				gi.dprintfmt("Couldn't open {} for writing\n", g_framehash.string);
+		}
+	}
+
+	if (!framehash_log.is_open())
+		return;
+
+	const bool log_entities = !!g_framehash_entities;
+	mutable_string entity_lines;
+	frame_hasher frame;
+	uint32_t count = 0;
+
+	for (const entity &ent : G_IterateLive())
+	{
+		const uint64_t hash = G_HashEntity(ent);
+
+		frame.add(hash);
+		count++;
+
+		if (log_entities)
+			format_to(entity_lines, "\t{} {:016x} {}\n", ent.number, hash, ent.type->id ? ent.type->id : "-");
+	}
+
+	framehash_log << format("{} {} {:016x}\n", level.time.count(), count, frame.value()) << entity_lines;
+}
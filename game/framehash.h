@@ -0,0 +1,37 @@
+#pragma once
+
+#include "config.h"
+
+/*
+==============================================================================
+
+FRAME HASHING
+
+==============================================================================
+
+Proves that a change doesn't change gameplay. With g_framehash set to a
+file name, the state of every live entity is hashed at the end of each
+RunFrame and written to that file, one line per frame:
+
+	<level time> <live entities> <hash>
+
+With g_framehash_entities set, each frame line is followed by a line for
+every entity that went into it, so that a mismatch can be tracked down:
+
+	<tab><number> <hash> <type>
+
+Two logs are compared with "bench -check <a> <b>", which reports the first
+frame (and entity) where they part ways. Runs are only comparable if they
+get the same input and the same random numbers; set g_seed to the same
+non-zero value for both.
+
+An entity's hash covers its number, type, origin, velocity, frame, health,
+movetype, nextthink and the savable names of its callbacks and current
+monster move.
+*/
+
+// register the cvars; called from InitGame
+void G_FrameHashInit();
+
+// hash the frame that just finished and log it, if g_framehash is set
+void G_FrameHashEndFrame();
@@ -63,39 +63,39 @@ constexpr spawn_flag DOOR_INACTIVE		= (spawn_flag)8192;
 static void Move_Done(entity &ent)
 {
 	ent.velocity = vec3_origin;
-	ent.moveinfo.endfunc(ent);
+	ent.moveinfo->endfunc(ent);
 }
 
 REGISTER_STATIC_SAVABLE(Move_Done);
 
 static void Move_Final(entity &ent)
 {
-	if (ent.moveinfo.remaining_distance == 0)
+	if (ent.moveinfo->remaining_distance == 0)
 	{
 		Move_Done(ent);
 		return;
 	}
 
-	ent.velocity = ent.moveinfo.dir * (ent.moveinfo.remaining_distance / FRAMETIME.count());
+	ent.velocity = ent.moveinfo->dir * (ent.moveinfo->remaining_distance / FRAMETIME.count());
 
 	ent.think = SAVABLE(Move_Done);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(Move_Final);
 
 static void Move_Begin(entity &ent)
 {
-	if ((ent.moveinfo.speed * FRAMETIME.count()) >= ent.moveinfo.remaining_distance)
+	if ((ent.moveinfo->speed * FRAMETIME.count()) >= ent.moveinfo->remaining_distance)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	ent.velocity = ent.moveinfo.dir * ent.moveinfo.speed;
-	float num_frames = floor((ent.moveinfo.remaining_distance / ent.moveinfo.speed) / FRAMETIME.count());
-	ent.moveinfo.remaining_distance -= num_frames * ent.moveinfo.speed * FRAMETIME.count();
-	ent.nextthink = level.time + frames((int32_t) num_frames);
+	ent.velocity = ent.moveinfo->dir * ent.moveinfo->speed;
+	float num_frames = floor((ent.moveinfo->remaining_distance / ent.moveinfo->speed) / FRAMETIME.count());
+	ent.moveinfo->remaining_distance -= num_frames * ent.moveinfo->speed * FRAMETIME.count();
+	ent.set_nextthink(level.time + frames((int32_t) num_frames));
 	ent.think = SAVABLE(Move_Final);
 }
 
@@ -110,17 +110,17 @@ static void plat_CalcAcceleratedMove(entity &ent);
 void Move_Calc(entity &ent, vector dest, savable<ethinkfunc> func)
 {
 	ent.velocity = vec3_origin;
-	ent.moveinfo.dir = dest - ent.origin;
-	ent.moveinfo.remaining_distance = VectorNormalize(ent.moveinfo.dir);
-	ent.moveinfo.endfunc = func;
+	ent.moveinfo->dir = dest - ent.origin;
+	ent.moveinfo->remaining_distance = VectorNormalize(ent.moveinfo->dir);
+	ent.moveinfo->endfunc = func;
 
-	if (ent.moveinfo.speed == ent.moveinfo.accel && ent.moveinfo.speed == ent.moveinfo.decel)
+	if (ent.moveinfo->speed == ent.moveinfo->accel && ent.moveinfo->speed == ent.moveinfo->decel)
 	{
 		if (level.current_entity == ((ent.flags & FL_TEAMSLAVE) ? (entity &)ent.teammaster : ent))
 			Move_Begin(ent);
 		else
 		{
-			ent.nextthink = level.time + 1_hz;
+			ent.set_nextthink(level.time + 1_hz);
 			ent.think = SAVABLE(Move_Begin);
 		}
 	}
@@ -129,9 +129,9 @@ void Move_Calc(entity &ent, vector dest, savable<ethinkfunc> func)
 		// accelerative
 		plat_CalcAcceleratedMove(ent);
 		
-		ent.moveinfo.current_speed = 0;
+		ent.moveinfo->current_speed = 0;
 		ent.think = SAVABLE(Think_AccelMove);
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 	}
 }
 
@@ -142,7 +142,7 @@ void Move_Calc(entity &ent, vector dest, savable<ethinkfunc> func)
 static void AngleMove_Done(entity &ent)
 {
 	ent.avelocity = vec3_origin;
-	ent.moveinfo.endfunc(ent);
+	ent.moveinfo->endfunc(ent);
 }
 
 REGISTER_STATIC_SAVABLE(AngleMove_Done);
@@ -151,10 +151,10 @@ static void AngleMove_Final(entity &ent)
 {
 	vector	move;
 
-	if (ent.moveinfo.state == STATE_UP)
-		move = ent.moveinfo.end_angles - ent.angles;
+	if (ent.moveinfo->state == STATE_UP)
+		move = ent.moveinfo->end_angles - ent.angles;
 	else
-		move = ent.moveinfo.start_angles - ent.angles;
+		move = ent.moveinfo->start_angles - ent.angles;
 
 	if (!move)
 	{
@@ -165,7 +165,7 @@ static void AngleMove_Final(entity &ent)
 	ent.avelocity = move * BASE_FRAMERATE;
 
 	ent.think = SAVABLE(AngleMove_Done);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(AngleMove_Final);
@@ -182,25 +182,25 @@ static void AngleMove_Begin(entity &ent)
 
 #ifdef GROUND_ZERO
 	// accelerate as needed
-	if (ent.moveinfo.speed < ent.speed)
+	if (ent.moveinfo->speed < ent.speed)
 	{
-		ent.moveinfo.speed += ent.accel;
-		if(ent.moveinfo.speed > ent.speed)
-			ent.moveinfo.speed = ent.speed;
+		ent.moveinfo->speed += ent.accel;
+		if(ent.moveinfo->speed > ent.speed)
+			ent.moveinfo->speed = ent.speed;
 	}
 #endif
 
 	// set destdelta to the vector needed to move
-	if (ent.moveinfo.state == STATE_UP)
-		destdelta = ent.moveinfo.end_angles - ent.angles;
+	if (ent.moveinfo->state == STATE_UP)
+		destdelta = ent.moveinfo->end_angles - ent.angles;
 	else
-		destdelta = ent.moveinfo.start_angles - ent.angles;
+		destdelta = ent.moveinfo->start_angles - ent.angles;
 
 	// calculate length of vector
 	len = VectorLength(destdelta);
 
 	// divide by speed to get time to reach dest
-	traveltime = len / ent.moveinfo.speed;
+	traveltime = len / ent.moveinfo->speed;
 
 	if (traveltime < FRAMETIME.count())
 	{
@@ -213,17 +213,17 @@ static void AngleMove_Begin(entity &ent)
 
 #ifdef GROUND_ZERO
 	// if we're done accelerating, act as a normal rotation
-	if (ent.moveinfo.speed >= ent.speed)
+	if (ent.moveinfo->speed >= ent.speed)
 	{
 #endif
 		// set nextthink to trigger a think when dest is reached
-		ent.nextthink = level.time + frames((int32_t) floor(traveltime / FRAMETIME.count()));
+		ent.set_nextthink(level.time + frames((int32_t) floor(traveltime / FRAMETIME.count())));
 		ent.think = SAVABLE(AngleMove_Final);
 #ifdef GROUND_ZERO
 	}
 	else
 	{
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 		ent.think = SAVABLE(AngleMove_Begin);
 	}
 #endif
@@ -232,19 +232,19 @@ static void AngleMove_Begin(entity &ent)
 static void AngleMove_Calc(entity &ent, savable<ethinkfunc> func)
 {
 	ent.avelocity = vec3_origin;
-	ent.moveinfo.endfunc = func;
+	ent.moveinfo->endfunc = func;
 	
 #ifdef GROUND_ZERO
 	// if we're supposed to accelerate, this will tell anglemove_begin to do so
 	if(ent.accel != ent.speed)
-		ent.moveinfo.speed = 0;
+		ent.moveinfo->speed = 0;
 #endif
 	
 	if (level.current_entity == ((ent.flags & FL_TEAMSLAVE) ? (entity &)ent.teammaster : ent))
 		AngleMove_Begin(ent);
 	else
 	{
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 		ent.think = SAVABLE(AngleMove_Begin);
 	}
 }
@@ -262,81 +262,81 @@ constexpr float AccelerationDistance(float target, float rate) { return (target
 
 static void plat_CalcAcceleratedMove(entity &ent)
 {
-	ent.moveinfo.move_speed = ent.moveinfo.speed;
+	ent.moveinfo->move_speed = ent.moveinfo->speed;
 
-	if (ent.moveinfo.remaining_distance < ent.moveinfo.accel)
+	if (ent.moveinfo->remaining_distance < ent.moveinfo->accel)
 	{
-		ent.moveinfo.current_speed = ent.moveinfo.remaining_distance;
+		ent.moveinfo->current_speed = ent.moveinfo->remaining_distance;
 		return;
 	}
 
-	float accel_dist = AccelerationDistance(ent.moveinfo.speed, ent.moveinfo.accel);
-	float decel_dist = AccelerationDistance(ent.moveinfo.speed, ent.moveinfo.decel);
+	float accel_dist = AccelerationDistance(ent.moveinfo->speed, ent.moveinfo->accel);
+	float decel_dist = AccelerationDistance(ent.moveinfo->speed, ent.moveinfo->decel);
 
-	if ((ent.moveinfo.remaining_distance - accel_dist - decel_dist) < 0)
+	if ((ent.moveinfo->remaining_distance - accel_dist - decel_dist) < 0)
 	{
-		float f = (ent.moveinfo.accel + ent.moveinfo.decel) / (ent.moveinfo.accel * ent.moveinfo.decel);
-		ent.moveinfo.move_speed = (-2 + sqrt(4 - 4 * f * (-2 * ent.moveinfo.remaining_distance))) / (2 * f);
-		decel_dist = AccelerationDistance(ent.moveinfo.move_speed, ent.moveinfo.decel);
+		float f = (ent.moveinfo->accel + ent.moveinfo->decel) / (ent.moveinfo->accel * ent.moveinfo->decel);
+		ent.moveinfo->move_speed = (-2 + sqrt(4 - 4 * f * (-2 * ent.moveinfo->remaining_distance))) / (2 * f);
+		decel_dist = AccelerationDistance(ent.moveinfo->move_speed, ent.moveinfo->decel);
 	}
 
-	ent.moveinfo.decel_distance = decel_dist;
+	ent.moveinfo->decel_distance = decel_dist;
 }
 
 static void plat_Accelerate(entity &ent)
 {
 	// are we decelerating?
-	if (ent.moveinfo.remaining_distance <= ent.moveinfo.decel_distance)
+	if (ent.moveinfo->remaining_distance <= ent.moveinfo->decel_distance)
 	{
-		if (ent.moveinfo.remaining_distance < ent.moveinfo.decel_distance)
+		if (ent.moveinfo->remaining_distance < ent.moveinfo->decel_distance)
 		{
-			if (ent.moveinfo.next_speed)
+			if (ent.moveinfo->next_speed)
 			{
-				ent.moveinfo.current_speed = ent.moveinfo.next_speed;
-				ent.moveinfo.next_speed = 0;
+				ent.moveinfo->current_speed = ent.moveinfo->next_speed;
+				ent.moveinfo->next_speed = 0;
 				return;
 			}
-			if (ent.moveinfo.current_speed > ent.moveinfo.decel)
-				ent.moveinfo.current_speed -= ent.moveinfo.decel;
+			if (ent.moveinfo->current_speed > ent.moveinfo->decel)
+				ent.moveinfo->current_speed -= ent.moveinfo->decel;
 		}
 		return;
 	}
 
 	// are we at full speed and need to start decelerating during this move?
-	if (ent.moveinfo.current_speed == ent.moveinfo.move_speed)
-		if ((ent.moveinfo.remaining_distance - ent.moveinfo.current_speed) < ent.moveinfo.decel_distance)
+	if (ent.moveinfo->current_speed == ent.moveinfo->move_speed)
+		if ((ent.moveinfo->remaining_distance - ent.moveinfo->current_speed) < ent.moveinfo->decel_distance)
 		{
-			float p1_distance = ent.moveinfo.remaining_distance - ent.moveinfo.decel_distance;
-			float p2_distance = ent.moveinfo.move_speed * (1.0f - (p1_distance / ent.moveinfo.move_speed));
+			float p1_distance = ent.moveinfo->remaining_distance - ent.moveinfo->decel_distance;
+			float p2_distance = ent.moveinfo->move_speed * (1.0f - (p1_distance / ent.moveinfo->move_speed));
 			float distance = p1_distance + p2_distance;
-			ent.moveinfo.current_speed = ent.moveinfo.move_speed;
-			ent.moveinfo.next_speed = ent.moveinfo.move_speed - ent.moveinfo.decel * (p2_distance / distance);
+			ent.moveinfo->current_speed = ent.moveinfo->move_speed;
+			ent.moveinfo->next_speed = ent.moveinfo->move_speed - ent.moveinfo->decel * (p2_distance / distance);
 			return;
 		}
 
 	// are we accelerating?
-	if (ent.moveinfo.current_speed < ent.moveinfo.speed)
+	if (ent.moveinfo->current_speed < ent.moveinfo->speed)
 	{
-		float old_speed = ent.moveinfo.current_speed;
+		float old_speed = ent.moveinfo->current_speed;
 
 		// figure simple acceleration up to move_speed
-		ent.moveinfo.current_speed += ent.moveinfo.accel;
-		if (ent.moveinfo.current_speed > ent.moveinfo.speed)
-			ent.moveinfo.current_speed = ent.moveinfo.speed;
+		ent.moveinfo->current_speed += ent.moveinfo->accel;
+		if (ent.moveinfo->current_speed > ent.moveinfo->speed)
+			ent.moveinfo->current_speed = ent.moveinfo->speed;
 
 		// are we accelerating throughout this entire move?
-		if ((ent.moveinfo.remaining_distance - ent.moveinfo.current_speed) >= ent.moveinfo.decel_distance)
+		if ((ent.moveinfo->remaining_distance - ent.moveinfo->current_speed) >= ent.moveinfo->decel_distance)
 			return;
 
 		// during this move we will accelrate from current_speed to move_speed
 		// and cross over the decel_distance; figure the average speed for the
 		// entire move
-		float p1_distance = ent.moveinfo.remaining_distance - ent.moveinfo.decel_distance;
-		float p1_speed = (old_speed + ent.moveinfo.move_speed) / 2.0f;
-		float p2_distance = ent.moveinfo.move_speed * (1.0f - (p1_distance / p1_speed));
+		float p1_distance = ent.moveinfo->remaining_distance - ent.moveinfo->decel_distance;
+		float p1_speed = (old_speed + ent.moveinfo->move_speed) / 2.0f;
+		float p2_distance = ent.moveinfo->move_speed * (1.0f - (p1_distance / p1_speed));
 		float distance = p1_distance + p2_distance;
-		ent.moveinfo.current_speed = (p1_speed * (p1_distance / distance)) + (ent.moveinfo.move_speed * (p2_distance / distance));
-		ent.moveinfo.next_speed = ent.moveinfo.move_speed - ent.moveinfo.decel * (p2_distance / distance);
+		ent.moveinfo->current_speed = (p1_speed * (p1_distance / distance)) + (ent.moveinfo->move_speed * (p2_distance / distance));
+		ent.moveinfo->next_speed = ent.moveinfo->move_speed - ent.moveinfo->decel * (p2_distance / distance);
 		return;
 	}
 
@@ -345,19 +345,19 @@ static void plat_Accelerate(entity &ent)
 
 static void Think_AccelMove(entity &ent)
 {
-	ent.moveinfo.remaining_distance -= ent.moveinfo.current_speed;
+	ent.moveinfo->remaining_distance -= ent.moveinfo->current_speed;
 
 	plat_Accelerate(ent);
 
 	// will the entire move complete on next frame?
-	if (ent.moveinfo.remaining_distance <= ent.moveinfo.current_speed)
+	if (ent.moveinfo->remaining_distance <= ent.moveinfo->current_speed)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	ent.velocity = ent.moveinfo.dir * (ent.moveinfo.current_speed * 10);
-	ent.nextthink = level.time + 1_hz;
+	ent.velocity = ent.moveinfo->dir * (ent.moveinfo->current_speed * 10);
+	ent.set_nextthink(level.time + 1_hz);
 	ent.think = SAVABLE(Think_AccelMove);
 }
 
@@ -369,14 +369,14 @@ static void plat_hit_top(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_end)
-			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo.sound_end, ATTN_STATIC);
+		if (ent.moveinfo->sound_end)
+			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo->sound_end, ATTN_STATIC);
 		ent.sound = SOUND_NONE;
 	}
-	ent.moveinfo.state = STATE_TOP;
+	ent.moveinfo->state = STATE_TOP;
 
 	ent.think = SAVABLE(plat_go_down);
-	ent.nextthink = level.time + 3s;
+	ent.set_nextthink(level.time + 3s);
 }
 
 REGISTER_STATIC_SAVABLE(plat_hit_top);
@@ -391,11 +391,11 @@ static void plat_hit_bottom(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_end)
-			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo.sound_end, ATTN_STATIC);
+		if (ent.moveinfo->sound_end)
+			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo->sound_end, ATTN_STATIC);
 		ent.sound = SOUND_NONE;
 	}
-	ent.moveinfo.state = STATE_BOTTOM;
+	ent.moveinfo->state = STATE_BOTTOM;
 #if defined(GROUND_ZERO) && defined(SINGLE_PLAYER)
 
 	//plat2_kill_danger_area (ent);
@@ -408,12 +408,12 @@ static void plat_go_down(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_start)
-			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo.sound_start, ATTN_STATIC);
-		ent.sound = ent.moveinfo.sound_middle;
+		if (ent.moveinfo->sound_start)
+			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo->sound_start, ATTN_STATIC);
+		ent.sound = ent.moveinfo->sound_middle;
 	}
-	ent.moveinfo.state = STATE_DOWN;
-	Move_Calc(ent, ent.moveinfo.end_origin, SAVABLE(plat_hit_bottom));
+	ent.moveinfo->state = STATE_DOWN;
+	Move_Calc(ent, ent.moveinfo->end_origin, SAVABLE(plat_hit_bottom));
 #if defined(GROUND_ZERO) && defined(SINGLE_PLAYER)
 
 	//plat2_spawn_danger_area(ent);
@@ -424,12 +424,12 @@ static void plat_go_up(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_start)
-			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo.sound_start, ATTN_STATIC);
-		ent.sound = ent.moveinfo.sound_middle;
+		if (ent.moveinfo->sound_start)
+			gi.sound(ent, CHAN_VOICE | CHAN_NO_PHS_ADD, ent.moveinfo->sound_start, ATTN_STATIC);
+		ent.sound = ent.moveinfo->sound_middle;
 	}
-	ent.moveinfo.state = STATE_UP;
-	Move_Calc(ent, ent.moveinfo.start_origin, SAVABLE(plat_hit_top));
+	ent.moveinfo->state = STATE_UP;
+	Move_Calc(ent, ent.moveinfo->start_origin, SAVABLE(plat_hit_top));
 }
 
 static void plat_blocked(entity &self, entity &other)
@@ -452,9 +452,9 @@ static void plat_blocked(entity &self, entity &other)
 
 	T_Damage(other, self, self, vec3_origin, other.origin, vec3_origin, self.dmg, 1, { DAMAGE_NONE }, MOD_CRUSH);
 
-	if (self.moveinfo.state == STATE_UP)
+	if (self.moveinfo->state == STATE_UP)
 		plat_go_down(self);
-	else if (self.moveinfo.state == STATE_DOWN)
+	else if (self.moveinfo->state == STATE_DOWN)
 		plat_go_up(self);
 }
 
@@ -466,9 +466,9 @@ void Use_Plat(entity &ent, entity &other [[maybe_unused]], entity &)
 	// if a monster is using us, then allow the activity when stopped.
 	if (other.svflags & SVF_MONSTER)
 	{
-		if (ent.moveinfo.state == STATE_TOP)
+		if (ent.moveinfo->state == STATE_TOP)
 			plat_go_down (ent);
-		else if (ent.moveinfo.state == STATE_BOTTOM)
+		else if (ent.moveinfo->state == STATE_BOTTOM)
 			plat_go_up (ent);
 
 		return;
@@ -492,10 +492,10 @@ static void Touch_Plat_Center(entity &ent, entity &other, vector, const surface
 
 	entity &plat = ent.enemy;   // now point at the plat, not the trigger
 
-	if (plat.moveinfo.state == STATE_BOTTOM)
+	if (plat.moveinfo->state == STATE_BOTTOM)
 		plat_go_up(plat);
-	else if (plat.moveinfo.state == STATE_TOP)
-		plat.nextthink = level.time + 1s;   // the player is still on the plat, so delay going down
+	else if (plat.moveinfo->state == STATE_TOP)
+		plat.set_nextthink(level.time + 1s);   // the player is still on the plat, so delay going down
 }
 
 REGISTER_STATIC_SAVABLE(Touch_Plat_Center);
@@ -507,7 +507,7 @@ entity &plat_spawn_inside_trigger(entity &ent)
 //
 	entity &trigger = G_Spawn();
 	trigger.touch = SAVABLE(Touch_Plat_Center);
-	trigger.movetype = MOVETYPE_NONE;
+	trigger.set_movetype(MOVETYPE_NONE);
 	trigger.solid = SOLID_TRIGGER;
 	trigger.enemy = ent;
 
@@ -564,7 +564,7 @@ static void SP_func_plat(entity &ent)
 {
 	ent.angles = vec3_origin;
 	ent.solid = SOLID_BSP;
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 
 	gi.setmodel(ent, ent.model);
 
@@ -599,31 +599,32 @@ static void SP_func_plat(entity &ent)
 	else
 		ent.pos2.z -= (ent.bounds.maxs.z - ent.bounds.mins.z) - st.lip;
 
+	ent.moveinfo.emplace();
 	ent.use = SAVABLE(Use_Plat);
 
 	plat_spawn_inside_trigger(ent);     // the "start moving" trigger
 
 	if (ent.targetname)
-		ent.moveinfo.state = STATE_UP;
+		ent.moveinfo->state = STATE_UP;
 	else
 	{
 		ent.origin = ent.pos2;
 		gi.linkentity(ent);
-		ent.moveinfo.state = STATE_BOTTOM;
+		ent.moveinfo->state = STATE_BOTTOM;
 	}
 
-	ent.moveinfo.speed = ent.speed;
-	ent.moveinfo.accel = ent.accel;
-	ent.moveinfo.decel = ent.decel;
-	ent.moveinfo.wait = ent.wait;
-	ent.moveinfo.start_origin = ent.pos1;
-	ent.moveinfo.start_angles = ent.angles;
-	ent.moveinfo.end_origin = ent.pos2;
-	ent.moveinfo.end_angles = ent.angles;
+	ent.moveinfo->speed = ent.speed;
+	ent.moveinfo->accel = ent.accel;
+	ent.moveinfo->decel = ent.decel;
+	ent.moveinfo->wait = ent.wait;
+	ent.moveinfo->start_origin = ent.pos1;
+	ent.moveinfo->start_angles = ent.angles;
+	ent.moveinfo->end_origin = ent.pos2;
+	ent.moveinfo->end_angles = ent.angles;
 
-	ent.moveinfo.sound_start = gi.soundindex("plats/pt1_strt.wav");
-	ent.moveinfo.sound_middle = gi.soundindex("plats/pt1_mid.wav");
-	ent.moveinfo.sound_end = gi.soundindex("plats/pt1_end.wav");
+	ent.moveinfo->sound_start = gi.soundindex("plats/pt1_strt.wav");
+	ent.moveinfo->sound_middle = gi.soundindex("plats/pt1_mid.wav");
+	ent.moveinfo->sound_end = gi.soundindex("plats/pt1_end.wav");
 }
 
 REGISTER_ENTITY(FUNC_PLAT, func_plat);
@@ -670,7 +671,7 @@ static void rotating_accel(entity &self)
 		current_speed += self.accel;
 		self.avelocity = self.movedir * current_speed;
 		self.think = SAVABLE(rotating_accel);
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	}
 }
 static void rotating_decel(entity &self);
@@ -693,7 +694,7 @@ static void rotating_decel(entity &self)
 		current_speed -= self.decel;
 		self.avelocity = self.movedir * current_speed;
 		self.think = SAVABLE(rotating_decel);
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	}
 }
 #endif
@@ -733,7 +734,7 @@ static void rotating_use(entity &self, entity &, entity &)
 	}
 	else
 	{
-		self.sound = self.moveinfo.sound_middle;
+		self.sound = self.moveinfo->sound_middle;
 
 #ifdef GROUND_ZERO
 		if(self.spawnflags & DOOR_INACTIVE)	// accelerate
@@ -757,9 +758,9 @@ static void SP_func_rotating(entity &ent)
 {
 	ent.solid = SOLID_BSP;
 	if (ent.spawnflags & ROTATING_STOP)
-		ent.movetype = MOVETYPE_STOP;
+		ent.set_movetype(MOVETYPE_STOP);
 	else
-		ent.movetype = MOVETYPE_PUSH;
+		ent.set_movetype(MOVETYPE_PUSH);
 
 	// set the axis of rotation
 	ent.movedir = vec3_origin;
@@ -839,7 +840,7 @@ When a button is touched, it moves some distance in the direction of it's angle,
 
 static void button_done(entity &self)
 {
-	self.moveinfo.state = STATE_BOTTOM;
+	self.moveinfo->state = STATE_BOTTOM;
 	self.effects &= ~EF_ANIM23;
 	self.effects |= EF_ANIM01;
 }
@@ -848,9 +849,9 @@ REGISTER_STATIC_SAVABLE(button_done);
 
 static void button_return(entity &self)
 {
-	self.moveinfo.state = STATE_DOWN;
+	self.moveinfo->state = STATE_DOWN;
 
-	Move_Calc(self, self.moveinfo.start_origin, SAVABLE(button_done));
+	Move_Calc(self, self.moveinfo->start_origin, SAVABLE(button_done));
 
 	self.frame = 0;
 
@@ -862,15 +863,15 @@ REGISTER_STATIC_SAVABLE(button_return);
 
 static void button_wait(entity &self)
 {
-	self.moveinfo.state = STATE_TOP;
+	self.moveinfo->state = STATE_TOP;
 	self.effects &= ~EF_ANIM01;
 	self.effects |= EF_ANIM23;
 
 	G_UseTargets(self, self.activator);
 	self.frame = 1;
-	if (self.moveinfo.wait >= gtimef::zero())
+	if (self.moveinfo->wait >= gtimef::zero())
 	{
-		self.nextthink = duration_cast<gtime>(level.time + self.moveinfo.wait);
+		self.set_nextthink(duration_cast<gtime>(level.time + self.moveinfo->wait));
 		self.think = SAVABLE(button_return);
 	}
 }
@@ -879,13 +880,13 @@ REGISTER_STATIC_SAVABLE(button_wait);
 
 static void button_fire(entity &self)
 {
-	if (self.moveinfo.state == STATE_UP || self.moveinfo.state == STATE_TOP)
+	if (self.moveinfo->state == STATE_UP || self.moveinfo->state == STATE_TOP)
 		return;
 
-	self.moveinfo.state = STATE_UP;
-	if (self.moveinfo.sound_start && !(self.flags & FL_TEAMSLAVE))
-		gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_start, ATTN_STATIC);
-	Move_Calc(self, self.moveinfo.end_origin, SAVABLE(button_wait));
+	self.moveinfo->state = STATE_UP;
+	if (self.moveinfo->sound_start && !(self.flags & FL_TEAMSLAVE))
+		gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_start, ATTN_STATIC);
+	Move_Calc(self, self.moveinfo->end_origin, SAVABLE(button_wait));
 }
 
 static void button_use(entity &self, entity &, entity &cactivator)
@@ -923,12 +924,13 @@ REGISTER_STATIC_SAVABLE(button_killed);
 static void SP_func_button(entity &ent)
 {
 	G_SetMovedir(ent.angles, ent.movedir);
-	ent.movetype = MOVETYPE_STOP;
+	ent.set_movetype(MOVETYPE_STOP);
 	ent.solid = SOLID_BSP;
 	gi.setmodel(ent, ent.model);
+	ent.moveinfo.emplace();
 
 	if (ent.sounds != 1)
-		ent.moveinfo.sound_start = gi.soundindex("switches/butn2.wav");
+		ent.moveinfo->sound_start = gi.soundindex("switches/butn2.wav");
 
 	if (!ent.speed)
 		ent.speed = 40.f;
@@ -962,16 +964,16 @@ static void SP_func_button(entity &ent)
 	else if (!ent.targetname)
 		ent.touch = SAVABLE(button_touch);
 
-	ent.moveinfo.state = STATE_BOTTOM;
+	ent.moveinfo->state = STATE_BOTTOM;
 
-	ent.moveinfo.speed = ent.speed;
-	ent.moveinfo.accel = ent.accel;
-	ent.moveinfo.decel = ent.decel;
-	ent.moveinfo.wait = ent.wait;
-	ent.moveinfo.start_origin = ent.pos1;
-	ent.moveinfo.start_angles = ent.angles;
-	ent.moveinfo.end_origin = ent.pos2;
-	ent.moveinfo.end_angles = ent.angles;
+	ent.moveinfo->speed = ent.speed;
+	ent.moveinfo->accel = ent.accel;
+	ent.moveinfo->decel = ent.decel;
+	ent.moveinfo->wait = ent.wait;
+	ent.moveinfo->start_origin = ent.pos1;
+	ent.moveinfo->start_angles = ent.angles;
+	ent.moveinfo->end_origin = ent.pos2;
+	ent.moveinfo->end_angles = ent.angles;
 
 	gi.linkentity(ent);
 }
@@ -1017,7 +1019,7 @@ static void door_use_areaportals(entity &self, bool open)
 	if (!self.target)
 		return;
 
-	for (entity &t : G_IterateFunc<&entity::targetname>(self.target, striequals))
+	for (entity &t : G_IterateTargetname(self.target))
 		if (t.type == ET_FUNC_AREAPORTAL)
 			gi.SetAreaPortalState(t.style, open);
 }
@@ -1030,20 +1032,20 @@ static void door_hit_top(entity &self)
 {
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_end)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_end, ATTN_STATIC);
+		if (self.moveinfo->sound_end)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_end, ATTN_STATIC);
 		self.sound = SOUND_NONE;
 	}
 	
-	self.moveinfo.state = STATE_TOP;
+	self.moveinfo->state = STATE_TOP;
 	
 	if (self.spawnflags & DOOR_TOGGLE)
 		return;
 
-	if (self.moveinfo.wait >= gtimef::zero())
+	if (self.moveinfo->wait >= gtimef::zero())
 	{
 		self.think = SAVABLE(door_go_down);
-		self.nextthink = duration_cast<gtime>(level.time + self.moveinfo.wait);
+		self.set_nextthink(duration_cast<gtime>(level.time + self.moveinfo->wait));
 	}
 }
 
@@ -1053,11 +1055,11 @@ static void door_hit_bottom(entity &self)
 {
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_end)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_end, ATTN_STATIC);
+		if (self.moveinfo->sound_end)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_end, ATTN_STATIC);
 		self.sound = SOUND_NONE;
 	}
-	self.moveinfo.state = STATE_BOTTOM;
+	self.moveinfo->state = STATE_BOTTOM;
 	door_use_areaportals(self, false);
 }
 
@@ -1067,9 +1069,9 @@ static void door_go_down(entity &self)
 {
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_start)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_start, ATTN_STATIC);
-		self.sound = self.moveinfo.sound_middle;
+		if (self.moveinfo->sound_start)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_start, ATTN_STATIC);
+		self.sound = self.moveinfo->sound_middle;
 	}
 	if (self.max_health)
 	{
@@ -1077,38 +1079,38 @@ static void door_go_down(entity &self)
 		self.health = self.max_health;
 	}
 
-	self.moveinfo.state = STATE_DOWN;
+	self.moveinfo->state = STATE_DOWN;
 
 	if (self.type == ET_FUNC_DOOR)
-		Move_Calc(self, self.moveinfo.start_origin, SAVABLE(door_hit_bottom));
+		Move_Calc(self, self.moveinfo->start_origin, SAVABLE(door_hit_bottom));
 	else if (self.type == ET_FUNC_DOOR_ROTATING)
 		AngleMove_Calc(self, SAVABLE(door_hit_bottom));
 }
 
 static void door_go_up(entity &self, entity &cactivator)
 {
-	if (self.moveinfo.state == STATE_UP)
+	if (self.moveinfo->state == STATE_UP)
 		return;     // already going up
 
-	if (self.moveinfo.state == STATE_TOP)
+	if (self.moveinfo->state == STATE_TOP)
 	{
 		// reset top wait time
-		if (self.moveinfo.wait >= gtimef::zero())
-			self.nextthink = duration_cast<gtime>(level.time + self.moveinfo.wait);
+		if (self.moveinfo->wait >= gtimef::zero())
+			self.set_nextthink(duration_cast<gtime>(level.time + self.moveinfo->wait));
 		return;
 	}
 
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_start)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_start, ATTN_STATIC);
-		self.sound = self.moveinfo.sound_middle;
+		if (self.moveinfo->sound_start)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_start, ATTN_STATIC);
+		self.sound = self.moveinfo->sound_middle;
 	}
 
-	self.moveinfo.state = STATE_UP;
+	self.moveinfo->state = STATE_UP;
 
 	if (self.type == ET_FUNC_DOOR)
-		Move_Calc(self, self.moveinfo.end_origin, SAVABLE(door_hit_top));
+		Move_Calc(self, self.moveinfo->end_origin, SAVABLE(door_hit_top));
 	else if (self.type == ET_FUNC_DOOR_ROTATING)
 		AngleMove_Calc(self, SAVABLE(door_hit_top));
 
@@ -1127,10 +1129,10 @@ static void smart_water_go_up(entity &self)
 	entityref	lowestPlayer;
 	float	lowestPlayerPt;
 
-	if (self.moveinfo.state == STATE_TOP)
+	if (self.moveinfo->state == STATE_TOP)
 	{	// reset top wait time
-		if (self.moveinfo.wait >= gtimef::zero())
-			self.nextthink = duration_cast<gtime>(level.time + self.moveinfo.wait);
+		if (self.moveinfo->wait >= gtimef::zero())
+			self.set_nextthink(duration_cast<gtime>(level.time + self.moveinfo->wait));
 		return;
 	}
 
@@ -1139,17 +1141,17 @@ static void smart_water_go_up(entity &self)
 		if(self.absbounds.maxs[2] >= self.health)
 		{
 			self.velocity = vec3_origin;
-			self.nextthink = gtime::zero();
-			self.moveinfo.state = STATE_TOP;
+			self.set_nextthink(gtime::zero());
+			self.moveinfo->state = STATE_TOP;
 			return;
 		}
 	}
 
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_start)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_start, ATTN_STATIC);
-		self.sound = self.moveinfo.sound_middle;
+		if (self.moveinfo->sound_start)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_start, ATTN_STATIC);
+		self.sound = self.moveinfo->sound_middle;
 	}
 
 	// find the lowest player point.
@@ -1177,30 +1179,30 @@ static void smart_water_go_up(entity &self)
 	if(distance < self.accel)
 	{
 		distance = 100.f;
-		self.moveinfo.speed = 5.f;
+		self.moveinfo->speed = 5.f;
 	}
 	else
-		self.moveinfo.speed = distance / self.accel;
+		self.moveinfo->speed = distance / self.accel;
 
-	if(self.moveinfo.speed < 5)
-		self.moveinfo.speed = 5.f;
-	else if(self.moveinfo.speed > self.speed)
-		self.moveinfo.speed = self.speed;
+	if(self.moveinfo->speed < 5)
+		self.moveinfo->speed = 5.f;
+	else if(self.moveinfo->speed > self.speed)
+		self.moveinfo->speed = self.speed;
 
 	// FIXME - should this allow any movement other than straight up?
-	self.moveinfo.dir = MOVEDIR_UP;	
-	self.velocity = self.moveinfo.dir * self.moveinfo.speed;
-	self.moveinfo.remaining_distance = distance;
+	self.moveinfo->dir = MOVEDIR_UP;	
+	self.velocity = self.moveinfo->dir * self.moveinfo->speed;
+	self.moveinfo->remaining_distance = distance;
 
-	if(self.moveinfo.state != STATE_UP)
+	if(self.moveinfo->state != STATE_UP)
 	{
 		G_UseTargets (self, lowestPlayer);
 		door_use_areaportals (self, true);
-		self.moveinfo.state = STATE_UP;
+		self.moveinfo->state = STATE_UP;
 	}
 
 	self.think = SAVABLE(smart_water_go_up);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 #endif
 
@@ -1211,7 +1213,7 @@ static void door_use(entity &self, entity &, entity &cactivator)
 
 	if (self.spawnflags & DOOR_TOGGLE)
 	{
-		if (self.moveinfo.state == STATE_UP || self.moveinfo.state == STATE_TOP)
+		if (self.moveinfo->state == STATE_UP || self.moveinfo->state == STATE_TOP)
 		{
 			// trigger all paired doors
 			for (entity &ent : G_IterateChain<&entity::teamchain>(self))
@@ -1273,27 +1275,27 @@ static void Think_CalcMoveSpeed(entity &self)
 		return;     // only the team master does this
 
 	// find the smallest distance any member of the team will be moving
-	float min = fabs(self.moveinfo.distance);
+	float min = fabs(self.moveinfo->distance);
 
 	for (entity &ent : G_IterateChain<&entity::teamchain>(self.teamchain))
-		min = ::min(min, fabs(ent.moveinfo.distance));
+		min = ::min(min, fabs(ent.moveinfo->distance));
 
-	float time = min / self.moveinfo.speed;
+	float time = min / self.moveinfo->speed;
 
 	// adjust speeds so they will all complete at the same time
 	for (entity &ent : G_IterateChain<&entity::teamchain>(self))
 	{
-		float newspeed = fabs(ent.moveinfo.distance) / time;
-		float ratio = newspeed / ent.moveinfo.speed;
-		if (ent.moveinfo.accel == ent.moveinfo.speed)
-			ent.moveinfo.accel = newspeed;
+		float newspeed = fabs(ent.moveinfo->distance) / time;
+		float ratio = newspeed / ent.moveinfo->speed;
+		if (ent.moveinfo->accel == ent.moveinfo->speed)
+			ent.moveinfo->accel = newspeed;
 		else
-			ent.moveinfo.accel *= ratio;
-		if (ent.moveinfo.decel == ent.moveinfo.speed)
-			ent.moveinfo.decel = newspeed;
+			ent.moveinfo->accel *= ratio;
+		if (ent.moveinfo->decel == ent.moveinfo->speed)
+			ent.moveinfo->decel = newspeed;
 		else
-			ent.moveinfo.decel *= ratio;
-		ent.moveinfo.speed = newspeed;
+			ent.moveinfo->decel *= ratio;
+		ent.moveinfo->speed = newspeed;
 	}
 }
 
@@ -1319,7 +1321,7 @@ static void Think_SpawnDoorTrigger(entity &ent)
 	other.bounds = cbounds;
 	other.owner = ent;
 	other.solid = SOLID_TRIGGER;
-	other.movetype = MOVETYPE_NONE;
+	other.set_movetype(MOVETYPE_NONE);
 	other.touch = SAVABLE(Touch_DoorTrigger);
 	gi.linkentity(other);
 
@@ -1350,10 +1352,10 @@ static void door_blocked(entity &self, entity &other)
 
 	// if a door has a negative wait, it would never come back if blocked,
 	// so let it just squash the object to death real fast
-	if (self.moveinfo.wait >= gtimef::zero())
+	if (self.moveinfo->wait >= gtimef::zero())
 	{
 		for (entity &ent : G_IterateChain<&entity::teamchain>(self.teammaster))
-			if (self.moveinfo.state == STATE_DOWN)
+			if (self.moveinfo->state == STATE_DOWN)
 				door_go_up(ent, ent.activator.or_default(world));
 			else
 				door_go_down(ent);
@@ -1392,15 +1394,17 @@ REGISTER_STATIC_SAVABLE(door_touch);
 
 static void SP_func_door(entity &ent)
 {
+	ent.moveinfo.emplace();
+
 	if (ent.sounds != 1)
 	{
-		ent.moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent.moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent.moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent.moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent.moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent.moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	G_SetMovedir(ent.angles, ent.movedir);
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_BSP;
 	gi.setmodel(ent, ent.model);
 
@@ -1432,8 +1436,8 @@ static void SP_func_door(entity &ent)
 	abs_movedir.x = fabs(ent.movedir.x);
 	abs_movedir.y = fabs(ent.movedir.y);
 	abs_movedir.z = fabs(ent.movedir.z);
-	ent.moveinfo.distance = abs_movedir.x * ent.size.x + abs_movedir.y * ent.size.y + abs_movedir.z * ent.size.z - st.lip;
-	ent.pos2 = ent.pos1 + (ent.moveinfo.distance * ent.movedir);
+	ent.moveinfo->distance = abs_movedir.x * ent.size.x + abs_movedir.y * ent.size.y + abs_movedir.z * ent.size.z - st.lip;
+	ent.pos2 = ent.pos1 + (ent.moveinfo->distance * ent.movedir);
 
 	// if it starts open, switch the positions
 	if (ent.spawnflags & DOOR_START_OPEN)
@@ -1443,7 +1447,7 @@ static void SP_func_door(entity &ent)
 		ent.pos1 = ent.origin;
 	}
 
-	ent.moveinfo.state = STATE_BOTTOM;
+	ent.moveinfo->state = STATE_BOTTOM;
 
 	if (ent.health)
 	{
@@ -1457,14 +1461,14 @@ static void SP_func_door(entity &ent)
 		ent.touch = SAVABLE(door_touch);
 	}
 
-	ent.moveinfo.speed = ent.speed;
-	ent.moveinfo.accel = ent.accel;
-	ent.moveinfo.decel = ent.decel;
-	ent.moveinfo.wait = ent.wait;
-	ent.moveinfo.start_origin = ent.pos1;
-	ent.moveinfo.start_angles = ent.angles;
-	ent.moveinfo.end_origin = ent.pos2;
-	ent.moveinfo.end_angles = ent.angles;
+	ent.moveinfo->speed = ent.speed;
+	ent.moveinfo->accel = ent.accel;
+	ent.moveinfo->decel = ent.decel;
+	ent.moveinfo->wait = ent.wait;
+	ent.moveinfo->start_origin = ent.pos1;
+	ent.moveinfo->start_angles = ent.angles;
+	ent.moveinfo->end_origin = ent.pos2;
+	ent.moveinfo->end_angles = ent.angles;
 
 	if (ent.spawnflags & DOOR_ANIMATED)
 		ent.effects |= EF_ANIM_ALL;
@@ -1477,7 +1481,7 @@ static void SP_func_door(entity &ent)
 
 	gi.linkentity(ent);
 
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	if (ent.health || ent.targetname)
 		ent.think = SAVABLE(Think_CalcMoveSpeed);
 	else
@@ -1533,7 +1537,7 @@ static void Door_Activate(entity &self, entity &, entity &)
 		self.think = SAVABLE(Think_CalcMoveSpeed);
 	else
 		self.think = SAVABLE(Think_SpawnDoorTrigger);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 
 }
 
@@ -1565,9 +1569,10 @@ static void SP_func_door_rotating(entity &ent)
 
 	ent.pos1 = ent.angles;
 	ent.pos2 = ent.angles + (st.distance * ent.movedir);
-	ent.moveinfo.distance = (float)st.distance;
+	ent.moveinfo.emplace();
+	ent.moveinfo->distance = (float)st.distance;
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_BSP;
 	gi.setmodel(ent, ent.model);
 
@@ -1588,9 +1593,9 @@ static void SP_func_door_rotating(entity &ent)
 
 	if (ent.sounds != 1)
 	{
-		ent.moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent.moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent.moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent.moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent.moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent.moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	// if it starts open, switch the positions
@@ -1615,15 +1620,15 @@ static void SP_func_door_rotating(entity &ent)
 		ent.touch = SAVABLE(door_touch);
 	}
 
-	ent.moveinfo.state = STATE_BOTTOM;
-	ent.moveinfo.speed = ent.speed;
-	ent.moveinfo.accel = ent.accel;
-	ent.moveinfo.decel = ent.decel;
-	ent.moveinfo.wait = ent.wait;
-	ent.moveinfo.start_origin = ent.origin;
-	ent.moveinfo.start_angles = ent.pos1;
-	ent.moveinfo.end_origin = ent.origin;
-	ent.moveinfo.end_angles = ent.pos2;
+	ent.moveinfo->state = STATE_BOTTOM;
+	ent.moveinfo->speed = ent.speed;
+	ent.moveinfo->accel = ent.accel;
+	ent.moveinfo->decel = ent.decel;
+	ent.moveinfo->wait = ent.wait;
+	ent.moveinfo->start_origin = ent.origin;
+	ent.moveinfo->start_angles = ent.pos1;
+	ent.moveinfo->end_origin = ent.origin;
+	ent.moveinfo->end_angles = ent.pos2;
 
 	if (ent.spawnflags & DOOR_ROTATING_ANIMATED)
 		ent.effects |= EF_ANIM_ALL;
@@ -1634,7 +1639,7 @@ static void SP_func_door_rotating(entity &ent)
 
 	gi.linkentity(ent);
 
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	if (ent.health || ent.targetname)
 		ent.think = SAVABLE(Think_CalcMoveSpeed);
 	else
@@ -1646,7 +1651,7 @@ static void SP_func_door_rotating(entity &ent)
 		ent.takedamage = false;
 		ent.die = nullptr;
 		ent.think = nullptr;
-		ent.nextthink = gtime::zero();
+		ent.set_nextthink(gtime::zero());
 		ent.use = SAVABLE(Door_Activate);
 	}
 #endif
@@ -1691,20 +1696,21 @@ REGISTER_STATIC_SAVABLE(smart_water_blocked);
 static void SP_func_water(entity &self)
 {
 	G_SetMovedir(self.angles, self.movedir);
-	self.movetype = MOVETYPE_PUSH;
+	self.set_movetype(MOVETYPE_PUSH);
 	self.solid = SOLID_BSP;
 	gi.setmodel(self, self.model);
+	self.moveinfo.emplace();
 
 	switch (self.sounds)
 	{
 	case 1: // water
-		self.moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-		self.moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+		self.moveinfo->sound_start = gi.soundindex("world/mov_watr.wav");
+		self.moveinfo->sound_end = gi.soundindex("world/stp_watr.wav");
 		break;
 
 	case 2: // lava
-		self.moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-		self.moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+		self.moveinfo->sound_start = gi.soundindex("world/mov_watr.wav");
+		self.moveinfo->sound_end = gi.soundindex("world/stp_watr.wav");
 		break;
 	}
 
@@ -1714,8 +1720,8 @@ static void SP_func_water(entity &self)
 	abs_movedir.x = fabs(self.movedir.x);
 	abs_movedir.y = fabs(self.movedir.y);
 	abs_movedir.z = fabs(self.movedir.z);
-	self.moveinfo.distance = abs_movedir.x * self.size.x + abs_movedir.y * self.size.y + abs_movedir.z * self.size.z - st.lip;
-	self.pos2 = self.pos1 + (self.moveinfo.distance * self.movedir);
+	self.moveinfo->distance = abs_movedir.x * self.size.x + abs_movedir.y * self.size.y + abs_movedir.z * self.size.z - st.lip;
+	self.pos2 = self.pos1 + (self.moveinfo->distance * self.movedir);
 
 	// if it starts open, switch the positions
 	if (self.spawnflags & DOOR_START_OPEN)
@@ -1725,16 +1731,16 @@ static void SP_func_water(entity &self)
 		self.pos1 = self.origin;
 	}
 
-	self.moveinfo.start_origin = self.pos1;
-	self.moveinfo.start_angles = self.angles;
-	self.moveinfo.end_origin = self.pos2;
-	self.moveinfo.end_angles = self.angles;
+	self.moveinfo->start_origin = self.pos1;
+	self.moveinfo->start_angles = self.angles;
+	self.moveinfo->end_origin = self.pos2;
+	self.moveinfo->end_angles = self.angles;
 
-	self.moveinfo.state = STATE_BOTTOM;
+	self.moveinfo->state = STATE_BOTTOM;
 
 	if (!self.speed)
 		self.speed = 25.f;
-	self.moveinfo.accel = self.moveinfo.decel = self.moveinfo.speed = self.speed;
+	self.moveinfo->accel = self.moveinfo->decel = self.moveinfo->speed = self.speed;
 
 #ifdef GROUND_ZERO
 	if (self.spawnflags & WATER_SMART)	// smart water
@@ -1749,7 +1755,7 @@ static void SP_func_water(entity &self)
 
 	if (self.wait == gtimef::zero())
 		self.wait = -1s;
-	self.moveinfo.wait = self.wait;
+	self.moveinfo->wait = self.wait;
 
 	self.use = SAVABLE(door_use);
 
@@ -1804,7 +1810,7 @@ static void train_wait(entity &self)
 	if (self.target_ent->pathtarget)
 	{
 		entity &ent = self.target_ent;
-		string savetarget = ent.target;
+		atom savetarget = ent.target;
 		ent.target = ent.pathtarget;
 		// FIXME
 		G_UseTargets(ent, self.activator);
@@ -1815,11 +1821,11 @@ static void train_wait(entity &self)
 			return;
 	}
 
-	if (self.moveinfo.wait != gtimef::zero())
+	if (self.moveinfo->wait != gtimef::zero())
 	{
-		if (self.moveinfo.wait > gtimef::zero())
+		if (self.moveinfo->wait > gtimef::zero())
 		{
-			self.nextthink = duration_cast<gtime>(level.time + self.moveinfo.wait);
+			self.set_nextthink(duration_cast<gtime>(level.time + self.moveinfo->wait));
 			self.think = SAVABLE(train_next);
 		}
 		else if (self.spawnflags & TRAIN_TOGGLE)
@@ -1831,13 +1837,13 @@ static void train_wait(entity &self)
 #endif
 			self.spawnflags &= ~TRAIN_START_ON;
 			self.velocity = vec3_origin;
-			self.nextthink = gtime::zero();
+			self.set_nextthink(gtime::zero());
 		}
 
 		if (!(self.flags & FL_TEAMSLAVE))
 		{
-			if (self.moveinfo.sound_end)
-				gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_end, ATTN_STATIC);
+			if (self.moveinfo->sound_end)
+				gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_end, ATTN_STATIC);
 			self.sound = SOUND_NONE;
 		}
 	}
@@ -1894,33 +1900,33 @@ again:
 	if (ent->speed)
 	{
 		self.speed = ent->speed;
-		self.moveinfo.speed = ent->speed;
+		self.moveinfo->speed = ent->speed;
 		if(ent->accel)
-			self.moveinfo.accel = ent->accel;
+			self.moveinfo->accel = ent->accel;
 		else
-			self.moveinfo.accel = ent->speed;
+			self.moveinfo->accel = ent->speed;
 		if(ent->decel)
-			self.moveinfo.decel = ent->decel;
+			self.moveinfo->decel = ent->decel;
 		else
-			self.moveinfo.decel = ent->speed;
-		self.moveinfo.current_speed = 0;
+			self.moveinfo->decel = ent->speed;
+		self.moveinfo->current_speed = 0;
 	}
 #endif
 
-	self.moveinfo.wait = ent->wait;
+	self.moveinfo->wait = ent->wait;
 	self.target_ent = ent;
 
 	if (!(self.flags & FL_TEAMSLAVE))
 	{
-		if (self.moveinfo.sound_start)
-			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo.sound_start, ATTN_STATIC);
-		self.sound = self.moveinfo.sound_middle;
+		if (self.moveinfo->sound_start)
+			gi.sound(self, CHAN_VOICE | CHAN_NO_PHS_ADD, self.moveinfo->sound_start, ATTN_STATIC);
+		self.sound = self.moveinfo->sound_middle;
 	}
 
 	vector dest = ent->origin - self.bounds.mins;
-	self.moveinfo.state = STATE_TOP;
-	self.moveinfo.start_origin = self.origin;
-	self.moveinfo.end_origin = dest;
+	self.moveinfo->state = STATE_TOP;
+	self.moveinfo->start_origin = self.origin;
+	self.moveinfo->end_origin = dest;
 	Move_Calc(self, dest, SAVABLE(train_wait));
 	self.spawnflags |= TRAIN_START_ON;
 
@@ -1933,15 +1939,15 @@ again:
 		{
 			vector dst = dir + e.origin;
 
-			e.moveinfo.start_origin = e.origin;
-			e.moveinfo.end_origin = dst;
+			e.moveinfo->start_origin = e.origin;
+			e.moveinfo->end_origin = dst;
 
-			e.moveinfo.state = STATE_TOP;
+			e.moveinfo->state = STATE_TOP;
 			e.speed = self.speed;
-			e.moveinfo.speed = self.moveinfo.speed;
-			e.moveinfo.accel = self.moveinfo.accel;
-			e.moveinfo.decel = self.moveinfo.decel;
-			e.movetype = MOVETYPE_PUSH;
+			e.moveinfo->speed = self.moveinfo->speed;
+			e.moveinfo->accel = self.moveinfo->accel;
+			e.moveinfo->decel = self.moveinfo->decel;
+			e.set_movetype(MOVETYPE_PUSH);
 			Move_Calc (e, dst, SAVABLE(train_piece_wait));
 		}
 	
@@ -1953,9 +1959,9 @@ static void train_resume(entity &self)
 {
 	entity &ent = self.target_ent;
 	vector dest = ent.origin - self.bounds.mins;
-	self.moveinfo.state = STATE_TOP;
-	self.moveinfo.start_origin = self.origin;
-	self.moveinfo.end_origin = dest;
+	self.moveinfo->state = STATE_TOP;
+	self.moveinfo->start_origin = self.origin;
+	self.moveinfo->end_origin = dest;
 	Move_Calc(self, dest, SAVABLE(train_wait));
 	self.spawnflags |= TRAIN_START_ON;
 }
@@ -1987,7 +1993,7 @@ void func_train_find(entity &self)
 
 	if (self.spawnflags & TRAIN_START_ON)
 	{
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 		self.think = SAVABLE(train_next);
 		self.activator = self;
 	}
@@ -2005,7 +2011,7 @@ void train_use(entity &self, entity &, entity &cactivator)
 			return;
 		self.spawnflags &= ~TRAIN_START_ON;
 		self.velocity = vec3_origin;
-		self.nextthink = gtime::zero();
+		self.set_nextthink(gtime::zero());
 	}
 	else if (self.target_ent.has_value())
 		train_resume(self);
@@ -2021,7 +2027,7 @@ static void SP_func_train(entity &self)
 	g_legacy_trains = gi.cvar("g_legacy_trains", "0", CVAR_LATCH);
 #endif
 
-	self.movetype = MOVETYPE_PUSH;
+	self.set_movetype(MOVETYPE_PUSH);
 
 	self.angles = vec3_origin;
 	self.blocked = SAVABLE(train_blocked);
@@ -2032,13 +2038,15 @@ static void SP_func_train(entity &self)
 	self.solid = SOLID_BSP;
 	gi.setmodel(self, self.model);
 
+	self.moveinfo.emplace();
+
 	if (st.noise)
-		self.moveinfo.sound_middle = gi.soundindex(st.noise);
+		self.moveinfo->sound_middle = gi.soundindex(st.noise);
 
 	if (!self.speed)
 		self.speed = 100.f;
 
-	self.moveinfo.accel = self.moveinfo.decel = self.moveinfo.speed = self.speed;
+	self.moveinfo->accel = self.moveinfo->decel = self.moveinfo->speed = self.speed;
 
 	self.use = SAVABLE(train_use);
 
@@ -2048,7 +2056,7 @@ static void SP_func_train(entity &self)
 	{
 		// start trains on the second frame, to make sure their targets have had
 		// a chance to spawn
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 		self.think = SAVABLE(func_train_find);
 	}
 	else
@@ -2061,7 +2069,7 @@ REGISTER_ENTITY(FUNC_TRAIN, func_train);
 */
 static void trigger_elevator_use(entity &self, entity &other, entity &)
 {
-	if (self.movetarget->nextthink != gtime::zero())
+	if (self.movetarget->get_nextthink() != gtime::zero())
 		return;
 
 	if (!other.pathtarget)
@@ -2115,7 +2123,7 @@ REGISTER_STATIC_SAVABLE(trigger_elevator_init);
 static void SP_trigger_elevator(entity &self)
 {
 	self.think = SAVABLE(trigger_elevator_init);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 static REGISTER_ENTITY(TRIGGER_ELEVATOR, trigger_elevator);
@@ -2137,7 +2145,7 @@ These can used but not touched.
 static void func_timer_think(entity &self)
 {
 	G_UseTargets(self, self.activator);
-	self.nextthink = duration_cast<gtime>(level.time + self.wait + crandom(self.rand));
+	self.set_nextthink(duration_cast<gtime>(level.time + self.wait + crandom(self.rand)));
 }
 
 REGISTER_STATIC_SAVABLE(func_timer_think);
@@ -2147,15 +2155,15 @@ static void func_timer_use(entity &self, entity &, entity &cactivator)
 	self.activator = cactivator;
 
 	// if on, turn it off
-	if (self.nextthink != gtime::zero())
+	if (self.get_nextthink() != gtime::zero())
 	{
-		self.nextthink = gtime::zero();
+		self.set_nextthink(gtime::zero());
 		return;
 	}
 
 	// turn it on
 	if (self.delay != gtimef::zero())
-		self.nextthink = duration_cast<gtime>(level.time + self.delay);
+		self.set_nextthink(duration_cast<gtime>(level.time + self.delay));
 	else
 		func_timer_think(self);
 }
@@ -2180,7 +2188,7 @@ static void SP_func_timer(entity &self)
 
 	if (self.spawnflags & TIMER_START_ON)
 	{
-		self.nextthink = duration_cast<gtime>(level.time + 1s + st.pausetime + self.delay + self.wait + crandom(self.rand));
+		self.set_nextthink(duration_cast<gtime>(level.time + 1s + st.pausetime + self.delay + self.wait + crandom(self.rand)));
 		self.activator = self;
 	}
 
@@ -2295,7 +2303,7 @@ REGISTER_STATIC_SAVABLE(door_secret_use);
 
 static void door_secret_move1(entity &self)
 {
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 	self.think = SAVABLE(door_secret_move2);
 }
 
@@ -2308,7 +2316,7 @@ static void door_secret_move3(entity &self)
 {
 	if (self.wait == -1s)
 		return;
-	self.nextthink = duration_cast<gtime>(level.time + self.wait);
+	self.set_nextthink(duration_cast<gtime>(level.time + self.wait));
 	self.think = SAVABLE(door_secret_move4);
 }
 
@@ -2319,7 +2327,7 @@ static void door_secret_move4(entity &self)
 
 static void door_secret_move5(entity &self)
 {
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 	self.think = SAVABLE(door_secret_move6);
 }
 
@@ -2370,11 +2378,12 @@ REGISTER_STATIC_SAVABLE(door_secret_die);
 
 static void SP_func_door_secret(entity &ent)
 {
-	ent.moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-	ent.moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-	ent.moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+	ent.moveinfo.emplace();
+	ent.moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+	ent.moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+	ent.moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_BSP;
 	gi.setmodel(ent, ent.model);
 
@@ -2394,9 +2403,9 @@ static void SP_func_door_secret(entity &ent)
 	if (ent.wait == gtimef::zero())
 		ent.wait = 5s;
 
-	ent.moveinfo.accel =
-		ent.moveinfo.decel =
-			ent.moveinfo.speed = 50.f;
+	ent.moveinfo->accel =
+		ent.moveinfo->decel =
+			ent.moveinfo->speed = 50.f;
 
 	// calculate positions
 	vector forward, right, up;
@@ -14,6 +14,16 @@
 #include "lib/string/format.h"
 #include "view.h"
 #include "target.h"
+#include "profile.h"
+#include "framehash.h"
+#include "think.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#define G_Prefetch(p) _mm_prefetch((const char *) (p), _MM_HINT_T0)
+#else
+#define G_Prefetch(p) ((void) (p))
+#endif
 
 constexpr stringlit GAMEVERSION = "clean";
 
@@ -67,6 +77,10 @@ cvarref	sv_maplist;
 
 cvarref	sv_features;
 
+cvarref	g_batch_physics;
+
+cvarref	g_ai_dormancy;
+
 model_index sm_meat_index;
 sound_index snd_fry;
 
@@ -75,6 +89,8 @@ client *clients;
 void InitGame()
 {
 	gi.dprintfmt("===== {} =====\n", __func__);
+
+	InitSavables();
 	
 	//FIXME: sv_ prefix is wrong for these
 	sv_rollspeed = gi.cvar("sv_rollspeed", "200", CVAR_NONE);
@@ -133,6 +149,25 @@ void InitGame()
 	// dm map list
 	sv_maplist = gi.cvar("sv_maplist", "", CVAR_NONE);
 	
+	// run physics in movetype buckets; see G_RunEntitiesBatched. This isn't
+	// the same order as the normal loop, so it's off by default:
+	// - pushers run first, then each other movetype in turn, so two entities
+	//   of different movetypes that interact in a frame (a rocket hitting a
+	//   monster) can resolve the other way around.
+	// - entities spawned during the frame all run at the end, including ones
+	//   in slots lower than whatever spawned them, which the normal loop
+	//   would have left until the next frame.
+	// check a map's frame hashes (see framehash.h) against a normal run
+	// before relying on it.
+	g_batch_physics = gi.cvar("g_batch_physics", "0", CVAR_NONE);
+
+	// let monsters no client can see idle; see M_Wake
+	g_ai_dormancy = gi.cvar("g_ai_dormancy", "0", CVAR_NONE);
+
+	// frame hashing and the random seed for replays; see framehash.h
+	G_FrameHashInit();
+	gi.cvar("g_seed", "0", CVAR_LATCH);
+	
 	// obtain server features
 	sv_features = gi.cvar("sv_features", "", CVAR_NONE);
 	
@@ -189,7 +224,7 @@ Returns the created target changelevel
 static entity &CreateTargetChangeLevel(string new_map)
 {
 	entity &ent = G_Spawn();
-	ent.type = ET_TARGET_CHANGELEVEL;
+	G_SetType(ent, ET_TARGET_CHANGELEVEL);
 	ent.map = level.nextmap = new_map;
 	return ent;
 }
@@ -203,27 +238,22 @@ static entity &FindTargetChangeLevel()
 	// see if it's in the map list
 	if (sv_maplist)
 	{
-		stringlit ml = (stringlit)sv_maplist;
-		size_t s_offset = 0;
-		string t = strtok(ml, s_offset), f = t;
+		tokenizer maps((stringlit)sv_maplist);
+		const std::string_view first = maps.next();
 
-		while (t)
+		for (std::string_view t = first; !t.empty(); t = maps.next())
 		{
-			if (striequals(t, level.mapname))
-			{
-				// it's in the list, go to the next one
-				t = strtok(ml, s_offset);
-				if (t)
-					return CreateTargetChangeLevel(t);
-				// end of list, go to first one
-				else if (!f)
-					return CreateTargetChangeLevel(f);
-
-				// there isn't a first one, same level
-				return CreateTargetChangeLevel(level.mapname);
-			}
+			if (!striequals(t, level.mapname.view()))
+				continue;
+
+			// it's in the list, go to the next one
+			t = maps.next();
 
-			t = strtok(ml, s_offset);
+			if (!t.empty())
+				return CreateTargetChangeLevel(string(t));
+
+			// end of list, go to first one
+			return CreateTargetChangeLevel(string(first));
 		}
 	}
 
@@ -345,10 +375,158 @@ static void ExitLevel()
 	}
 }
 
+/*
+=============
+G_RunEntityFrame
+
+Everything RunFrame does to a single entity.
+=============
+*/
+static void G_RunEntityFrame(entity &ent)
+{
+	level.current_entity = ent;
+	
+	ent.old_origin = ent.origin;
+	
+	// if the ground entity moved, make sure we are still on it
+	if (ent.groundentity.has_value() && (ent.groundentity->linkcount != ent.groundentity_linkcount))
+#ifdef SINGLE_PLAYER
+	{
+#endif
+		ent.groundentity = null_entity;
+#ifdef SINGLE_PLAYER
+		if (!(ent.flags & (FL_SWIM | FL_FLY)) && (ent.svflags & SVF_MONSTER))
+			M_CheckGround(ent);
+	}
+#endif
+
+	if (ent.is_client)
+		ClientBeginServerFrame(ent);
+
+	G_RunEntity(ent);
+}
+
+// physics buckets for g_batch_physics, in the order that they run
+enum physics_bucket : uint8_t
+{
+	BUCKET_PUSHER,
+	BUCKET_NONE,
+	BUCKET_NOCLIP,
+#ifdef SINGLE_PLAYER
+	BUCKET_STEP,
+#endif
+	BUCKET_TOSS,
+
+	BUCKET_TOTAL
+};
+
+static constexpr physics_bucket G_PhysicsBucket(move_type movetype)
+{
+	switch (movetype)
+	{
+	case MOVETYPE_PUSH:
+	case MOVETYPE_STOP:
+		return BUCKET_PUSHER;
+	case MOVETYPE_NOCLIP:
+		return BUCKET_NOCLIP;
+#ifdef SINGLE_PLAYER
+	case MOVETYPE_STEP:
+		return BUCKET_STEP;
+#endif
+	case MOVETYPE_TOSS:
+	case MOVETYPE_BOUNCE:
+	case MOVETYPE_FLY:
+	case MOVETYPE_FLYMISSILE:
+#ifdef THE_RECKONING
+	case MOVETYPE_WALLBOUNCE:
+#endif
+		return BUCKET_TOSS;
+	default:
+		// bad movetypes are caught by G_RunEntity
+		return BUCKET_NONE;
+	}
+}
+
+// an entity waiting in a bucket, and which entity was in that slot
+// when the buckets were filled
+struct physics_entry
+{
+	uint32_t	number;
+	uint32_t	spawn_id;
+};
+
+// entries in each bucket, in index order; kept around
+// between frames so that they don't reallocate
+static array<dynarray<physics_entry>, BUCKET_TOTAL> physics_buckets;
+// slots run this frame, and the spawn id of the entity run in each
+static bitset<MAX_EDICTS> physics_ran;
+static array<uint32_t, MAX_EDICTS> physics_ran_ids;
+
+static void G_RunBatchedEntity(entity &ent)
+{
+	physics_ran.set(ent.number);
+	physics_ran_ids[ent.number] = G_SpawnId(ent);
+
+	G_RunEntityFrame(ent);
+}
+
+/*
+=============
+G_RunEntitiesBatched
+
+Same as the loop in RunFrame, except that the entities are sorted into
+buckets by movetype first, and each bucket is run through in turn,
+pushers first. Each bucket keeps index order. An entry is skipped if
+its entity was freed before its turn, even if the slot has been re-used
+since; once the buckets are done, everything that needs running and
+hasn't been run yet (entities spawned during the frame, including into
+those re-used slots) runs in index order. See g_batch_physics for how
+this differs from the normal loop.
+=============
+*/
+static void G_RunEntitiesBatched()
+{
+	for (dynarray<physics_entry> &bucket : physics_buckets)
+		bucket.clear();
+
+	physics_ran.reset();
+
+	for (entity &ent : G_IterateFrame())
+		physics_buckets[G_PhysicsBucket(ent.get_movetype())].push_back({ ent.number, G_SpawnId(ent) });
+
+	for (const dynarray<physics_entry> &bucket : physics_buckets)
+	{
+		for (size_t i = 0; i < bucket.size(); i++)
+		{
+			if (i + 1 < bucket.size())
+			{
+				entity &next = itoe(bucket[i + 1].number);
+				G_Prefetch(&next);
+				G_Prefetch(&next.velocity);
+			}
+
+			entity &ent = itoe(bucket[i].number);
+
+			// something earlier in the frame may have freed it
+			if (ent.inuse && G_SpawnId(ent) == bucket[i].spawn_id)
+				G_RunBatchedEntity(ent);
+		}
+	}
+
+	for (entity &ent : G_IterateFrame())
+		if (!physics_ran.test(ent.number) || physics_ran_ids[ent.number] != G_SpawnId(ent))
+			G_RunBatchedEntity(ent);
+}
+
 void RunFrame()
 {
 	level.time += framerate_ms;
 
+	gi.ClearScratch();
+	G_SpatialClearScratch();
+
+	G_AdvanceThinks();
+
 	// exit intermissions
 	if (level.exitintermission)
 	{
@@ -365,35 +543,15 @@ void RunFrame()
 	// treat each object in turn
 	// even the world gets a chance to think.
 	// this is done in a loop since the last entity ID
-	// can move during a think.
+	// can move during a think. idle entities are only
+	// visited on frames that they think; see think.h.
 	//
-	for (uint32_t i = 0; i < num_entities; i++)
+	if (g_batch_physics)
+		G_RunEntitiesBatched();
+	else
 	{
-		entity &ent = itoe(i);
-
-		if (!ent.inuse)
-			continue;
-		
-		level.current_entity = ent;
-		
-		ent.old_origin = ent.origin;
-		
-		// if the ground entity moved, make sure we are still on it
-		if (ent.groundentity.has_value() && (ent.groundentity->linkcount != ent.groundentity_linkcount))
-#ifdef SINGLE_PLAYER
-		{
-#endif
-			ent.groundentity = null_entity;
-#ifdef SINGLE_PLAYER
-			if (!(ent.flags & (FL_SWIM | FL_FLY)) && (ent.svflags & SVF_MONSTER))
-				M_CheckGround(ent);
-		}
-#endif
-	
-		if (ent.is_client)
-			ClientBeginServerFrame(ent);
-	
-		G_RunEntity(ent);
+		for (entity &ent : G_IterateFrame())
+			G_RunEntityFrame(ent);
 	}
 	
 	// see if it is time to end a deathmatch
@@ -404,4 +562,8 @@ void RunFrame()
 	
 	// build the playerstate_t structures for all players
 	ClientEndServerFrames();
+
+	G_FrameHashEndFrame();
+
+	G_ProfileEndFrame();
 }
\ No newline at end of file
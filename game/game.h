@@ -126,6 +126,10 @@ extern cvarref	sv_maplist;
 
 extern cvarref	sv_features;
 
+extern cvarref	g_batch_physics;
+
+extern cvarref	g_ai_dormancy;
+
 // spawn_temp_t is only used to hold entity field values that
 // can be set from the editor, but aren't actualy present
 // in edict_t during gameplay.
@@ -347,7 +347,7 @@ void G_SetStats(entity &ent)
 	else
 	{
 		const gitem_t &it = GetItemByIndex(ent.client.ammo_index);
-		ent.client.ps.stats[STAT_AMMO_ICON] = gi.imageindex(it.icon);
+		ent.client.ps.stats[STAT_AMMO_ICON] = it.get_icon();
 		ent.client.ps.stats[STAT_AMMO] = ent.client.pers.inventory[it.id];
 	}
 
@@ -376,15 +376,15 @@ void G_SetStats(entity &ent)
 		// flash between power armor and other armor icon
 		// Knightmare- use correct icon for power screen
 		if (power_armor_type == ITEM_POWER_SHIELD)
-			ent.client.ps.stats[STAT_ARMOR_ICON] = gi.imageindex("i_powershield");
+			ent.client.ps.stats[STAT_ARMOR_ICON] = GetItemByIndex(ITEM_POWER_SHIELD).get_icon();
 		else	// POWER_ARMOR_SCREEN
-			ent.client.ps.stats[STAT_ARMOR_ICON] = gi.imageindex("i_powerscreen");
+			ent.client.ps.stats[STAT_ARMOR_ICON] = GetItemByIndex(ITEM_POWER_SCREEN).get_icon();
 		ent.client.ps.stats[STAT_ARMOR] = cells;
 	}
 	else if (index)
 	{
 		const gitem_t &it = GetItemByIndex(index);
-		ent.client.ps.stats[STAT_ARMOR_ICON] = gi.imageindex(it.icon);
+		ent.client.ps.stats[STAT_ARMOR_ICON] = it.get_icon();
 		ent.client.ps.stats[STAT_ARMOR] = ent.client.pers.inventory[index];
 	}
 	else
@@ -407,43 +407,43 @@ void G_SetStats(entity &ent)
 	//
 	if (ent.client.quad_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quad");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_QUAD_DAMAGE).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.quad_time - level.time).count();
 	}
 #ifdef THE_RECKONING
 	// RAFAEL
 	else if (ent.client.quadfire_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quadfire");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_QUADFIRE).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.quadfire_time - level.time).count();
 	}
 #endif
 #ifdef GROUND_ZERO
 	else if (ent.client.double_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_double");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_DOUBLE_DAMAGE).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.double_time - level.time).count();
 	}
 #endif
 	else if (ent.client.invincible_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_invulnerability");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_INVULNERABILITY).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.invincible_time - level.time).count();
 	}
 	else if (ent.client.enviro_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_envirosuit");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_ENVIRO).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.enviro_time - level.time).count();
 	}
 	else if (ent.client.breather_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_rebreather");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_BREATHER).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.breather_time - level.time).count();
 	}
 #ifdef GROUND_ZERO
 	else if (ent.client.ir_time > level.time)
 	{
-		ent.client.ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_ir");
+		ent.client.ps.stats[STAT_TIMER_ICON] = GetItemByIndex(ITEM_IR_GOGGLES).get_icon();
 		ent.client.ps.stats[STAT_TIMER] = duration_cast<seconds>(ent.client.ir_time - level.time).count();
 	}
 #endif
@@ -459,7 +459,7 @@ void G_SetStats(entity &ent)
 	if (!ent.client.pers.selected_item)
 		ent.client.ps.stats[STAT_SELECTED_ICON] = 0;
 	else
-		ent.client.ps.stats[STAT_SELECTED_ICON] = gi.imageindex(GetItemByIndex(ent.client.pers.selected_item).icon);
+		ent.client.ps.stats[STAT_SELECTED_ICON] = GetItemByIndex(ent.client.pers.selected_item).get_icon();
 
 	ent.client.ps.stats[STAT_SELECTED_ITEM] = ent.client.pers.selected_item;
 
@@ -501,7 +501,7 @@ void G_SetStats(entity &ent)
 	else
 #endif
 		if ((ent.client.pers.hand == CENTER_HANDED || ent.client.ps.fov > 91.f) && ent.client.pers.weapon)
-			ent.client.ps.stats[STAT_HELPICON] = gi.imageindex(ent.client.pers.weapon->icon);
+			ent.client.ps.stats[STAT_HELPICON] = ent.client.pers.weapon->get_icon();
 		else
 			ent.client.ps.stats[STAT_HELPICON] = 0;
 
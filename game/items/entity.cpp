@@ -64,7 +64,7 @@ void SetRespawn(entity &ent, gtimef delay)
 	ent.flags |= FL_RESPAWN;
 	ent.svflags |= SVF_NOCLIENT;
 	ent.solid = SOLID_NOT;
-	ent.nextthink = duration_cast<gtime>(level.time + delay);
+	ent.set_nextthink(duration_cast<gtime>(level.time + delay));
 	ent.think = SAVABLE(DoRespawn);
 	gi.linkentity(ent);
 }
@@ -86,7 +86,7 @@ void Touch_Item(entity &ent, entity &other, vector, const surface &)
 		other.client.bonus_alpha = 0.25f;
 
 		// show icon and name on status bar
-		other.client.ps.stats[STAT_PICKUP_ICON] = gi.imageindex(ent.item->icon);
+		other.client.ps.stats[STAT_PICKUP_ICON] = ent.item->get_icon();
 		other.client.ps.stats[STAT_PICKUP_STRING] = CS_ITEMS + (config_string) ent.item->id;
 		other.client.pickup_msg_time = level.time + 3s;
 
@@ -95,7 +95,7 @@ void Touch_Item(entity &ent, entity &other, vector, const surface &)
 			other.client.ps.stats[STAT_SELECTED_ITEM] = other.client.pers.selected_item = ent.item->id;
 
 		if (ent.item->pickup_sound)
-			gi.sound(other, CHAN_ITEM, gi.soundindex(ent.item->pickup_sound));
+			gi.sound(other, CHAN_ITEM, ent.item->get_pickup_sound());
 	}
 
 	if (!(ent.spawnflags & ITEM_TARGETS_USED))
@@ -137,7 +137,7 @@ static void drop_make_touchable(entity &ent)
 	if (deathmatch)
 	{
 #endif
-		ent.nextthink = level.time + 29s;
+		ent.set_nextthink(level.time + 29s);
 		ent.think = SAVABLE(G_FreeEdict);
 #ifdef SINGLE_PLAYER
 	}
@@ -161,7 +161,7 @@ entity &Drop_Item(entity &ent, const gitem_t &it)
 	dropped.bounds = bbox::sized(15.f);
 	gi.setmodel(dropped, it.world_model);
 	dropped.solid = SOLID_TRIGGER;
-	dropped.movetype = MOVETYPE_TOSS;
+	dropped.set_movetype(MOVETYPE_TOSS);
 	dropped.touch = SAVABLE(drop_temp_touch);
 	dropped.owner = ent;
 
@@ -186,7 +186,7 @@ entity &Drop_Item(entity &ent, const gitem_t &it)
 	dropped.velocity.z = 300.f;
 
 	dropped.think = SAVABLE(drop_make_touchable);
-	dropped.nextthink = level.time + 1s;
+	dropped.set_nextthink(level.time + 1s);
 
 	gi.linkentity(dropped);
 	return dropped;
@@ -223,7 +223,7 @@ void droptofloor(entity &ent)
 		gi.setmodel(ent, ent.item->world_model);
 
 	ent.solid = SOLID_TRIGGER;
-	ent.movetype = MOVETYPE_TOSS;
+	ent.set_movetype(MOVETYPE_TOSS);
 	ent.touch = SAVABLE(Touch_Item);
 
 	vector dest = ent.origin;
@@ -262,7 +262,7 @@ void droptofloor(entity &ent)
 
 		if (ent == ent.teammaster)
 		{
-			ent.nextthink = level.time + 1_hz;
+			ent.set_nextthink(level.time + 1_hz);
 			ent.think = SAVABLE(DoRespawn);
 		}
 	}
@@ -298,14 +298,10 @@ and for each item in each client's inventory.
 */
 void PrecacheItem(const gitem_t &it)
 {
-	if (it.pickup_sound)
-		gi.soundindex(it.pickup_sound);
-	if (it.world_model)
-		gi.modelindex(it.world_model);
-	if (it.view_model)
-		gi.modelindex(it.view_model);
-	if (it.icon)
-		gi.imageindex(it.icon);
+	it.get_pickup_sound();
+	it.get_world_model();
+	it.get_view_model();
+	it.get_icon();
 
 	// parse everything for its ammo
 	if (it.ammo && it.ammo != it.id)
@@ -315,24 +311,24 @@ void PrecacheItem(const gitem_t &it)
 	if (!it.precaches)
 		return;
 
-	size_t s_pos = 0;
+	tokenizer precaches(it.precaches);
 
-	while (true)
+	for (std::string_view token = precaches.next(); !token.empty(); token = precaches.next())
 	{
-		string v = strtok(it.precaches, s_pos);
-
-		if (!v)
-			break;
-
-		size_t v_len = strlen(v);
-
-		if (v_len >= MAX_QPATH || v_len < 5)
+		if (token.size() >= MAX_QPATH || token.size() < 5)
 		{
 			gi.dprintfmt("PrecacheItem: {} has bad precache string \"{}\"", it.classname, it.precaches);
 			break;
 		}
 
-		string ext = substr(v, v_len - 3);
+		// the index functions want it terminated
+		stringarray<MAX_QPATH> name;
+		memcpy(name.data(), token.data(), token.size());
+		name[token.size()] = 0;
+
+		const stringlit v = name;
+
+		const std::string_view ext = token.substr(token.size() - 3);
 
 		// determine type based on extension
 		if (ext == "md2" || ext == "sp2")
@@ -365,7 +361,7 @@ entity_type ET_ITEM("item");
 
 void SpawnItem(entity &ent, const gitem_t &it)
 {
-	ent.type = it.type;
+	G_SetType(ent, it.type);
 
 	if (ent.spawnflags >= DROPPED_ITEM)
 	{
@@ -434,7 +430,7 @@ void SpawnItem(entity &ent, const gitem_t &it)
 #endif
 
 	ent.item = it;
-	ent.nextthink = level.time + 2_hz;    // items start after other solids
+	ent.set_nextthink(level.time + 2_hz);    // items start after other solids
 	ent.think = SAVABLE(droptofloor);
 	ent.effects = it.world_model_flags;
 	ent.renderfx = RF_GLOW;
@@ -8,6 +8,7 @@
 #include "health.h"
 #include "entity.h"
 #include "lib/gi.h"
+#include "lib/types/map.h"
 
 #ifdef GRAPPLE
 #include "game/ctf/grapple.h"
@@ -1386,17 +1387,81 @@ const array<gitem_t, ITEM_TOTAL> &item_list()
 	return itemlist;
 }
 
+// classname -> item, filled in by InitItems
+static imap<gitem_id> items_by_classname;
+
 void InitItems()
 {
+	items_by_classname.clear();
+
 	for (auto &it : itemlist)
 	{
 		it.id = (gitem_id)(&it - itemlist.data());
 
 		if (it.classname)
+		{
 			it.type = *gi.TagNew<entity_type>(TAG_GAME, it.classname, ET_ITEM);
+			// first one wins, same as the old linear search
+			items_by_classname.try_emplace(it.classname, it.id);
+		}
+	}
+}
+
+itemref FindItemByClassname(const stringref &classname)
+{
+	if (!classname)
+		return nullptr;
+
+	auto it = items_by_classname.find((stringlit) classname);
+
+	if (it == items_by_classname.end())
+		return nullptr;
+
+	return itemlist[it->second];
+}
+
+void ClearItemIndices()
+{
+	for (auto &it : itemlist)
+	{
+		it.pickup_sound_index = SOUND_NONE;
+		it.world_model_index = it.view_model_index = MODEL_NONE;
+		it.icon_index = IMAGE_NONE;
 	}
 }
 
+sound_index gitem_t::get_pickup_sound() const
+{
+	if (!pickup_sound_index && pickup_sound)
+		pickup_sound_index = gi.soundindex(pickup_sound);
+
+	return pickup_sound_index;
+}
+
+model_index gitem_t::get_world_model() const
+{
+	if (!world_model_index && world_model)
+		world_model_index = gi.modelindex(world_model);
+
+	return world_model_index;
+}
+
+model_index gitem_t::get_view_model() const
+{
+	if (!view_model_index && view_model)
+		view_model_index = gi.modelindex(view_model);
+
+	return view_model_index;
+}
+
+image_index gitem_t::get_icon() const
+{
+	if (!icon_index && icon)
+		icon_index = gi.imageindex(icon);
+
+	return icon_index;
+}
+
 void InitVWeps()
 {
 	constexpr size_t MAX_VWEPS = 19;
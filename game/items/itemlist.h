@@ -243,6 +243,22 @@ struct gitem_t
 	uint8_t		vwep_id;
 	// entity type
 	entity_type_ref	type;
+
+	// asset indices; resolved by PrecacheItem or on first use,
+	// and forgotten on level change by ClearItemIndices
+	mutable sound_index	pickup_sound_index;
+	mutable model_index	world_model_index;
+	mutable model_index	view_model_index;
+	mutable image_index	icon_index;
+
+	// fetch the index of pickup_sound
+	sound_index get_pickup_sound() const;
+	// fetch the index of world_model
+	model_index get_world_model() const;
+	// fetch the index of view_model
+	model_index get_view_model() const;
+	// fetch the index of icon
+	image_index get_icon() const;
 };
 
 // thrown on an invalid item dereference
@@ -341,14 +357,7 @@ inline const gitem_t &GetItemByIndex(const gitem_id &id)
 FindItemByClassname
 ===============
 */
-inline itemref FindItemByClassname(const stringref &classname)
-{
-	for (const gitem_t &item : item_list())
-		if (striequals(item.classname, classname))
-			return item;
-
-	return nullptr;
-}
+itemref FindItemByClassname(const stringref &classname);
 
 /*
 ===============
@@ -366,4 +375,7 @@ inline itemref FindItem(const stringref &pickup_name)
 
 void InitItems();
 
+// forget the asset indices cached on every item
+void ClearItemIndices();
+
 void InitVWeps();
\ No newline at end of file
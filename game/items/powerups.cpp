@@ -184,10 +184,10 @@ bool Pickup_Powerup(entity &ent, entity &other)
 		if (ent.spawnflags & DROPPED_PLAYER_ITEM)
 		{
 			if (ent.item->use == Use_Quad)
-				quad_drop_timeout_hack = ent.nextthink - level.time;
+				quad_drop_timeout_hack = ent.get_nextthink() - level.time;
 #ifdef THE_RECKONING
 			else if (ent.item->use == Use_QuadFire)
-				quad_fire_drop_timeout_hack = ent.nextthink - level.time;
+				quad_fire_drop_timeout_hack = ent.get_nextthink() - level.time;
 #endif
 		}
 
@@ -10,6 +10,7 @@
 #include "lib/math/random.h"
 #include "lib/string/format.h"
 #include "combat.h"
+#include "think.h"
 #include <ctime>
 
 /*QUAKED func_group (0 0 0) ?
@@ -58,12 +59,12 @@ gibs
 static void gib_think(entity &self)
 {
 	self.frame++;
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 
 	if (self.frame == 10)
 	{
 		self.think = SAVABLE(G_FreeEdict);
-		self.nextthink = level.time + random(8s, 18s);
+		self.set_nextthink(level.time + random(8s, 18s));
 	}
 }
 
@@ -89,7 +90,7 @@ void gib_touch(entity &self, entity &, vector normal, const surface &)
 		{
 			self.frame++;
 			self.think = SAVABLE(gib_think);
-			self.nextthink = level.time + 100ms;
+			self.set_nextthink(level.time + 100ms);
 		}
 	}
 }
@@ -122,13 +123,13 @@ entity &ThrowGib(entity &self, stringlit gibname, int32_t damage, gib_type type)
 
 	if (type == GIB_ORGANIC)
 	{
-		gib.movetype = MOVETYPE_TOSS;
+		gib.set_movetype(MOVETYPE_TOSS);
 		gib.touch = SAVABLE(gib_touch);
 		vscale = 0.5f;
 	}
 	else
 	{
-		gib.movetype = MOVETYPE_BOUNCE;
+		gib.set_movetype(MOVETYPE_BOUNCE);
 		vscale = 1.0f;
 	}
 
@@ -138,7 +139,7 @@ entity &ThrowGib(entity &self, stringlit gibname, int32_t damage, gib_type type)
 	gib.angles = randomv({ 360, 360, 360 });
 
 	gib.think = SAVABLE(G_FreeEdict);
-	gib.nextthink = level.time + random(10s, 20s);
+	gib.set_nextthink(level.time + random(10s, 20s));
 
 	gi.linkentity(gib);
 
@@ -166,13 +167,13 @@ void ThrowHead(entity &self, stringlit gibname, int32_t damage, gib_type type)
 
 	if (type == GIB_ORGANIC)
 	{
-		self.movetype = MOVETYPE_TOSS;
+		self.set_movetype(MOVETYPE_TOSS);
 		self.touch = SAVABLE(gib_touch);
 		vscale = 0.5f;
 	}
 	else
 	{
-		self.movetype = MOVETYPE_BOUNCE;
+		self.set_movetype(MOVETYPE_BOUNCE);
 		vscale = 1.0f;
 	}
 
@@ -182,7 +183,7 @@ void ThrowHead(entity &self, stringlit gibname, int32_t damage, gib_type type)
 	self.avelocity[YAW] = crandom(600.f);
 
 	self.think = SAVABLE(G_FreeEdict);
-	self.nextthink = level.time + random(10s, 20s);
+	self.set_nextthink(level.time + random(10s, 20s));
 
 	gi.linkentity(self);
 }
@@ -216,7 +217,7 @@ void ThrowClientHead(entity &self, int32_t damage)
 	self.sound = SOUND_NONE;
 	self.flags |= FL_NO_KNOCKBACK;
 
-	self.movetype = MOVETYPE_BOUNCE;
+	self.set_movetype(MOVETYPE_BOUNCE);
 	self.velocity += VelocityForDamage(damage);
 
 	if (self.is_client)
@@ -227,7 +228,7 @@ void ThrowClientHead(entity &self, int32_t damage)
 	else
 	{
 		self.think = nullptr;
-		self.nextthink = gtime::zero();
+		self.set_nextthink(gtime::zero());
 	}
 
 	gi.linkentity(self);
@@ -245,12 +246,12 @@ void ThrowDebris(entity &self, stringlit modelname, float speed, vector origin)
 	gi.setmodel(chunk, modelname);
 	vector v = { crandom(100.f), crandom(100.f), random(200.f) };
 	chunk.velocity = self.velocity + (speed * v);
-	chunk.movetype = MOVETYPE_BOUNCE;
+	chunk.set_movetype(MOVETYPE_BOUNCE);
 	chunk.solid = SOLID_NOT;
 	chunk.avelocity = crandomv({ 600, 600, 600 });
 	chunk.angles = randomv({ 360, 360, 360 });
 	chunk.think = SAVABLE(G_FreeEdict);
-	chunk.nextthink = level.time + random(5s, 10s);
+	chunk.set_nextthink(level.time + random(5s, 10s));
 	chunk.frame = 0;
 	chunk.flags = FL_NONE;
 	chunk.takedamage = true;
@@ -277,7 +278,7 @@ static void path_corner_touch(entity &self, entity &other, vector , const surfac
 
 	if (self.pathtarget)
 	{
-		string savetarget = self.target;
+		atom savetarget = self.target;
 		self.target = self.pathtarget;
 		G_UseTargets(self, other);
 		self.target = savetarget;
@@ -303,15 +304,15 @@ static void path_corner_touch(entity &self, entity &other, vector , const surfac
 #ifdef SINGLE_PLAYER
 	if (self.wait != gtimef::zero())
 	{
-		other.monsterinfo.pause_time = duration_cast<gtime>(level.time + self.wait);
-		other.monsterinfo.stand(other);
+		other.monsterinfo->pause_time = duration_cast<gtime>(level.time + self.wait);
+		other.monsterinfo->stand(other);
 		return;
 	}
 
 	if (!other.movetarget.has_value())
 	{
-		other.monsterinfo.pause_time = gtime::max();
-		other.monsterinfo.stand(other);
+		other.monsterinfo->pause_time = gtime::max();
+		other.monsterinfo->stand(other);
 	}
 	else
 	{
@@ -367,9 +368,9 @@ static void point_combat_touch(entity &self, entity &other, vector, const surfac
 	}
 	else if ((self.spawnflags & 1) && !(other.flags & (FL_SWIM | FL_FLY)))
 	{
-		other.monsterinfo.pause_time = gtime::max();
-		other.monsterinfo.aiflags |= AI_STAND_GROUND;
-		other.monsterinfo.stand(other);
+		other.monsterinfo->pause_time = gtime::max();
+		other.monsterinfo->aiflags |= AI_STAND_GROUND;
+		other.monsterinfo->stand(other);
 	}
 
 	if (other.movetarget == self)
@@ -377,12 +378,12 @@ static void point_combat_touch(entity &self, entity &other, vector, const surfac
 		other.target = nullptr;
 		other.movetarget = null_entity;
 		other.goalentity = other.enemy;
-		other.monsterinfo.aiflags &= ~AI_COMBAT_POINT;
+		other.monsterinfo->aiflags &= ~AI_COMBAT_POINT;
 	}
 
 	if (self.pathtarget)
 	{
-		string savetarget = self.target;
+		atom savetarget = self.target;
 		self.target = self.pathtarget;
 		if (other.enemy.has_value() && other.enemy->is_client)
 			cactivator = other.enemy;
@@ -529,7 +530,7 @@ REGISTER_STATIC_SAVABLE(func_wall_use);
 
 static void SP_func_wall(entity &self)
 {
-	self.movetype = MOVETYPE_PUSH;
+	self.set_movetype(MOVETYPE_PUSH);
 	gi.setmodel(self, self.model);
 
 	if (self.spawnflags & WALL_ANIMATED)
@@ -595,7 +596,7 @@ REGISTER_STATIC_SAVABLE(func_object_touch);
 
 static void func_object_release(entity &self)
 {
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.touch = SAVABLE(func_object_touch);
 }
 
@@ -629,14 +630,14 @@ static void SP_func_object(entity &self)
 	if (self.spawnflags == 0)
 	{
 		self.solid = SOLID_BSP;
-		self.movetype = MOVETYPE_PUSH;
+		self.set_movetype(MOVETYPE_PUSH);
 		self.think = SAVABLE(func_object_release);
-		self.nextthink = level.time + 2_hz;
+		self.set_nextthink(level.time + 2_hz);
 	}
 	else
 	{
 		self.solid = SOLID_NOT;
-		self.movetype = MOVETYPE_PUSH;
+		self.set_movetype(MOVETYPE_PUSH);
 		self.use = SAVABLE(func_object_use);
 		self.svflags |= SVF_NOCLIENT;
 	}
@@ -804,7 +805,7 @@ static void SP_func_explosive(entity &self)
 		return;
 	}
 
-	self.movetype = MOVETYPE_PUSH;
+	self.set_movetype(MOVETYPE_PUSH);
 
 	gi.modelindex("models/objects/debris1/tris.md2");
 	gi.modelindex("models/objects/debris2/tris.md2");
@@ -940,7 +941,7 @@ REGISTER_STATIC_SAVABLE(barrel_explode);
 static void barrel_delay(entity &self, entity &, entity &attacker, int, vector)
 {
 	self.takedamage = false;
-	self.nextthink = level.time + 20ms;
+	self.set_nextthink(level.time + 20ms);
 	self.think = SAVABLE(barrel_explode);
 	self.activator = attacker;
 }
@@ -956,7 +957,7 @@ static void barrel_think(entity &self)
 {
 	// the think needs to be first since later stuff may override.
 	self.think = SAVABLE(barrel_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 
 	M_CatagorizePosition (self);
 	self.flags |= FL_IMMUNE_SLIME;
@@ -968,7 +969,7 @@ static void barrel_start(entity &self)
 {
 	M_droptofloor(self);
 	self.think = SAVABLE(barrel_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(barrel_start);
@@ -990,7 +991,7 @@ static void SP_misc_explobox(entity &self)
 	gi.modelindex("models/objects/debris3/tris.md2");
 
 	self.solid = SOLID_BBOX;
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 
 	self.model = "models/objects/barrels/tris.md2";
 	self.modelindex = gi.modelindex(self.model);
@@ -1008,7 +1009,8 @@ static void SP_misc_explobox(entity &self)
 
 	self.die = SAVABLE(barrel_delay);
 	self.takedamage = true;
-	self.monsterinfo.aiflags = AI_NOSTEP;
+	self.monsterinfo.emplace();
+	self.monsterinfo->aiflags = AI_NOSTEP;
 
 	self.touch = SAVABLE(barrel_touch);
 
@@ -1017,7 +1019,7 @@ static void SP_misc_explobox(entity &self)
 #else
 	self.think = SAVABLE(M_droptofloor);
 #endif
-	self.nextthink = level.time + 2_hz;
+	self.set_nextthink(level.time + 2_hz);
 
 	gi.linkentity(self);
 }
@@ -1042,11 +1044,11 @@ REGISTER_STATIC_SAVABLE(misc_blackhole_use);
 static void misc_blackhole_think(entity &self)
 {
 	if (++self.frame < 19)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else
 	{
 		self.frame = 0;
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -1054,7 +1056,7 @@ REGISTER_STATIC_SAVABLE(misc_blackhole_think);
 
 static void SP_misc_blackhole(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_NOT;
 	ent.bounds = {
 		.mins = { -64, -64, 0 },
@@ -1064,7 +1066,7 @@ static void SP_misc_blackhole(entity &ent)
 	ent.renderfx = RF_TRANSLUCENT;
 	ent.use = SAVABLE(misc_blackhole_use);
 	ent.think = SAVABLE(misc_blackhole_think);
-	ent.nextthink = level.time + 2_hz;
+	ent.set_nextthink(level.time + 2_hz);
 	gi.linkentity(ent);
 }
 
@@ -1076,11 +1078,11 @@ static REGISTER_ENTITY(MISC_BLACKHOLE, misc_blackhole);
 static void misc_eastertank_think(entity &self)
 {
 	if (++self.frame < 293)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else
 	{
 		self.frame = 254;
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -1088,7 +1090,7 @@ REGISTER_STATIC_SAVABLE(misc_eastertank_think);
 
 static void SP_misc_eastertank(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = {
 		.mins = { -32, -32, -16 },
@@ -1097,7 +1099,7 @@ static void SP_misc_eastertank(entity &ent)
 	ent.modelindex = gi.modelindex("models/monsters/tank/tris.md2");
 	ent.frame = 254;
 	ent.think = SAVABLE(misc_eastertank_think);
-	ent.nextthink = level.time + 2_hz;
+	ent.set_nextthink(level.time + 2_hz);
 	gi.linkentity(ent);
 }
 
@@ -1108,11 +1110,11 @@ static REGISTER_ENTITY(MISC_EASTERTANK, misc_eastertank);
 static void misc_easterchick_think(entity &self)
 {
 	if (++self.frame < 247)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else
 	{
 		self.frame = 208;
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -1120,7 +1122,7 @@ REGISTER_STATIC_SAVABLE(misc_easterchick_think);
 
 static void SP_misc_easterchick(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = {
 		.mins = { -32, -32, 0 },
@@ -1129,7 +1131,7 @@ static void SP_misc_easterchick(entity &ent)
 	ent.modelindex = gi.modelindex("models/monsters/bitch/tris.md2");
 	ent.frame = 208;
 	ent.think = SAVABLE(misc_easterchick_think);
-	ent.nextthink = level.time + 2_hz;
+	ent.set_nextthink(level.time + 2_hz);
 	gi.linkentity(ent);
 }
 
@@ -1140,11 +1142,11 @@ static REGISTER_ENTITY(MISC_EASTERCHICK, misc_easterchick);
 static void misc_easterchick2_think(entity &self)
 {
 	if (++self.frame < 287)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else
 	{
 		self.frame = 248;
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -1152,7 +1154,7 @@ REGISTER_STATIC_SAVABLE(misc_easterchick2_think);
 
 static void SP_misc_easterchick2(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = {
 		.mins = { -32, -32, 0 },
@@ -1161,7 +1163,7 @@ static void SP_misc_easterchick2(entity &ent)
 	ent.modelindex = gi.modelindex("models/monsters/bitch/tris.md2");
 	ent.frame = 248;
 	ent.think = SAVABLE(misc_easterchick2_think);
-	ent.nextthink = level.time + 2_hz;
+	ent.set_nextthink(level.time + 2_hz);
 	gi.linkentity(ent);
 }
 
@@ -1174,9 +1176,9 @@ There should be a item_commander_head that has this as it's target.
 static void commander_body_think(entity &self)
 {
 	if (++self.frame < 24)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else
-		self.nextthink = gtime::zero();
+		self.set_nextthink(gtime::zero());
 
 	if (self.frame == 22)
 		gi.sound(self, CHAN_BODY, gi.soundindex("tank/thud.wav"));
@@ -1187,7 +1189,7 @@ REGISTER_STATIC_SAVABLE(commander_body_think);
 static void commander_body_use(entity &self, entity &, entity &)
 {
 	self.think = SAVABLE(commander_body_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	gi.sound(self, CHAN_BODY, gi.soundindex("tank/pain.wav"));
 }
 
@@ -1195,7 +1197,7 @@ REGISTER_STATIC_SAVABLE(commander_body_use);
 
 static void commander_body_drop(entity &self)
 {
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.origin[2] += 2;
 }
 
@@ -1203,7 +1205,7 @@ REGISTER_STATIC_SAVABLE(commander_body_drop);
 
 static void SP_monster_commander_body(entity &self)
 {
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.solid = SOLID_BBOX;
 	self.model = "models/monsters/commandr/tris.md2";
 	self.modelindex = gi.modelindex(self.model);
@@ -1221,7 +1223,7 @@ static void SP_monster_commander_body(entity &self)
 	gi.soundindex("tank/pain.wav");
 
 	self.think = SAVABLE(commander_body_drop);
-	self.nextthink = level.time + 5_hz;
+	self.set_nextthink(level.time + 5_hz);
 }
 
 static REGISTER_ENTITY(MONSTER_COMMANDER_BODY, monster_commander_body);
@@ -1233,21 +1235,21 @@ The banner is 128 tall.
 static void misc_banner_think(entity &ent)
 {
 	ent.frame = (ent.frame + 1) % 16;
-	ent.nextthink = level.time + 100ms;
+	ent.set_nextthink(level.time + 100ms);
 }
 
 REGISTER_STATIC_SAVABLE(misc_banner_think);
 
 static void SP_misc_banner(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_NOT;
 	ent.modelindex = gi.modelindex("models/objects/banner/tris.md2");
 	ent.frame = Q_rand() % 16;
 	gi.linkentity(ent);
 
 	ent.think = SAVABLE(misc_banner_think);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 }
 
 static REGISTER_ENTITY(MISC_BANNER, misc_banner);
@@ -1284,7 +1286,7 @@ static void SP_misc_deadsoldier(entity &ent)
 		return;
 	}
 
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.modelindex = gi.modelindex("models/deadbods/dude/tris.md2");
 
@@ -1310,7 +1312,8 @@ static void SP_misc_deadsoldier(entity &ent)
 	ent.takedamage = true;
 	ent.svflags |= SVF_MONSTER | SVF_DEADMONSTER;
 	ent.die = SAVABLE(misc_deadsoldier_die);
-	ent.monsterinfo.aiflags |= AI_GOOD_GUY;
+	ent.monsterinfo.emplace();
+	ent.monsterinfo->aiflags |= AI_GOOD_GUY;
 
 	gi.linkentity(ent);
 }
@@ -1348,7 +1351,7 @@ static void SP_misc_viper(entity &ent)
 	if (!ent.speed)
 		ent.speed = 300.f;
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_NOT;
 	ent.modelindex = gi.modelindex("models/ships/viper/tris.md2");
 	ent.bounds = {
@@ -1357,10 +1360,11 @@ static void SP_misc_viper(entity &ent)
 	};
 
 	ent.think = SAVABLE(func_train_find);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.use = SAVABLE(misc_viper_use);
 	ent.svflags |= SVF_NOCLIENT;
-	ent.moveinfo.accel = ent.moveinfo.decel = ent.moveinfo.speed = ent.speed;
+	ent.moveinfo.emplace();
+	ent.moveinfo->accel = ent.moveinfo->decel = ent.moveinfo->speed = ent.speed;
 
 	gi.linkentity(ent);
 }
@@ -1372,7 +1376,7 @@ This is a large stationary viper as seen in Paul's intro
 */
 static void SP_misc_bigviper(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = {
 		.mins = { -176, -120, -24 },
@@ -1406,7 +1410,7 @@ static void misc_viper_bomb_prethink(entity &self)
 	if (diff < -1.0f)
 		diff = -1.0f;
 
-	vector v = self.moveinfo.dir * (1.0f + diff);
+	vector v = self.moveinfo->dir * (1.0f + diff);
 	v.z = diff;
 
 	diff = self.angles[2];
@@ -1422,23 +1426,25 @@ static void misc_viper_bomb_use(entity &self, entity &, entity &cactivator)
 	self.svflags &= ~SVF_NOCLIENT;
 	self.effects |= EF_ROCKET;
 	self.use = nullptr;
-	self.movetype = MOVETYPE_TOSS;
-	self.prethink = SAVABLE(misc_viper_bomb_prethink);
+	self.set_movetype(MOVETYPE_TOSS);
+	self.set_prethink(SAVABLE(misc_viper_bomb_prethink));
+	G_UpdateIdle(self);
 	self.touch = SAVABLE(misc_viper_bomb_touch);
 	self.activator = cactivator;
 
 	entityref viper = G_FindEquals<&entity::type>(world, ET_MISC_VIPER);
-	self.velocity = viper->moveinfo.dir * viper->moveinfo.speed;
+	self.velocity = viper->moveinfo->dir * viper->moveinfo->speed;
 
 	self.timestamp = level.time;
-	self.moveinfo.dir = viper->moveinfo.dir;
+	self.moveinfo.emplace();
+	self.moveinfo->dir = viper->moveinfo->dir;
 }
 
 REGISTER_STATIC_SAVABLE(misc_viper_bomb_use);
 
 static void SP_misc_viper_bomb(entity &self)
 {
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.solid = SOLID_NOT;
 	self.bounds = bbox::sized(8.f);
 
@@ -1483,7 +1489,7 @@ static void SP_misc_strogg_ship(entity &ent)
 	if (!ent.speed)
 		ent.speed = 300.f;
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_NOT;
 	ent.modelindex = gi.modelindex("models/ships/strogg1/tris.md2");
 	ent.bounds = {
@@ -1492,10 +1498,11 @@ static void SP_misc_strogg_ship(entity &ent)
 	};
 
 	ent.think = SAVABLE(func_train_find);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.use = SAVABLE(misc_strogg_ship_use);
 	ent.svflags |= SVF_NOCLIENT;
-	ent.moveinfo.accel = ent.moveinfo.decel = ent.moveinfo.speed = ent.speed;
+	ent.moveinfo.emplace();
+	ent.moveinfo->accel = ent.moveinfo->decel = ent.moveinfo->speed = ent.speed;
 
 	gi.linkentity(ent);
 }
@@ -1508,7 +1515,7 @@ static void misc_satellite_dish_think(entity &self)
 {
 	self.frame++;
 	if (self.frame < 38)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 }
 
 REGISTER_STATIC_SAVABLE(misc_satellite_dish_think);
@@ -1517,14 +1524,14 @@ static void misc_satellite_dish_use(entity &self, entity &, entity &)
 {
 	self.frame = 0;
 	self.think = SAVABLE(misc_satellite_dish_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(misc_satellite_dish_use);
 
 static void SP_misc_satellite_dish(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = {
 		.mins = { -64, -64, 0 },
@@ -1541,7 +1548,7 @@ static REGISTER_ENTITY(MISC_SATELLITE_DISH, misc_satellite_dish);
 */
 static void SP_light_mine1(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.modelindex = gi.modelindex("models/objects/minelite/light1/tris.md2");
 	gi.linkentity(ent);
@@ -1553,7 +1560,7 @@ static REGISTER_ENTITY(LIGHT_MINE1, light_mine1);
 */
 static void SP_light_mine2(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.modelindex = gi.modelindex("models/objects/minelite/light2/tris.md2");
 	gi.linkentity(ent);
@@ -1571,12 +1578,14 @@ static void SP_misc_gib_arm(entity &ent)
 	ent.effects |= EF_GIB;
 	ent.takedamage = true;
 	ent.die = SAVABLE(gib_die);
-	ent.movetype = MOVETYPE_TOSS;
+	ent.set_movetype(MOVETYPE_TOSS);
+	// monster code expects anything with SVF_MONSTER to have a monsterinfo
 	ent.svflags |= SVF_MONSTER;
+	ent.monsterinfo.emplace();
 	ent.deadflag = true;
 	ent.avelocity = randomv({ 200, 200, 200 });
 	ent.think = SAVABLE(G_FreeEdict);
-	ent.nextthink = level.time + 30s;
+	ent.set_nextthink(level.time + 30s);
 	gi.linkentity(ent);
 }
 
@@ -1592,12 +1601,14 @@ static void SP_misc_gib_leg(entity &ent)
 	ent.effects |= EF_GIB;
 	ent.takedamage = true;
 	ent.die = SAVABLE(gib_die);
-	ent.movetype = MOVETYPE_TOSS;
+	ent.set_movetype(MOVETYPE_TOSS);
+	// monster code expects anything with SVF_MONSTER to have a monsterinfo
 	ent.svflags |= SVF_MONSTER;
+	ent.monsterinfo.emplace();
 	ent.deadflag = true;
 	ent.avelocity = randomv({ 200, 200, 200 });
 	ent.think = SAVABLE(G_FreeEdict);
-	ent.nextthink = level.time + 30s;
+	ent.set_nextthink(level.time + 30s);
 	gi.linkentity(ent);
 }
 
@@ -1613,12 +1624,14 @@ static void SP_misc_gib_head(entity &ent)
 	ent.effects |= EF_GIB;
 	ent.takedamage = true;
 	ent.die = SAVABLE(gib_die);
-	ent.movetype = MOVETYPE_TOSS;
+	ent.set_movetype(MOVETYPE_TOSS);
+	// monster code expects anything with SVF_MONSTER to have a monsterinfo
 	ent.svflags |= SVF_MONSTER;
+	ent.monsterinfo.emplace();
 	ent.deadflag = true;
 	ent.avelocity = randomv({ 200, 200, 200 });
 	ent.think = SAVABLE(G_FreeEdict);
-	ent.nextthink = level.time + 30s;
+	ent.set_nextthink(level.time + 30s);
 	gi.linkentity(ent);
 }
 
@@ -1633,7 +1646,7 @@ used with target_string (must be on same "team")
 
 static void SP_target_character(entity &self)
 {
-	self.movetype = MOVETYPE_PUSH;
+	self.set_movetype(MOVETYPE_PUSH);
 	gi.setmodel(self, self.model);
 	self.solid = SOLID_BSP;
 	self.frame = 12;
@@ -1728,7 +1741,7 @@ static void func_clock_think(entity &self)
 {
 	if (!self.enemy.has_value())
 	{
-		self.enemy = G_FindFunc<&entity::targetname>(world, self.target, striequals);
+		self.enemy = G_FindTargetname(world, self.target);
 		if (!self.enemy.has_value())
 			return;
 	}
@@ -1759,7 +1772,7 @@ static void func_clock_think(entity &self)
 	{
 		if (self.pathtarget)
 		{
-			string	savetarget = self.target;
+			atom	savetarget = self.target;
 			string	savemessage = self.message;
 			self.target = self.pathtarget;
 			self.message = nullptr;
@@ -1777,7 +1790,7 @@ static void func_clock_think(entity &self)
 			return;
 	}
 
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 }
 
 REGISTER_STATIC_SAVABLE(func_clock_think);
@@ -1820,7 +1833,7 @@ static void SP_func_clock(entity &self)
 	if (self.spawnflags & CLOCK_START_OFF)
 		self.use = SAVABLE(func_clock_use);
 	else
-		self.nextthink = level.time + 1s;
+		self.set_nextthink(level.time + 1s);
 }
 
 static REGISTER_ENTITY(FUNC_CLOCK, func_clock);
@@ -1836,7 +1849,7 @@ static void teleporter_touch(entity &self, entity &other, vector, const surface
 	if (!other.is_client)
 		return;
 
-	entityref dest = G_FindFunc<&entity::targetname>(world, self.target, striequals);
+	entityref dest = G_FindTargetname(world, self.target);
 
 	if (!dest.has_value())
 	{
@@ -96,7 +96,7 @@ void M_FliesOn(entity &self)
 	self.effects |= EF_FLIES;
 	self.sound = gi.soundindex("infantry/inflies1.wav");
 	self.think = SAVABLE(M_FliesOff);
-	self.nextthink = level.time + 1min;
+	self.set_nextthink(level.time + 1min);
 }
 
 REGISTER_SAVABLE(M_FliesOn);
@@ -110,7 +110,7 @@ void M_FlyCheck(entity &self)
 		return;
 
 	self.think = SAVABLE(M_FliesOn);
-	self.nextthink = level.time + random(5s, 15s);
+	self.set_nextthink(level.time + random(5s, 15s));
 }
 
 void M_CheckGround(entity &ent)
@@ -299,7 +299,7 @@ void M_SetEffects(entity &ent)
 	ent.effects &= ~(EF_COLOR_SHELL | EF_POWERSCREEN);
 	ent.renderfx &= ~(RF_SHELL_RED | RF_SHELL_GREEN | RF_SHELL_BLUE);
 
-	if (ent.monsterinfo.aiflags & AI_RESURRECTING) {
+	if (ent.monsterinfo->aiflags & AI_RESURRECTING) {
 		ent.effects |= EF_COLOR_SHELL;
 		ent.renderfx |= RF_SHELL_RED;
 	}
@@ -308,9 +308,9 @@ void M_SetEffects(entity &ent)
 		return;
 
 	if (ent.powerarmor_time > level.time) {
-		if (ent.monsterinfo.power_armor_type == ITEM_POWER_SCREEN) {
+		if (ent.monsterinfo->power_armor_type == ITEM_POWER_SCREEN) {
 			ent.effects |= EF_POWERSCREEN;
-		} else if (ent.monsterinfo.power_armor_type == ITEM_POWER_SHIELD) {
+		} else if (ent.monsterinfo->power_armor_type == ITEM_POWER_SHIELD) {
 			ent.effects |= EF_COLOR_SHELL;
 			ent.renderfx |= RF_SHELL_GREEN;
 		}
@@ -320,27 +320,27 @@ void M_SetEffects(entity &ent)
 	ent.effects &= ~(EF_DOUBLE | EF_QUAD | EF_PENT);
 	ent.renderfx &= ~RF_SHELL_DOUBLE;
 
-	if (ent.monsterinfo.quad_time > level.time)
+	if (ent.monsterinfo->quad_time > level.time)
 	{
-		gtime remaining = ent.monsterinfo.quad_time - level.time;
+		gtime remaining = ent.monsterinfo->quad_time - level.time;
 		if (remaining > 3s || (remaining % 8ms) >= 4ms)
 			ent.effects |= EF_QUAD;
 	}
 	else
 		ent.effects &= ~EF_QUAD;
 
-	if (ent.monsterinfo.double_time > level.time)
+	if (ent.monsterinfo->double_time > level.time)
 	{
-		gtime remaining = ent.monsterinfo.double_time - level.time;
+		gtime remaining = ent.monsterinfo->double_time - level.time;
 		if (remaining > 3s || (remaining % 8ms) >= 4ms)
 			ent.effects |= EF_DOUBLE;
 	}
 	else
 		ent.effects &= ~EF_DOUBLE;
 
-	if (ent.monsterinfo.invincible_time > level.time)
+	if (ent.monsterinfo->invincible_time > level.time)
 	{
-		gtime remaining = ent.monsterinfo.invincible_time - level.time;
+		gtime remaining = ent.monsterinfo->invincible_time - level.time;
 		if (remaining > 3s || (remaining % 8ms) >= 4ms)
 			ent.effects |= EF_PENT;
 	}
@@ -352,9 +352,9 @@ void M_SetEffects(entity &ent)
 #ifdef ROGUE_AI
 void cleanupHealTarget(entity &ent)
 {
-	ent.monsterinfo.healer = 0;
+	ent.monsterinfo->healer = 0;
 	ent.takedamage = true;
-	ent.monsterinfo.aiflags &= ~AI_RESURRECTING;
+	ent.monsterinfo->aiflags &= ~AI_RESURRECTING;
 	M_SetEffects (ent);
 }
 #endif
@@ -374,21 +374,21 @@ struct m_animparameters
 
 static void M_MoveFrame(entity &self)
 {
-	const mmove_t *move = self.monsterinfo.currentmove;
-	self.nextthink = level.time + 100ms;
+	const mmove_t *move = self.monsterinfo->currentmove;
+	self.set_nextthink(level.time + 100ms);
 
 	m_animparameters params { move };
 
-	if ((self.monsterinfo.nextframe) && (self.monsterinfo.nextframe >= params.start) && (self.monsterinfo.nextframe <= params.end)) {
-		self.frame = self.monsterinfo.nextframe;
-		self.monsterinfo.nextframe = 0;
+	if ((self.monsterinfo->nextframe) && (self.monsterinfo->nextframe >= params.start) && (self.monsterinfo->nextframe <= params.end)) {
+		self.frame = self.monsterinfo->nextframe;
+		self.monsterinfo->nextframe = 0;
 	} else {
 		if (self.frame == move->lastframe) {
 			if (move->endfunc) {
 				move->endfunc(self);
 
 				// regrab move, endfunc is very likely to change it
-				move = self.monsterinfo.currentmove;
+				move = self.monsterinfo->currentmove;
 				params = move;
 				
 				// check for death
@@ -398,10 +398,10 @@ static void M_MoveFrame(entity &self)
 		}
 
 		if (self.frame < params.start || self.frame > params.end) {
-			self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 			self.frame = move->firstframe;
 		} else {
-			if (!(self.monsterinfo.aiflags & AI_HOLD_FRAME)) {
+			if (!(self.monsterinfo->aiflags & AI_HOLD_FRAME)) {
 				if (params.reverse)
 				{
 					self.frame--;
@@ -425,8 +425,8 @@ static void M_MoveFrame(entity &self)
 	const mframe_t &frame = move->frames[index];
 	
 	if (frame.aifunc) {
-		if (!(self.monsterinfo.aiflags & AI_HOLD_FRAME))
-			frame.aifunc(self, frame.dist * self.monsterinfo.scale);
+		if (!(self.monsterinfo->aiflags & AI_HOLD_FRAME))
+			frame.aifunc(self, frame.dist * self.monsterinfo->scale);
 		else
 			frame.aifunc(self, 0);
 	}
@@ -468,16 +468,16 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 
 	// if we are a good guy monster and our attacker is a player
 	// or another good guy, do not get mad at them
-	if (targ.monsterinfo.aiflags & AI_GOOD_GUY)
+	if (targ.monsterinfo->aiflags & AI_GOOD_GUY)
 	{
-		if (attacker.is_client || (attacker.monsterinfo.aiflags & AI_GOOD_GUY))
+		if (attacker.is_client || (std::as_const(attacker.monsterinfo)->aiflags & AI_GOOD_GUY))
 			return;
 	}
 
 #ifdef GROUND_ZERO
 	// if we're currently mad at something a target_anger made us mad at, ignore
 	// damage
-	if (targ.enemy.has_value() && (targ.monsterinfo.aiflags & AI_TARGET_ANGER))
+	if (targ.enemy.has_value() && (targ.monsterinfo->aiflags & AI_TARGET_ANGER))
 	{
 		float	percentHealth;
 
@@ -491,13 +491,13 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 		}
 
 		// remove the target anger flag
-		targ.monsterinfo.aiflags &= ~AI_TARGET_ANGER;
+		targ.monsterinfo->aiflags &= ~AI_TARGET_ANGER;
 	}
 #endif
 
 #ifdef ROGUE_AI
 	// if we're healing someone, do like above and try to stay with them
-	if (targ.enemy.has_value() && (targ.monsterinfo.aiflags & AI_MEDIC))
+	if (targ.enemy.has_value() && (targ.monsterinfo->aiflags & AI_MEDIC))
 	{
 		float	percentHealth = (float) (targ.health) / (float) (targ.max_health);
 
@@ -506,7 +506,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 			return;
 
 		// remove the medic flag
-		targ.monsterinfo.aiflags &= ~AI_MEDIC;
+		targ.monsterinfo->aiflags &= ~AI_MEDIC;
 		cleanupHealTarget(targ.enemy);
 	}
 #endif
@@ -516,7 +516,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 	// if attacker is a client, get mad at them because he's good and we're not
 	if (attacker.is_client)
 	{
-		targ.monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+		targ.monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 		// this can only happen in coop (both new and old enemies are clients)
 		// only switch if can't see the current enemy
@@ -530,7 +530,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 			targ.oldenemy = targ.enemy;
 		}
 		targ.enemy = attacker;
-		if (!(targ.monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ.monsterinfo->aiflags & AI_DUCKED))
 			FoundTarget(targ);
 		return;
 	}
@@ -540,8 +540,8 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 	if (((targ.flags & (FL_FLY | FL_SWIM)) == (attacker.flags & (FL_FLY | FL_SWIM))) &&
 		!targ.type.is_exact(attacker.type) &&
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-		!(attacker.monsterinfo.aiflags & AI_IGNORE_SHOTS) &&
-		!(targ.monsterinfo.aiflags & AI_IGNORE_SHOTS))
+		!(std::as_const(attacker.monsterinfo)->aiflags & AI_IGNORE_SHOTS) &&
+		!(targ.monsterinfo->aiflags & AI_IGNORE_SHOTS))
 #else
 		(attacker.type != ET_MONSTER_TANK) &&
 		(attacker.type != ET_MONSTER_SUPERTANK) &&
@@ -552,7 +552,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 		if (targ.enemy.has_value() && targ.enemy->is_client)
 			targ.oldenemy = targ.enemy;
 		targ.enemy = attacker;
-		if (!(targ.monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ.monsterinfo->aiflags & AI_DUCKED))
 			FoundTarget(targ);
 	}
 	// if they *meant* to shoot us, then shoot back
@@ -561,7 +561,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 		if (targ.enemy.has_value() && targ.enemy->is_client)
 			targ.oldenemy = targ.enemy;
 		targ.enemy = attacker;
-		if (!(targ.monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ.monsterinfo->aiflags & AI_DUCKED))
 			FoundTarget(targ);
 	}
 	// otherwise get mad at whoever they are mad at (help our buddy) unless it is us!
@@ -570,7 +570,7 @@ inline void M_HandleDamage(entity &targ, entity &attacker, entity &inflictor [[m
 		if (targ.enemy.has_value() && targ.enemy->is_client)
 			targ.oldenemy = targ.enemy;
 		targ.enemy = attacker.enemy;
-		if (!(targ.monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ.monsterinfo->aiflags & AI_DUCKED))
 			FoundTarget(targ);
 	}
 }
@@ -581,16 +581,85 @@ void M_ReactToDamage(entity &targ, entity &attacker, entity &inflictor, int32_t
 	M_HandleDamage(targ, attacker, inflictor);
 
 	// Call custom reaction function
-	if (targ.monsterinfo.reacttodamage)
-		targ.monsterinfo.reacttodamage(targ, attacker, inflictor, knockback, take);
+	if (targ.monsterinfo->reacttodamage)
+		targ.monsterinfo->reacttodamage(targ, attacker, inflictor, knockback, take);
+}
+
+static dormancy_stats dormancy;
+
+const dormancy_stats &M_DormancyStats()
+{
+	return dormancy;
+}
+
+void M_ResetDormancyStats()
+{
+	dormancy = {};
+}
+
+void M_Wake(entity &self, dormancy_wake reason)
+{
+	if (!std::as_const(self.monsterinfo)->dormant)
+		return;
+
+	self.monsterinfo->dormant = false;
+	self.set_nextthink(level.time);
+	dormancy.wakes[reason]++;
+}
+
+/*
+=================
+M_CheckDormant
+
+Decide whether the monster should spend this think idling, going
+dormant or waking up as need be.
+=================
+*/
+static bool M_CheckDormant(entity &self)
+{
+	const bool idle = g_ai_dormancy && !self.enemy.has_value() && self.health > 0 && !self.deadflag && !AI_ClientInPVS(self);
+
+	if (!idle)
+	{
+		if (self.monsterinfo->dormant)
+		{
+			self.monsterinfo->dormant = false;
+			dormancy.wakes[WAKE_SIGHT]++;
+		}
+
+		return false;
+	}
+
+	if (!self.monsterinfo->dormant)
+	{
+		self.monsterinfo->dormant = true;
+		self.monsterinfo->dormant_tick_time = level.time;
+		dormancy.sleeps++;
+	}
+
+	return true;
 }
 
 void monster_think(entity &self)
 {
-	M_MoveFrame(self);
-	if (self.linkcount != self.monsterinfo.linkcount)
+	if (M_CheckDormant(self))
 	{
-		self.monsterinfo.linkcount = self.linkcount;
+		// keep checking every frame, so that nobody walks in on a frozen
+		// monster; everything else waits for the slow tick
+		self.set_nextthink(level.time + 1_hz);
+
+		if (level.time < self.monsterinfo->dormant_tick_time)
+			return;
+
+		self.monsterinfo->dormant_tick_time = level.time + MONSTER_DORMANT_TICK;
+		dormancy.idle_ticks++;
+	}
+	else
+		M_MoveFrame(self);
+
+	if (self.linkcount != self.monsterinfo->linkcount)
+	{
+		self.monsterinfo->linkcount = self.linkcount;
 		M_CheckGround(self);
 	}
 	M_CatagorizePosition(self);
@@ -602,13 +671,15 @@ REGISTER_SAVABLE(monster_think);
 
 void monster_use(entity &self, entity &, entity &cactivator)
 {
+	M_Wake(self, WAKE_USE);
+
 	if (self.enemy.has_value())
 		return;
 	if (self.health <= 0)
 		return;
 	if (cactivator.flags & FL_NOTARGET)
 		return;
-	if (!(cactivator.is_client) && !(cactivator.monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(cactivator.is_client) && !(std::as_const(cactivator.monsterinfo)->aiflags & AI_GOOD_GUY))
 		return;
 #ifdef GROUND_ZERO
 	if (cactivator.flags & FL_DISGUISED)
@@ -631,7 +702,7 @@ static void monster_triggered_spawn(entity &self)
 	KillBox(self);
 
 	self.solid = SOLID_BBOX;
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.svflags &= ~SVF_NOCLIENT;
 	self.air_finished_time = level.time + 12s;
 	gi.linkentity(self);
@@ -671,7 +742,7 @@ static void monster_triggered_spawn_use(entity &self, entity &, entity &cactivat
 {
 	// we have a one frame delay here so we don't telefrag the guy who activated us
 	self.think = SAVABLE(monster_triggered_spawn);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	if (cactivator.is_client)
 		self.enemy = cactivator;
 	self.use = SAVABLE(monster_use);
@@ -682,16 +753,16 @@ REGISTER_STATIC_SAVABLE(monster_triggered_spawn_use);
 static void monster_triggered_start(entity &self)
 {
 	self.solid = SOLID_NOT;
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.svflags |= SVF_NOCLIENT;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	self.use = SAVABLE(monster_triggered_spawn_use);
 }
 
 void monster_death_use(entity &self)
 {
 	self.flags &= ~(FL_FLY | FL_SWIM);
-	self.monsterinfo.aiflags &= AI_GOOD_GUY;
+	self.monsterinfo->aiflags &= AI_GOOD_GUY;
 
 	if (self.item) {
 		Drop_Item(self, self.item);
@@ -727,16 +798,16 @@ static bool monster_start(entity &self)
 		return false;
 	}
 
-	if ((self.spawnflags & (spawn_flag)4) && !(self.monsterinfo.aiflags & AI_GOOD_GUY))
+	if ((self.spawnflags & (spawn_flag)4) && !(self.monsterinfo->aiflags & AI_GOOD_GUY))
 	{
 		self.spawnflags &= ~(spawn_flag)4;
 		self.spawnflags |= (spawn_flag)1;
 	}
 
-	if (!(self.monsterinfo.aiflags & AI_GOOD_GUY_MASK))
+	if (!(self.monsterinfo->aiflags & AI_GOOD_GUY_MASK))
 		level.total_monsters++;
 
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	self.svflags |= SVF_MONSTER;
 	self.renderfx |= RF_FRAMELERP;
 	self.takedamage = true;
@@ -748,8 +819,8 @@ static bool monster_start(entity &self)
 	self.deadflag = false;
 	self.svflags &= ~SVF_DEADMONSTER;
 
-	if (!self.monsterinfo.checkattack)
-		self.monsterinfo.checkattack = SAVABLE(M_CheckAttack);
+	if (!self.monsterinfo->checkattack)
+		self.monsterinfo->checkattack = SAVABLE(M_CheckAttack);
 	self.old_origin = self.origin;
 
 	if (st.item)
@@ -760,21 +831,21 @@ static bool monster_start(entity &self)
 	}
 
 	// randomize what frame they start on
-	const mmove_t *move = self.monsterinfo.currentmove;
+	const mmove_t *move = self.monsterinfo->currentmove;
 
 	if (move)
 		self.frame = move->firstframe + (Q_rand() % (move->lastframe - move->firstframe + 1));
 
 #ifdef ROGUE_AI
 	// PMM - get this so I don't have to do it in all of the monsters
-	self.monsterinfo.base_height = self.bounds.maxs[2];
+	self.monsterinfo->base_height = self.bounds.maxs[2];
 #endif
 
 #ifdef GROUND_ZERO
 	// PMM - clear these
-	self.monsterinfo.quad_time = gtime::zero();
-	self.monsterinfo.double_time = gtime::zero();
-	self.monsterinfo.invincible_time = gtime::zero();
+	self.monsterinfo->quad_time = gtime::zero();
+	self.monsterinfo->double_time = gtime::zero();
+	self.monsterinfo->invincible_time = gtime::zero();
 #endif
 
 	// call pain to set up pain skin
@@ -794,7 +865,7 @@ static void monster_start_go(entity &self)
 	{
 		bool notcombat = false, fixup = false;
 
-		for (entity &ctarget : G_IterateFunc<&entity::targetname>(self.target, striequals))
+		for (entity &ctarget : G_IterateTargetname(self.target))
 		{
 			if (ctarget.type == ET_POINT_COMBAT)
 			{
@@ -813,7 +884,7 @@ static void monster_start_go(entity &self)
 
 	// validate combattarget
 	if (self.combattarget)
-		for (entity &ctarget : G_IterateFunc<&entity::targetname>(self.combattarget, striequals))
+		for (entity &ctarget : G_IterateTargetname(self.combattarget))
 			if (ctarget.type != ET_POINT_COMBAT)
 				gi.dprintfmt("{}: bad combattarget \"{}\" ({})\n", self, self.combattarget, ctarget);
 
@@ -825,31 +896,31 @@ static void monster_start_go(entity &self)
 		{
 			gi.dprintfmt("{}: can't find target \"{}\"\n", self, self.target);
 			self.target = nullptr;
-			self.monsterinfo.pause_time = gtime::max();
-			self.monsterinfo.stand(self);
+			self.monsterinfo->pause_time = gtime::max();
+			self.monsterinfo->stand(self);
 		}
 		else if (self.movetarget->type == ET_PATH_CORNER)
 		{
 			vector v = self.goalentity->origin - self.origin;
 			self.ideal_yaw = self.angles[YAW] = vectoyaw(v);
-			self.monsterinfo.walk(self);
+			self.monsterinfo->walk(self);
 			self.target = nullptr;
 		}
 		else
 		{
 			self.goalentity = self.movetarget = null_entity;
-			self.monsterinfo.pause_time = gtime::max();
-			self.monsterinfo.stand(self);
+			self.monsterinfo->pause_time = gtime::max();
+			self.monsterinfo->stand(self);
 		}
 	}
 	else
 	{
-		self.monsterinfo.pause_time = gtime::max();
-		self.monsterinfo.stand(self);
+		self.monsterinfo->pause_time = gtime::max();
+		self.monsterinfo->stand(self);
 	}
 
 	self.think = SAVABLE(monster_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 // temp
@@ -943,7 +1014,7 @@ static void stationarymonster_triggered_spawn(entity &self)
 	KillBox (self);
 
 	self.solid = SOLID_BBOX;
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.svflags &= ~SVF_NOCLIENT;
 	self.air_finished_time = level.time + 12s;
 	gi.linkentity (self);
@@ -965,7 +1036,7 @@ static void stationarymonster_triggered_spawn_use(entity &self, entity &, entity
 {
 	// we have a one frame delay here so we don't telefrag the guy who activated us
 	self.think = SAVABLE(stationarymonster_triggered_spawn);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	if (cactivator.is_client)
 		self.enemy = cactivator;
 	self.use = SAVABLE(monster_use);
@@ -976,9 +1047,9 @@ REGISTER_STATIC_SAVABLE(stationarymonster_triggered_spawn_use);
 static void stationarymonster_triggered_start(entity &self)
 {
 	self.solid = SOLID_NOT;
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.svflags |= SVF_NOCLIENT;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	self.use = SAVABLE(stationarymonster_triggered_spawn_use);
 }
 
@@ -56,6 +56,50 @@ void monster_think(entity &self);
 
 DECLARE_SAVABLE(monster_think);
 
+/*
+==============================================================================
+
+DORMANCY
+
+==============================================================================
+
+With g_ai_dormancy set, a monster that has no enemy and isn't in the PVS
+of any client stops running its frames. It still checks the PVS every
+frame, which is cheap, so that it wakes as soon as a client could see
+it; the rest of its think only runs once every MONSTER_DORMANT_TICK.
+Anything else that could give it something to do - a noise it can hear,
+taking damage, being used - wakes it on the spot with M_Wake.
+*/
+
+constexpr gtime MONSTER_DORMANT_TICK = 1s;
+
+enum dormancy_wake : uint8_t
+{
+	WAKE_SIGHT,
+	WAKE_SOUND,
+	WAKE_DAMAGE,
+	WAKE_USE,
+
+	WAKE_TOTAL
+};
+
+struct dormancy_stats
+{
+	// times a monster went dormant
+	uint64_t	sleeps;
+	// slow ticks run by dormant monsters in place of their frames
+	uint64_t	idle_ticks;
+	// times a monster was woken, by what woke it
+	array<uint64_t, WAKE_TOTAL>	wakes;
+};
+
+const dormancy_stats &M_DormancyStats();
+
+void M_ResetDormancyStats();
+
+// if the monster is dormant, make it think right away
+void M_Wake(entity &self, dormancy_wake reason);
+
 /*
 ================
 monster_use
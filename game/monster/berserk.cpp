@@ -70,12 +70,12 @@ REGISTER_STATIC_SAVABLE(berserk_move_stand_fidget);
 
 static void berserk_fidget(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 		return;
 	if (random() > 0.15f)
 		return;
 
-	self.monsterinfo.currentmove = &SAVABLE(berserk_move_stand_fidget);
+	self.monsterinfo->currentmove = &SAVABLE(berserk_move_stand_fidget);
 	gi.sound(self, CHAN_WEAPON, sound_idle, ATTN_IDLE);
 }
 
@@ -92,7 +92,7 @@ REGISTER_STATIC_SAVABLE(berserk_move_stand);
 
 static void berserk_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(berserk_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(berserk_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_stand);
@@ -116,7 +116,7 @@ REGISTER_STATIC_SAVABLE(berserk_move_walk);
 
 static void berserk_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(berserk_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(berserk_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_walk);
@@ -143,10 +143,10 @@ static void berserk_run(entity &self)
 	monster_done_dodge(self);
 #endif
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_run1);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_run1);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_run);
@@ -207,9 +207,9 @@ static void berserk_melee(entity &self)
 #endif
 
 	if ((Q_rand() % 2) == 0)
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_attack_spike);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_attack_spike);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_attack_club);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_attack_club);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_melee);
@@ -266,9 +266,9 @@ static void berserk_reacttodamage(entity &self, entity &, entity &, int32_t, int
 #endif
 
 	if ((damage < 20) || (random() < 0.5f))
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_pain1);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_pain2);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_reacttodamage);
@@ -279,9 +279,9 @@ static void berserk_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -341,9 +341,9 @@ static void berserk_die(entity &self, entity &, entity &, int damage, vector)
 	self.takedamage = true;
 
 	if (damage >= 50)
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_death1);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_death1);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_death2);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_death2);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_die);
@@ -364,13 +364,13 @@ static void berserk_jump_wait_land(entity &self)
 {
 	if (self.groundentity == null_entity)
 	{
-		self.monsterinfo.nextframe = self.frame;
+		self.monsterinfo->nextframe = self.frame;
 
 		if (monster_jump_finished(self))
-			self.monsterinfo.nextframe = self.frame + 1;
+			self.monsterinfo->nextframe = self.frame + 1;
 	}
 	else
-		self.monsterinfo.nextframe = self.frame + 1;
+		self.monsterinfo->nextframe = self.frame + 1;
 }
 
 constexpr mframe_t berserk_frames_jump[] =
@@ -413,9 +413,9 @@ static void berserk_jump(entity &self)
 	monster_done_dodge(self);
 
 	if (self.enemy->origin[2] > self.origin[2])
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_jump2);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_jump2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_jump);
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_jump);
 }
 
 static bool berserk_blocked(entity &self, float dist)
@@ -437,13 +437,13 @@ REGISTER_STATIC_SAVABLE(berserk_blocked);
 static void berserk_sidestep(entity &self)
 {
 	// if we're jumping, don't dodge
-	if ((self.monsterinfo.currentmove == &berserk_move_jump) ||
-		(self.monsterinfo.currentmove == &berserk_move_jump2))
+	if ((self.monsterinfo->currentmove == &berserk_move_jump) ||
+		(self.monsterinfo->currentmove == &berserk_move_jump2))
 		return;
 
 	// don't check for attack; the eta should suffice for melee monsters
-	if (self.monsterinfo.currentmove != &berserk_move_run1)
-		self.monsterinfo.currentmove = &SAVABLE(berserk_move_run1);
+	if (self.monsterinfo->currentmove != &berserk_move_run1)
+		self.monsterinfo->currentmove = &SAVABLE(berserk_move_run1);
 }
 
 REGISTER_STATIC_SAVABLE(berserk_sidestep);
@@ -472,7 +472,7 @@ static void SP_monster_berserk(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, 32 }
 	};
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 
 	self.health = 240;
@@ -482,21 +482,22 @@ static void SP_monster_berserk(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(berserk_die);
 
-	self.monsterinfo.stand = SAVABLE(berserk_stand);
-	self.monsterinfo.walk = SAVABLE(berserk_walk);
-	self.monsterinfo.run = SAVABLE(berserk_run);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(berserk_stand);
+	self.monsterinfo->walk = SAVABLE(berserk_walk);
+	self.monsterinfo->run = SAVABLE(berserk_run);
 #ifdef ROGUE_AI
-	self.monsterinfo.dodge = SAVABLE(M_MonsterDodge);
-	self.monsterinfo.sidestep = SAVABLE(berserk_sidestep);
-	self.monsterinfo.blocked = SAVABLE(berserk_blocked);
+	self.monsterinfo->dodge = SAVABLE(M_MonsterDodge);
+	self.monsterinfo->sidestep = SAVABLE(berserk_sidestep);
+	self.monsterinfo->blocked = SAVABLE(berserk_blocked);
 #endif
-	self.monsterinfo.melee = SAVABLE(berserk_melee);
-	self.monsterinfo.sight = SAVABLE(berserk_sight);
-	self.monsterinfo.search = SAVABLE(berserk_search);
-	self.monsterinfo.reacttodamage = SAVABLE(berserk_reacttodamage);
+	self.monsterinfo->melee = SAVABLE(berserk_melee);
+	self.monsterinfo->sight = SAVABLE(berserk_sight);
+	self.monsterinfo->search = SAVABLE(berserk_search);
+	self.monsterinfo->reacttodamage = SAVABLE(berserk_reacttodamage);
 
-	self.monsterinfo.currentmove = &SAVABLE(berserk_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(berserk_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	gi.linkentity(self);
 
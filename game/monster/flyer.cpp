@@ -233,15 +233,15 @@ static void flyer_run(entity &self)
 #ifdef GROUND_ZERO
 	if (self.mass > 50)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_kamikaze);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_kamikaze);
 		self.touch = SAVABLE(kamikaze_touch);
 	}
 	else
 #endif
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(flyer_run);
@@ -253,7 +253,7 @@ static void flyer_walk(entity &self)
 		flyer_run (self);
 	else
 #endif
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_walk);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(flyer_walk);
@@ -265,7 +265,7 @@ static void flyer_stand(entity &self)
 		flyer_run (self);
 	else
 #endif
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(flyer_stand);
@@ -449,7 +449,7 @@ REGISTER_STATIC_SAVABLE(flyer_move_loop_melee);
 
 static void flyer_loop_melee(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(flyer_move_loop_melee);
+	self.monsterinfo->currentmove = &SAVABLE(flyer_move_loop_melee);
 }
 
 static void flyer_attack(entity &self)
@@ -474,17 +474,17 @@ static void flyer_attack(entity &self)
 
 	if (random() > chance)
 	{
-		self.monsterinfo.attack_state = AS_STRAIGHT;
+		self.monsterinfo->attack_state = AS_STRAIGHT;
 #endif
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_attack2);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_attack2);
 #ifdef ROGUE_AI
 	}
 	else // circle strafe
 	{
 		if (random() <= 0.5) // switch directions
-			self.monsterinfo.lefty = !self.monsterinfo.lefty;
-		self.monsterinfo.attack_state = AS_SLIDING;
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_attack3);
+			self.monsterinfo->lefty = !self.monsterinfo->lefty;
+		self.monsterinfo->attack_state = AS_SLIDING;
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_attack3);
 	}
 #endif
 }
@@ -498,7 +498,7 @@ static void flyer_melee(entity &self)
 		flyer_run (self);
 	else
 #endif
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_start_melee);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_start_melee);
 }
 
 REGISTER_STATIC_SAVABLE(flyer_melee);
@@ -508,12 +508,12 @@ static void flyer_check_melee(entity &self)
 	if (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE)
 	{
 		if (random() <= 0.8f)
-			self.monsterinfo.currentmove = &SAVABLE(flyer_move_loop_melee);
+			self.monsterinfo->currentmove = &SAVABLE(flyer_move_loop_melee);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(flyer_move_end_melee);
+			self.monsterinfo->currentmove = &SAVABLE(flyer_move_end_melee);
 	}
 	else
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_end_melee);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_end_melee);
 }
 
 static void flyer_reacttodamage(entity &self, entity &, entity &, int32_t, int32_t)
@@ -541,11 +541,11 @@ static void flyer_reacttodamage(entity &self, entity &, entity &, int32_t, int32
 
 	n = Q_rand() % 3;
 	if (n == 0)
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_pain1);
 	else if (n == 1)
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_pain2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(flyer_move_pain3);
+		self.monsterinfo->currentmove = &SAVABLE(flyer_move_pain3);
 }
 
 REGISTER_STATIC_SAVABLE(flyer_reacttodamage);
@@ -589,7 +589,7 @@ static void SP_monster_flyer(entity &self)
 
 	// fix a map bug in jail5.bsp
 	if (striequals(level.mapname, "jail5") && (self.origin[2] == -104)) {
-		self.targetname = self.target;
+		G_SetTargetname(self, self.target);
 		self.target = 0;
 	}
 
@@ -612,7 +612,7 @@ static void SP_monster_flyer(entity &self)
 		.maxs = { 16, 16, 32 }
 #endif
 	};
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 
 	self.sound = gi.soundindex("flyer/flyidle1.wav");
@@ -623,24 +623,25 @@ static void SP_monster_flyer(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(flyer_die);
 
-	self.monsterinfo.stand = SAVABLE(flyer_stand);
-	self.monsterinfo.walk = SAVABLE(flyer_walk);
-	self.monsterinfo.run = SAVABLE(flyer_run);
-	self.monsterinfo.attack = SAVABLE(flyer_attack);
-	self.monsterinfo.melee = SAVABLE(flyer_melee);
-	self.monsterinfo.sight = SAVABLE(flyer_sight);
-	self.monsterinfo.idle = SAVABLE(flyer_idle);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(flyer_stand);
+	self.monsterinfo->walk = SAVABLE(flyer_walk);
+	self.monsterinfo->run = SAVABLE(flyer_run);
+	self.monsterinfo->attack = SAVABLE(flyer_attack);
+	self.monsterinfo->melee = SAVABLE(flyer_melee);
+	self.monsterinfo->sight = SAVABLE(flyer_sight);
+	self.monsterinfo->idle = SAVABLE(flyer_idle);
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blocked = SAVABLE(flyer_blocked);
+	self.monsterinfo->blocked = SAVABLE(flyer_blocked);
 #endif
 
-	self.monsterinfo.reacttodamage = SAVABLE(flyer_reacttodamage);
+	self.monsterinfo->reacttodamage = SAVABLE(flyer_reacttodamage);
 
 	gi.linkentity(self);
 
-	self.monsterinfo.currentmove = &SAVABLE(flyer_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(flyer_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
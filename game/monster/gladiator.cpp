@@ -80,7 +80,7 @@ REGISTER_STATIC_SAVABLE(gladiator_move_stand);
 
 static void gladiator_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_stand);
@@ -109,7 +109,7 @@ REGISTER_STATIC_SAVABLE(gladiator_move_walk);
 
 static void gladiator_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_walk);
@@ -128,10 +128,10 @@ REGISTER_STATIC_SAVABLE(gladiator_move_run);
 
 static void gladiator_run(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(gladiator_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(gladiator_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gladiator_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(gladiator_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_run);
@@ -171,7 +171,7 @@ REGISTER_STATIC_SAVABLE(gladiator_move_attack_melee);
 
 static void gladiator_melee(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_attack_melee);
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_attack_melee);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_melee);
@@ -273,7 +273,7 @@ static void gladiator_attack(entity &self)
 		gi.sound(self, CHAN_WEAPON, sound_gun);
 	self.pos1 = self.enemy->origin;  //save for aiming the shot
 	self.pos1[2] += self.enemy->viewheight;
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_attack_gun);
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_attack_gun);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_attack);
@@ -307,8 +307,8 @@ static void gladiator_reacttodamage(entity &self, entity &, entity &, int32_t, i
 {
 	if (level.time < self.pain_debounce_time)
 	{
-		if ((self.velocity[2] > 100) && (self.monsterinfo.currentmove == &gladiator_move_pain))
-			self.monsterinfo.currentmove = &SAVABLE(gladiator_move_pain_air);
+		if ((self.velocity[2] > 100) && (self.monsterinfo->currentmove == &gladiator_move_pain))
+			self.monsterinfo->currentmove = &SAVABLE(gladiator_move_pain_air);
 		return;
 	}
 
@@ -323,9 +323,9 @@ static void gladiator_reacttodamage(entity &self, entity &, entity &, int32_t, i
 		return;     // no pain anims in nightmare
 
 	if (self.velocity[2] > 100)
-		self.monsterinfo.currentmove = &SAVABLE(gladiator_move_pain_air);
+		self.monsterinfo->currentmove = &SAVABLE(gladiator_move_pain_air);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gladiator_move_pain);
+		self.monsterinfo->currentmove = &SAVABLE(gladiator_move_pain);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_reacttodamage);
@@ -336,9 +336,9 @@ static void gladiator_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -395,7 +395,7 @@ static void gladiator_die(entity &self, entity &, entity &, int32_t damage, vect
 	self.deadflag = true;
 	self.takedamage = true;
 
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_death);
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_death);
 }
 
 REGISTER_STATIC_SAVABLE(gladiator_die);
@@ -434,6 +434,8 @@ static void SP_monster_gladiator(entity &self)
 	sound_idle = gi.soundindex("gladiator/gldidle1.wav");
 	sound_search = gi.soundindex("gladiator/gldsrch1.wav");
 	sound_sight = gi.soundindex("gladiator/sight.wav");
+
+	self.monsterinfo.emplace();
 	
 #ifdef THE_RECKONING
 	if (self.type == ET_MONSTER_GLADIATOR_BETA)
@@ -445,8 +447,8 @@ static void SP_monster_gladiator(entity &self)
 		self.gib_health = -175;
 		self.mass = 350;
 
-		self.monsterinfo.power_armor_type = ITEM_POWER_SHIELD;
-		self.monsterinfo.power_armor_power = 400;
+		self.monsterinfo->power_armor_type = ITEM_POWER_SHIELD;
+		self.monsterinfo->power_armor_power = 400;
 	}
 	else
 	{
@@ -461,7 +463,7 @@ static void SP_monster_gladiator(entity &self)
 	}
 #endif
 
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.bounds = {
 		.mins = { -32, -32, -24 },
@@ -471,22 +473,22 @@ static void SP_monster_gladiator(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(gladiator_die);
 
-	self.monsterinfo.stand = SAVABLE(gladiator_stand);
-	self.monsterinfo.walk = SAVABLE(gladiator_walk);
-	self.monsterinfo.run = SAVABLE(gladiator_run);
-	self.monsterinfo.attack = SAVABLE(gladiator_attack);
-	self.monsterinfo.melee = SAVABLE(gladiator_melee);
-	self.monsterinfo.sight = SAVABLE(gladiator_sight);
-	self.monsterinfo.idle = SAVABLE(gladiator_idle);
-	self.monsterinfo.search = SAVABLE(gladiator_search);
+	self.monsterinfo->stand = SAVABLE(gladiator_stand);
+	self.monsterinfo->walk = SAVABLE(gladiator_walk);
+	self.monsterinfo->run = SAVABLE(gladiator_run);
+	self.monsterinfo->attack = SAVABLE(gladiator_attack);
+	self.monsterinfo->melee = SAVABLE(gladiator_melee);
+	self.monsterinfo->sight = SAVABLE(gladiator_sight);
+	self.monsterinfo->idle = SAVABLE(gladiator_idle);
+	self.monsterinfo->search = SAVABLE(gladiator_search);
 #ifdef GROUND_ZERO
-	self.monsterinfo.blocked = SAVABLE(gladiator_blocked);
+	self.monsterinfo->blocked = SAVABLE(gladiator_blocked);
 #endif
-	self.monsterinfo.reacttodamage = SAVABLE(gladiator_reacttodamage);
+	self.monsterinfo->reacttodamage = SAVABLE(gladiator_reacttodamage);
 
 	gi.linkentity(self);
-	self.monsterinfo.currentmove = &SAVABLE(gladiator_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(gladiator_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
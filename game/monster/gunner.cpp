@@ -100,10 +100,10 @@ REGISTER_STATIC_SAVABLE(gunner_move_fidget);
 
 static void gunner_fidget(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 		return;
 	if (random() <= 0.05f)
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_fidget);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_fidget);
 }
 
 constexpr mframe_t gunner_frames_stand [] = {
@@ -146,7 +146,7 @@ REGISTER_STATIC_SAVABLE(gunner_move_stand);
 
 static void gunner_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_stand);
@@ -172,7 +172,7 @@ REGISTER_STATIC_SAVABLE(gunner_move_walk);
 
 static void gunner_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_walk);
@@ -201,10 +201,10 @@ static void gunner_run(entity &self)
 	monster_done_dodge(self);
 #endif
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_run);
@@ -278,17 +278,17 @@ static void gunner_reacttodamage(entity &self, entity &, entity &, int32_t, int3
 		return;     // no pain anims in nightmare
 
 	if (damage <= 10)
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_pain3);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_pain3);
 	else if (damage <= 25)
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_pain2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_pain1);
 
 #ifdef ROGUE_AI
-	self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+	self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 
 	// PMM - clear duck flag
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		monster_duck_up(self);
 #endif
 }
@@ -301,9 +301,9 @@ static void gunner_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -347,7 +347,7 @@ static void gunner_die(entity &self, entity &, entity &, int32_t damage, vector)
 	gi.sound(self, CHAN_VOICE, sound_death);
 	self.deadflag = true;
 	self.takedamage = true;
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_death);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_death);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_die);
@@ -357,23 +357,23 @@ static void GunnerGrenade(entity &self);
 static void gunner_duck_down(entity &self)
 {
 #ifndef ROGUE_AI
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		return;
 #endif
 
-	self.monsterinfo.aiflags |= AI_DUCKED;
+	self.monsterinfo->aiflags |= AI_DUCKED;
 	if (skill >= 2) {
 		if (random() > 0.5f)
 			GunnerGrenade(self);
 	}
 
 #ifdef ROGUE_AI
-	self.bounds.maxs[2] = self.monsterinfo.base_height - 32;
-	if (self.monsterinfo.duck_wait_time < level.time)
-		self.monsterinfo.duck_wait_time = level.time + 1s;
+	self.bounds.maxs[2] = self.monsterinfo->base_height - 32;
+	if (self.monsterinfo->duck_wait_time < level.time)
+		self.monsterinfo->duck_wait_time = level.time + 1s;
 #else
 	self.bounds.maxs.z -= 32;
-	self.monsterinfo.pause_time = level.time + 1s;
+	self.monsterinfo->pause_time = level.time + 1s;
 #endif
 	gi.linkentity(self);
 }
@@ -384,15 +384,15 @@ static void gunner_duck_down(entity &self)
 #else
 static void gunner_duck_hold(entity &self)
 {
-	if (level.time >= self.monsterinfo.pause_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->pause_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 static void gunner_duck_up(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DUCKED;
+	self.monsterinfo->aiflags &= ~AI_DUCKED;
 	self.bounds.maxs.z += 32;
 	self.takedamage = true;
 	gi.linkentity(self);
@@ -422,7 +422,7 @@ static void gunner_dodge(entity &self, entity &attacker, gtimef)
 	if (!self.enemy.has_value())
 		self.enemy = attacker;
 
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_duck);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_dodge);
@@ -472,9 +472,9 @@ static bool gunner_grenade_check(entity &self)
 
 	// if the player is above my head, use machinegun.
 	// check for flag telling us that we're blindfiring
-	if (self.monsterinfo.aiflags & AI_MANUAL_STEERING)
+	if (self.monsterinfo->aiflags & AI_MANUAL_STEERING)
 	{
-		if (self.origin[2]+self.viewheight < self.monsterinfo.blind_fire_target[2])
+		if (self.origin[2]+self.viewheight < self.monsterinfo->blind_fire_target[2])
 			return false;
 	}
 	else if (self.absbounds.maxs[2] <= self.enemy->absbounds.mins[2])
@@ -486,8 +486,8 @@ static bool gunner_grenade_check(entity &self)
 	start = G_ProjectSource (self.origin, monster_flash_offset[MZ2_GUNNER_GRENADE_1], forward, right);
 
 	// pmm - check for blindfire flag
-	if (self.monsterinfo.aiflags & AI_MANUAL_STEERING)
-		target = self.monsterinfo.blind_fire_target;
+	if (self.monsterinfo->aiflags & AI_MANUAL_STEERING)
+		target = self.monsterinfo->blind_fire_target;
 	else
 		target = self.enemy->origin;
 
@@ -517,7 +517,7 @@ static void GunnerGrenade(entity &self)
 	float	spread;
 	float	pitch = 0;
 	vector	target;	
-	bool	blindfire = (self.monsterinfo.aiflags & AI_MANUAL_STEERING);
+	bool	blindfire = (self.monsterinfo->aiflags & AI_MANUAL_STEERING);
 
 	if(!self.enemy.has_value() || !self.enemy->inuse)
 		return;
@@ -554,7 +554,7 @@ static void GunnerGrenade(entity &self)
 	else
 #ifdef ROGUE_AI
 	{
-		self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+		self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 		spread = .11f;
 #endif
 		flash_number = MZ2_GUNNER_GRENADE_4;
@@ -566,10 +566,10 @@ static void GunnerGrenade(entity &self)
 	if (blindfire && !visible(self, self.enemy))
 	{
 		// and we have a valid blind_fire_target
-		if (!self.monsterinfo.blind_fire_target)
+		if (!self.monsterinfo->blind_fire_target)
 			return;
 		
-		target = self.monsterinfo.blind_fire_target;
+		target = self.monsterinfo->blind_fire_target;
 	}
 	else
 		target = self.enemy->origin;
@@ -652,10 +652,10 @@ REGISTER_STATIC_SAVABLE(gunner_move_endfire_chain);
 #ifdef ROGUE_AI
 static void gunner_blind_check (entity &self)
 {
-	if (!(self.monsterinfo.aiflags & AI_MANUAL_STEERING))
+	if (!(self.monsterinfo->aiflags & AI_MANUAL_STEERING))
 		return;
 
-	vector aim = self.monsterinfo.blind_fire_target - self.origin;
+	vector aim = self.monsterinfo->blind_fire_target - self.origin;
 	self.ideal_yaw = vectoyaw(aim);
 }
 #endif
@@ -697,23 +697,23 @@ static void gunner_attack(entity &self)
 	monster_done_dodge(self);
 
 	// PMM 
-	if (self.monsterinfo.attack_state == AS_BLIND)
+	if (self.monsterinfo->attack_state == AS_BLIND)
 	{
 		float chance = 0.1f;
 		
 		// setup shot probabilities
-		if (self.monsterinfo.blind_fire_framedelay < 1s)
+		if (self.monsterinfo->blind_fire_framedelay < 1s)
 			chance = 1.0f;
-		else if (self.monsterinfo.blind_fire_framedelay < 7.5s)
+		else if (self.monsterinfo->blind_fire_framedelay < 7.5s)
 			chance = 0.4f;
 
 		float r = random();
 
 		// minimum of 2 seconds, plus 0-3, after the shots are done
-		self.monsterinfo.blind_fire_framedelay += duration_cast<gtime>(random(4.1s, 7.1s));
+		self.monsterinfo->blind_fire_framedelay += duration_cast<gtime>(random(4.1s, 7.1s));
 
 		// don't shoot at the origin
-		if (!self.monsterinfo.blind_fire_target)
+		if (!self.monsterinfo->blind_fire_target)
 			return;
 
 		// don't shoot if the dice say not to
@@ -721,17 +721,17 @@ static void gunner_attack(entity &self)
 			return;
 
 		// turn on manual steering to signal both manual steering and blindfire
-		self.monsterinfo.aiflags |= AI_MANUAL_STEERING;
+		self.monsterinfo->aiflags |= AI_MANUAL_STEERING;
 
 		if (gunner_grenade_check(self))
 		{
 			// if the check passes, go for the attack
-			self.monsterinfo.currentmove = &SAVABLE(gunner_move_attack_grenade);
-			self.monsterinfo.attack_finished = level.time + random(2s);
+			self.monsterinfo->currentmove = &SAVABLE(gunner_move_attack_grenade);
+			self.monsterinfo->attack_finished = level.time + random(2s);
 		}
 
 		// turn off blindfire flag
-		self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+		self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 		return;
 	}
 
@@ -740,7 +740,7 @@ static void gunner_attack(entity &self)
 #else
 	if (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE)
 #endif
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_attack_chain);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_attack_chain);
 	else
 	{
 		if (random() <= 0.5f
@@ -748,9 +748,9 @@ static void gunner_attack(entity &self)
 				&& gunner_grenade_check(self)
 #endif
 			)
-			self.monsterinfo.currentmove = &SAVABLE(gunner_move_attack_grenade);
+			self.monsterinfo->currentmove = &SAVABLE(gunner_move_attack_grenade);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(gunner_move_attack_chain);
+			self.monsterinfo->currentmove = &SAVABLE(gunner_move_attack_chain);
 	}
 }
 
@@ -758,7 +758,7 @@ REGISTER_STATIC_SAVABLE(gunner_attack);
 
 static void gunner_fire_chain(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_fire_chain);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_fire_chain);
 }
 
 static void gunner_refire_chain(entity &self)
@@ -767,10 +767,10 @@ static void gunner_refire_chain(entity &self)
 		if (visible(self, self.enemy))
 			if (random() <= 0.5f)
 			{
-				self.monsterinfo.currentmove = &SAVABLE(gunner_move_fire_chain);
+				self.monsterinfo->currentmove = &SAVABLE(gunner_move_fire_chain);
 				return;
 			}
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_endfire_chain);
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_endfire_chain);
 }
 
 #ifdef ROGUE_AI
@@ -789,13 +789,13 @@ static void gunner_jump_wait_land (entity &self)
 {
 	if(self.groundentity == null_entity)
 	{
-		self.monsterinfo.nextframe = self.frame;
+		self.monsterinfo->nextframe = self.frame;
 
 		if(monster_jump_finished (self))
-			self.monsterinfo.nextframe = self.frame + 1;
+			self.monsterinfo->nextframe = self.frame + 1;
 	}
 	else 
-		self.monsterinfo.nextframe = self.frame + 1;
+		self.monsterinfo->nextframe = self.frame + 1;
 }
 
 constexpr mframe_t gunner_frames_jump [] =
@@ -840,9 +840,9 @@ static void gunner_jump (entity &self)
 	monster_done_dodge (self);
 
 	if(self.enemy->origin[2] > self.origin[2])
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_jump2);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_jump2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_jump);
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_jump);
 }
 
 static bool gunner_blocked (entity &self, float dist)
@@ -867,59 +867,59 @@ REGISTER_STATIC_SAVABLE(gunner_blocked);
 // PMM - new duck code
 static void gunner_duck (entity &self, gtimef eta)
 {
-	if ((self.monsterinfo.currentmove == &gunner_move_jump2) ||
-		(self.monsterinfo.currentmove == &gunner_move_jump))
+	if ((self.monsterinfo->currentmove == &gunner_move_jump2) ||
+		(self.monsterinfo->currentmove == &gunner_move_jump))
 		return;
 
-	if ((self.monsterinfo.currentmove == &gunner_move_attack_chain) ||
-		(self.monsterinfo.currentmove == &gunner_move_fire_chain) ||
-		(self.monsterinfo.currentmove == &gunner_move_attack_grenade)
+	if ((self.monsterinfo->currentmove == &gunner_move_attack_chain) ||
+		(self.monsterinfo->currentmove == &gunner_move_fire_chain) ||
+		(self.monsterinfo->currentmove == &gunner_move_attack_grenade)
 		)
 	{
 		// if we're shooting, and not on easy, don't dodge
 		if (skill)
 		{
-			self.monsterinfo.aiflags &= ~AI_DUCKED;
+			self.monsterinfo->aiflags &= ~AI_DUCKED;
 			return;
 		}
 	}
 
 	if (!skill)
 		// PMM - stupid dodge
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
 	else
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
 
 	// has to be done immediately otherwise he can get stuck
 	gunner_duck_down(self);
 
-	self.monsterinfo.nextframe = FRAME_duck01;
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_duck);
+	self.monsterinfo->nextframe = FRAME_duck01;
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_duck);
 
 static void gunner_sidestep (entity &self)
 {
-	if ((self.monsterinfo.currentmove == &gunner_move_jump2) ||
-		(self.monsterinfo.currentmove == &gunner_move_jump))
+	if ((self.monsterinfo->currentmove == &gunner_move_jump2) ||
+		(self.monsterinfo->currentmove == &gunner_move_jump))
 		return;
 
-	if ((self.monsterinfo.currentmove == &gunner_move_attack_chain) ||
-		(self.monsterinfo.currentmove == &gunner_move_fire_chain) ||
-		(self.monsterinfo.currentmove == &gunner_move_attack_grenade)
+	if ((self.monsterinfo->currentmove == &gunner_move_attack_chain) ||
+		(self.monsterinfo->currentmove == &gunner_move_fire_chain) ||
+		(self.monsterinfo->currentmove == &gunner_move_attack_grenade)
 		)
 	{
 		// if we're shooting, and not on easy, don't dodge
 		if (skill)
 		{
-			self.monsterinfo.aiflags &= ~AI_DODGING;
+			self.monsterinfo->aiflags &= ~AI_DODGING;
 			return;
 		}
 	}
 
-	if (self.monsterinfo.currentmove != &SAVABLE(gunner_move_run))
-		self.monsterinfo.currentmove = &SAVABLE(gunner_move_run);
+	if (self.monsterinfo->currentmove != &SAVABLE(gunner_move_run))
+		self.monsterinfo->currentmove = &SAVABLE(gunner_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(gunner_sidestep);
@@ -945,7 +945,7 @@ static void SP_monster_gunner(entity &self)
 	gi.soundindex("gunner/gunatck2.wav");
 	gi.soundindex("gunner/gunatck3.wav");
 
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.modelindex = gi.modelindex("models/monsters/gunner/tris.md2");
 	self.bounds = {
@@ -960,28 +960,29 @@ static void SP_monster_gunner(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(gunner_die);
 
-	self.monsterinfo.stand = SAVABLE(gunner_stand);
-	self.monsterinfo.walk = SAVABLE(gunner_walk);
-	self.monsterinfo.run = SAVABLE(gunner_run);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(gunner_stand);
+	self.monsterinfo->walk = SAVABLE(gunner_walk);
+	self.monsterinfo->run = SAVABLE(gunner_run);
 #ifdef ROGUE_AI
-	self.monsterinfo.dodge = SAVABLE(M_MonsterDodge);
-	self.monsterinfo.duck = SAVABLE(gunner_duck);
-	self.monsterinfo.unduck = SAVABLE(monster_duck_up);
-	self.monsterinfo.sidestep = SAVABLE(gunner_sidestep);
-	self.monsterinfo.blocked = SAVABLE(gunner_blocked);
-	self.monsterinfo.blindfire = true;
+	self.monsterinfo->dodge = SAVABLE(M_MonsterDodge);
+	self.monsterinfo->duck = SAVABLE(gunner_duck);
+	self.monsterinfo->unduck = SAVABLE(monster_duck_up);
+	self.monsterinfo->sidestep = SAVABLE(gunner_sidestep);
+	self.monsterinfo->blocked = SAVABLE(gunner_blocked);
+	self.monsterinfo->blindfire = true;
 #else
-	self.monsterinfo.dodge = SAVABLE(gunner_dodge);
+	self.monsterinfo->dodge = SAVABLE(gunner_dodge);
 #endif
-	self.monsterinfo.attack = SAVABLE(gunner_attack);
-	self.monsterinfo.sight = SAVABLE(gunner_sight);
-	self.monsterinfo.search = SAVABLE(gunner_search);
-	self.monsterinfo.reacttodamage = SAVABLE(gunner_reacttodamage);
+	self.monsterinfo->attack = SAVABLE(gunner_attack);
+	self.monsterinfo->sight = SAVABLE(gunner_sight);
+	self.monsterinfo->search = SAVABLE(gunner_search);
+	self.monsterinfo->reacttodamage = SAVABLE(gunner_reacttodamage);
 
 	gi.linkentity(self);
 
-	self.monsterinfo.currentmove = &SAVABLE(gunner_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(gunner_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
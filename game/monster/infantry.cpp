@@ -63,7 +63,7 @@ REGISTER_STATIC_SAVABLE(infantry_move_stand);
 
 static void infantry_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_stand);
@@ -125,7 +125,7 @@ REGISTER_STATIC_SAVABLE(infantry_move_fidget);
 
 static void infantry_fidget(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_fidget);
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_fidget);
 
 	gi.sound(self, CHAN_VOICE, sound_idle, ATTN_IDLE);
 }
@@ -152,7 +152,7 @@ REGISTER_STATIC_SAVABLE(infantry_move_walk);
 
 static void infantry_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_walk);
@@ -181,10 +181,10 @@ static void infantry_run(entity &self)
 	monster_done_dodge(self);
 #endif
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_run);
@@ -238,18 +238,18 @@ static void infantry_reacttodamage(entity &self, entity &, entity &, int32_t, in
 	int32_t n = Q_rand() % 2;
 	if (n == 0)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_pain1);
 		gi.sound(self, CHAN_VOICE, sound_pain1);
 	}
 	else
 	{
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_pain2);
 		gi.sound(self, CHAN_VOICE, sound_pain2);
 	}
 
 #ifdef ROGUE_AI
 	// PMM - clear duck flag
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		monster_duck_up(self);
 #endif
 }
@@ -321,7 +321,7 @@ static void infantry_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
 	gi.linkentity(self);
 
@@ -426,15 +426,15 @@ static void infantry_die(entity &self, entity &, entity &, int32_t damage, vecto
 
 	n = Q_rand() % 3;
 	if (n == 0) {
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_death1);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_death1);
 		gi.sound(self, CHAN_VOICE, sound_die2);
 	}
 	else if (n == 1) {
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_death2);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_death2);
 		gi.sound(self, CHAN_VOICE, sound_die1);
 	}
 	else {
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_death3);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_death3);
 		gi.sound(self, CHAN_VOICE, sound_die2);
 	}
 }
@@ -448,26 +448,26 @@ REGISTER_STATIC_SAVABLE(infantry_die);
 #else
 static void infantry_duck_down(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self.monsterinfo.aiflags |= AI_DUCKED;
+	self.monsterinfo->aiflags |= AI_DUCKED;
 	self.bounds.maxs.z -= 32;
 	self.takedamage = true;
-	self.monsterinfo.pause_time = level.time + 1s;
+	self.monsterinfo->pause_time = level.time + 1s;
 	gi.linkentity(self);
 }
 
 static void infantry_duck_hold(entity &self)
 {
-	if (level.time >= self.monsterinfo.pause_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->pause_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 static void infantry_duck_up(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DUCKED;
+	self.monsterinfo->aiflags &= ~AI_DUCKED;
 	self.bounds.maxs.z += 32;
 	self.takedamage = true;
 	gi.linkentity(self);
@@ -494,7 +494,7 @@ static void infantry_dodge(entity &self, entity &attacker, gtimef)
 	if (!self.enemy.has_value())
 		self.enemy = attacker;
 
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_duck);
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_dodge);
@@ -503,7 +503,7 @@ REGISTER_STATIC_SAVABLE(infantry_dodge);
 #if defined(THE_RECKONING) || defined(GROUND_ZERO) || defined(ROGUE_AI)
 static void infantry_set_firetime(entity &self)
 {
-	self.monsterinfo.pause_time = level.time + random(1500ms) + 500ms;
+	self.monsterinfo->pause_time = level.time + random(1500ms) + 500ms;
 }
 
 static void infantry_cock_gun(entity &self)
@@ -514,7 +514,7 @@ static void infantry_cock_gun(entity &self)
 static void infantry_cock_gun(entity &self)
 {
 	gi.sound(self, CHAN_WEAPON, sound_weapon_cock);
-	self.monsterinfo.pause_time = level.time + random(1000ms, 2600ms);
+	self.monsterinfo->pause_time = level.time + random(1000ms, 2600ms);
 }
 #endif
 
@@ -522,10 +522,10 @@ static void infantry_fire(entity &self)
 {
 	InfantryMachineGun(self);
 
-	if (level.time >= self.monsterinfo.pause_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->pause_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 constexpr mframe_t infantry_frames_attack1[] = {
@@ -618,9 +618,9 @@ static void infantry_attack(entity &self)
 #endif
 
 	if (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE)
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_attack2);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_attack2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_attack1);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_attack1);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_attack);
@@ -641,13 +641,13 @@ static void infantry_jump_wait_land(entity &self)
 {
 	if (self.groundentity == null_entity)
 	{
-		self.monsterinfo.nextframe = self.frame;
+		self.monsterinfo->nextframe = self.frame;
 
 		if (monster_jump_finished(self))
-			self.monsterinfo.nextframe = self.frame + 1;
+			self.monsterinfo->nextframe = self.frame + 1;
 	}
 	else
-		self.monsterinfo.nextframe = self.frame + 1;
+		self.monsterinfo->nextframe = self.frame + 1;
 }
 
 constexpr mframe_t infantry_frames_jump[] = {
@@ -690,9 +690,9 @@ static void infantry_jump(entity &self)
 	monster_done_dodge(self);
 
 	if (self.enemy->origin[2] > self.origin[2])
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_jump2);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_jump2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_jump);
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_jump);
 }
 
 static bool infantry_blocked(entity &self, float dist)
@@ -717,34 +717,34 @@ REGISTER_STATIC_SAVABLE(infantry_blocked);
 static void infantry_duck(entity &self, gtimef eta)
 {
 	// if we're jumping, don't dodge
-	if ((self.monsterinfo.currentmove == &infantry_move_jump) ||
-		(self.monsterinfo.currentmove == &infantry_move_jump2))
+	if ((self.monsterinfo->currentmove == &infantry_move_jump) ||
+		(self.monsterinfo->currentmove == &infantry_move_jump2))
 	{
 		return;
 	}
 
-	if ((self.monsterinfo.currentmove == &infantry_move_attack1) ||
-		(self.monsterinfo.currentmove == &infantry_move_attack2))
+	if ((self.monsterinfo->currentmove == &infantry_move_attack1) ||
+		(self.monsterinfo->currentmove == &infantry_move_attack2))
 	{
 		// if we're shooting, and not on easy, don't dodge
 		if (skill)
 		{
-			self.monsterinfo.aiflags &= ~AI_DUCKED;
+			self.monsterinfo->aiflags &= ~AI_DUCKED;
 			return;
 		}
 	}
 
 	if (!skill)
 		// PMM - stupid dodge
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
 	else
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
 
 	// has to be done immediately otherwise he can get stuck
 	monster_duck_down(self);
 
-	self.monsterinfo.nextframe = FRAME_duck01;
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_duck);
+	self.monsterinfo->nextframe = FRAME_duck01;
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_duck);
@@ -752,25 +752,25 @@ REGISTER_STATIC_SAVABLE(infantry_duck);
 static void infantry_sidestep(entity &self)
 {
 	// if we're jumping, don't dodge
-	if ((self.monsterinfo.currentmove == &infantry_move_jump) ||
-		(self.monsterinfo.currentmove == &infantry_move_jump2))
+	if ((self.monsterinfo->currentmove == &infantry_move_jump) ||
+		(self.monsterinfo->currentmove == &infantry_move_jump2))
 	{
 		return;
 	}
 
-	if ((self.monsterinfo.currentmove == &infantry_move_attack1) ||
-		(self.monsterinfo.currentmove == &infantry_move_attack2))
+	if ((self.monsterinfo->currentmove == &infantry_move_attack1) ||
+		(self.monsterinfo->currentmove == &infantry_move_attack2))
 	{
 		// if we're shooting, and not on easy, don't dodge
 		if (skill)
 		{
-			self.monsterinfo.aiflags &= ~AI_DODGING;
+			self.monsterinfo->aiflags &= ~AI_DODGING;
 			return;
 		}
 	}
 
-	if (self.monsterinfo.currentmove != &infantry_move_run)
-		self.monsterinfo.currentmove = &SAVABLE(infantry_move_run);
+	if (self.monsterinfo->currentmove != &infantry_move_run)
+		self.monsterinfo->currentmove = &SAVABLE(infantry_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(infantry_sidestep);
@@ -800,7 +800,7 @@ static void SP_monster_infantry(entity &self)
 	sound_search = gi.soundindex("infantry/infsrch1.wav");
 	sound_idle = gi.soundindex("infantry/infidle1.wav");
 
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.modelindex = gi.modelindex("models/monsters/infantry/tris.md2");
 	self.bounds = {
@@ -815,27 +815,28 @@ static void SP_monster_infantry(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(infantry_die);
 
-	self.monsterinfo.stand = SAVABLE(infantry_stand);
-	self.monsterinfo.walk = SAVABLE(infantry_walk);
-	self.monsterinfo.run = SAVABLE(infantry_run);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(infantry_stand);
+	self.monsterinfo->walk = SAVABLE(infantry_walk);
+	self.monsterinfo->run = SAVABLE(infantry_run);
 #ifdef ROGUE_AI
-	self.monsterinfo.dodge = SAVABLE(M_MonsterDodge);
-	self.monsterinfo.duck = SAVABLE(infantry_duck);
-	self.monsterinfo.unduck = SAVABLE(monster_duck_up);
-	self.monsterinfo.sidestep = SAVABLE(infantry_sidestep);
-	self.monsterinfo.blocked = SAVABLE(infantry_blocked);
+	self.monsterinfo->dodge = SAVABLE(M_MonsterDodge);
+	self.monsterinfo->duck = SAVABLE(infantry_duck);
+	self.monsterinfo->unduck = SAVABLE(monster_duck_up);
+	self.monsterinfo->sidestep = SAVABLE(infantry_sidestep);
+	self.monsterinfo->blocked = SAVABLE(infantry_blocked);
 #else
-	self.monsterinfo.dodge = SAVABLE(infantry_dodge);
+	self.monsterinfo->dodge = SAVABLE(infantry_dodge);
 #endif
-	self.monsterinfo.attack = SAVABLE(infantry_attack);
-	self.monsterinfo.sight = SAVABLE(infantry_sight);
-	self.monsterinfo.idle = SAVABLE(infantry_fidget);
-	self.monsterinfo.reacttodamage = SAVABLE(infantry_reacttodamage);
+	self.monsterinfo->attack = SAVABLE(infantry_attack);
+	self.monsterinfo->sight = SAVABLE(infantry_sight);
+	self.monsterinfo->idle = SAVABLE(infantry_fidget);
+	self.monsterinfo->reacttodamage = SAVABLE(infantry_reacttodamage);
 
 	gi.linkentity(self);
 
-	self.monsterinfo.currentmove = &SAVABLE(infantry_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(infantry_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -8,6 +8,7 @@
 #include "../monster.h"
 #include "../misc.h"
 #include "../spawn.h"
+#include "../util.h"
 
 #include "lib/gi.h"
 #include "lib/string/format.h"
@@ -139,9 +140,9 @@ static void insane_checkdown(entity &self)
 		return;
 	if (random() < 0.3f) {
 		if (random() < 0.5f)
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_uptodown);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_uptodown);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_jumpdown);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_jumpdown);
 	}
 }
 
@@ -199,7 +200,7 @@ static void insane_checkup(entity &self)
 	if ((self.spawnflags & CRAWL) && (self.spawnflags & STAND_GROUND))
 		return;
 	if (random() < 0.5f)
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_downtoup);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_downtoup);
 }
 
 constexpr mframe_t insane_frames_down [] = {
@@ -461,24 +462,24 @@ REGISTER_STATIC_SAVABLE(insane_move_struggle_cross);
 static void insane_cross(entity &self)
 {
 	if (random() < 0.8f)
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_cross);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_cross);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_struggle_cross);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_struggle_cross);
 }
 
 static void insane_walk(entity &self)
 {
 	if (self.spawnflags & STAND_GROUND)              // Hold Ground?
 		if (self.frame == FRAME_cr_pain10) {
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_down);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_down);
 			return;
 		}
 	if (self.spawnflags & CRAWL)
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_crawl);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_crawl);
 	else if (random() <= 0.5f)
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_walk_normal);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_walk_normal);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_walk_insane);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_walk_insane);
 }
 
 REGISTER_STATIC_SAVABLE(insane_walk);
@@ -487,15 +488,15 @@ static void insane_run(entity &self)
 {
 	if (self.spawnflags & STAND_GROUND)              // Hold Ground?
 		if (self.frame == FRAME_cr_pain10) {
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_down);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_down);
 			return;
 		}
 	if (self.spawnflags & CRAWL)               // Crawling?
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_runcrawl);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_runcrawl);
 	else if (random() <= 0.5f)              // Else, mix it up
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_run_normal);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_run_normal);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_run_insane);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_run_insane);
 }
 
 REGISTER_STATIC_SAVABLE(insane_run);
@@ -526,36 +527,36 @@ static void insane_reacttodamage(entity &self, entity &, entity &, int32_t, int3
 	// Don't go into pain frames if crucified.
 	if (self.spawnflags & CRUCIFIED)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_struggle_cross);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_struggle_cross);
 		return;
 	}
 
 	if (((self.frame >= FRAME_crawl1) && (self.frame <= FRAME_crawl9)) || ((self.frame >= FRAME_stand99) && (self.frame <= FRAME_stand160)))
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_crawl_pain);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_crawl_pain);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_stand_pain);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_stand_pain);
 }
 
 REGISTER_STATIC_SAVABLE(insane_reacttodamage);
 
 static void insane_onground(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(insane_move_down);
+	self.monsterinfo->currentmove = &SAVABLE(insane_move_down);
 }
 
 static void insane_stand(entity &self)
 {
 	if (self.spawnflags & CRUCIFIED) {         // If crucified
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_cross);
-		self.monsterinfo.aiflags |= AI_STAND_GROUND;
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_cross);
+		self.monsterinfo->aiflags |= AI_STAND_GROUND;
 	}
 	// If STAND_GROUND and Crawl are set
 	else if ((self.spawnflags & CRAWL) && (self.spawnflags & STAND_GROUND))
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_down);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_down);
 	else if (random() < 0.5f)
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_stand_normal);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_stand_normal);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(insane_move_stand_insane);
+		self.monsterinfo->currentmove = &SAVABLE(insane_move_stand_insane);
 }
 
 REGISTER_STATIC_SAVABLE(insane_stand);
@@ -569,10 +570,10 @@ static void insane_dead(entity &self)
 			.mins = { -16, -16, -24 },
 			.maxs = { 16, 16, -8 }
 		};
-		self.movetype = MOVETYPE_TOSS;
+		self.set_movetype(MOVETYPE_TOSS);
 	}
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -604,9 +605,9 @@ static void insane_die(entity &self, entity &, entity &, int32_t damage, vector)
 		insane_dead(self);
 	} else {
 		if (((self.frame >= FRAME_crawl1) && (self.frame <= FRAME_crawl9)) || ((self.frame >= FRAME_stand99) && (self.frame <= FRAME_stand160)))
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_crawl_death);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_crawl_death);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(insane_move_stand_death);
+			self.monsterinfo->currentmove = &SAVABLE(insane_move_stand_death);
 	}
 }
 
@@ -635,7 +636,7 @@ static void SP_misc_insane(entity &self)
 	sound_scream[6] = gi.soundindex("insane/insane9.wav");
 	sound_scream[7] = gi.soundindex("insane/insane10.wav");
 
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.modelindex = gi.modelindex("models/monsters/insane/tris.md2");
 
@@ -650,11 +651,12 @@ static void SP_misc_insane(entity &self)
 
 	self.die = SAVABLE(insane_die);
 
-	self.monsterinfo.stand = SAVABLE(insane_stand);
-	self.monsterinfo.walk = SAVABLE(insane_walk);
-	self.monsterinfo.run = SAVABLE(insane_run);
-	self.monsterinfo.reacttodamage = SAVABLE(insane_reacttodamage);
-	self.monsterinfo.aiflags |= AI_GOOD_GUY;
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(insane_stand);
+	self.monsterinfo->walk = SAVABLE(insane_walk);
+	self.monsterinfo->run = SAVABLE(insane_run);
+	self.monsterinfo->reacttodamage = SAVABLE(insane_reacttodamage);
+	self.monsterinfo->aiflags |= AI_GOOD_GUY;
 
 //@@
 //  self.skinnum = skin;
@@ -665,11 +667,11 @@ static void SP_misc_insane(entity &self)
 	gi.linkentity(self);
 
 	if (self.spawnflags & STAND_GROUND)              // Stand Ground
-		self.monsterinfo.aiflags |= AI_STAND_GROUND;
+		self.monsterinfo->aiflags |= AI_STAND_GROUND;
 
-	self.monsterinfo.currentmove = &SAVABLE(insane_move_stand_normal);
+	self.monsterinfo->currentmove = &SAVABLE(insane_move_stand_normal);
 
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	if (self.spawnflags & CRUCIFIED) {                 // Crucified ?
 		self.bounds = {
@@ -108,16 +108,16 @@ constexpr vector reinforcement_position[] = {
 static void cleanupHeal(entity &self, bool change_frame)
 {
 	// clean up target, if we have one and it's legit
-	if (self.enemy.has_value() && self.enemy->inuse)
+	if (self.enemy.has_value() && self.enemy->inuse && self.enemy->monsterinfo.has_value())
 	{
-		self.enemy->monsterinfo.healer = 0;
-		self.enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+		self.enemy->monsterinfo->healer = 0;
+		self.enemy->monsterinfo->aiflags &= ~AI_RESURRECTING;
 		self.enemy->takedamage = true;
 		M_SetEffects (self.enemy);
 	}
 
 	if (change_frame)
-		self.monsterinfo.nextframe = FRAME_attack52;
+		self.monsterinfo->nextframe = FRAME_attack52;
 }
 
 static void abortHeal(entity &self, bool change_frame, bool gib, bool mark)
@@ -129,14 +129,14 @@ static void abortHeal(entity &self, bool change_frame, bool gib, bool mark)
 	cleanupHeal (self, change_frame);
 
 	// gib em!
-	if (mark && self.enemy.has_value() && self.enemy->inuse)
+	if (mark && self.enemy.has_value() && self.enemy->inuse && self.enemy->monsterinfo.has_value())
 	{
 		// if the first badMedic slot is filled by a medic, skip it and use the second one
-		if ((self.enemy->monsterinfo.badMedic1.has_value()) && (self.enemy->monsterinfo.badMedic1->inuse)
-			&& (self.enemy->monsterinfo.badMedic1->type == ET_MONSTER_MEDIC))
-			self.enemy->monsterinfo.badMedic2 = self;
+		if ((self.enemy->monsterinfo->badMedic1.has_value()) && (self.enemy->monsterinfo->badMedic1->inuse)
+			&& (self.enemy->monsterinfo->badMedic1->type == ET_MONSTER_MEDIC))
+			self.enemy->monsterinfo->badMedic2 = self;
 		else
-			self.enemy->monsterinfo.badMedic1 = self;
+			self.enemy->monsterinfo->badMedic1 = self;
 	}
 
 	if (gib && self.enemy.has_value() && self.enemy->inuse)
@@ -151,13 +151,13 @@ static void abortHeal(entity &self, bool change_frame, bool gib, bool mark)
 	}
 	// clean up self
 
-	self.monsterinfo.aiflags &= ~AI_MEDIC;
+	self.monsterinfo->aiflags &= ~AI_MEDIC;
 	if (self.oldenemy.has_value() && self.oldenemy->inuse)
 		self.enemy = self.oldenemy;
 	else
 		self.enemy = 0;
 
-	self.monsterinfo.medicTries = 0;
+	self.monsterinfo->medicTries = 0;
 }
 #endif
 
@@ -167,7 +167,7 @@ static entityref medic_FindDeadMonster(entity &self)
 	float radius = 1024;
 #ifdef ROGUE_AI
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 		radius = MEDIC_MAX_HEAL_DISTANCE;
 #endif
 
@@ -177,18 +177,18 @@ static entityref medic_FindDeadMonster(entity &self)
 			continue;
 		if (!(ent.svflags & SVF_MONSTER))
 			continue;
-		if (ent.monsterinfo.aiflags & AI_GOOD_GUY)
+		if (std::as_const(ent.monsterinfo)->aiflags & AI_GOOD_GUY)
 			continue;
 #ifdef ROGUE_AI
 		// check to make sure we haven't bailed on this guy already
-		if ((ent.monsterinfo.badMedic1 == self) || (ent.monsterinfo.badMedic2 == self))
+		if ((ent.monsterinfo->badMedic1 == self) || (ent.monsterinfo->badMedic2 == self))
 			continue;
-		if (ent.monsterinfo.healer.has_value())
+		if (ent.monsterinfo->healer.has_value())
 			// FIXME - this is correcting a bug that is somewhere else
 			// if the healer is a monster, and it's in medic mode .. continue .. otherwise
 			//   we will override the healer, if it passes all the other tests
-			if ((ent.monsterinfo.healer->inuse) && (ent.monsterinfo.healer->health > 0) &&
-				(ent.monsterinfo.healer->svflags & SVF_MONSTER) && (ent.monsterinfo.healer->monsterinfo.aiflags & AI_MEDIC))
+			if ((ent.monsterinfo->healer->inuse) && (ent.monsterinfo->healer->health > 0) &&
+				(ent.monsterinfo->healer->svflags & SVF_MONSTER) && (ent.monsterinfo->healer->monsterinfo->aiflags & AI_MEDIC))
 				continue;
 #else
 		if (ent.owner.has_value())
@@ -196,7 +196,7 @@ static entityref medic_FindDeadMonster(entity &self)
 #endif
 		if (ent.health > 0)
 			continue;
-		if (ent.nextthink != gtime::zero() && ent.think != M_FliesOn)
+		if (ent.get_nextthink() != gtime::zero() && ent.think != M_FliesOn)
 			continue;
 		if (!visible(self, ent))
 			continue;
@@ -237,11 +237,11 @@ static void medic_idle(entity &self)
 #endif
 			self.enemy = ent;
 #ifdef ROGUE_AI
-			self.enemy->monsterinfo.healer = self;
+			self.enemy->monsterinfo->healer = self;
 #else
 			self.enemy->owner = self;
 #endif
-			self.monsterinfo.aiflags |= AI_MEDIC;
+			self.monsterinfo->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 		}
 #ifdef ROGUE_AI
@@ -268,11 +268,11 @@ static void medic_search(entity &self)
 			self.oldenemy = self.enemy;
 			self.enemy = ent;
 #ifdef ROGUE_AI
-			self.enemy->monsterinfo.healer = self;
+			self.enemy->monsterinfo->healer = self;
 #else
 			self.enemy->owner = self;
 #endif
-			self.monsterinfo.aiflags |= AI_MEDIC;
+			self.monsterinfo->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 		}
 	}
@@ -389,7 +389,7 @@ REGISTER_STATIC_SAVABLE(medic_move_stand);
 
 static void medic_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(medic_stand);
@@ -414,7 +414,7 @@ REGISTER_STATIC_SAVABLE(medic_move_walk);
 
 static void medic_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(medic_walk);
@@ -442,7 +442,7 @@ static void medic_run(entity &self)
 	monster_done_dodge (self);
 #endif
 
-	if (!(self.monsterinfo.aiflags & AI_MEDIC))
+	if (!(self.monsterinfo->aiflags & AI_MEDIC))
 	{
 		entityref ent = medic_FindDeadMonster(self);
 
@@ -451,20 +451,20 @@ static void medic_run(entity &self)
 			self.oldenemy = self.enemy;
 			self.enemy = ent;
 #ifdef ROGUE_AI
-			self.enemy->monsterinfo.healer = self;
+			self.enemy->monsterinfo->healer = self;
 #else
 			self.enemy->owner = self;
 #endif
-			self.monsterinfo.aiflags |= AI_MEDIC;
+			self.monsterinfo->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 			return;
 		}
 	}
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(medic_run);
@@ -520,7 +520,7 @@ static void medic_reacttodamage(entity &self, entity &, entity &, int32_t, int32
 
 #ifdef GROUND_ZERO
 	// if we're healing someone, we ignore pain
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 		return;
 
 	if (self.mass > 400)
@@ -531,30 +531,30 @@ static void medic_reacttodamage(entity &self, entity &, entity &, int32_t, int32
 			return;
 		}
 
-		self.monsterinfo.aiflags &= ~(AI_MANUAL_STEERING | AI_HOLD_FRAME);
+		self.monsterinfo->aiflags &= ~(AI_MANUAL_STEERING | AI_HOLD_FRAME);
 
 		gi.sound (self, CHAN_VOICE, commander_sound_pain2);
 
 		if (random() < min(damage * 0.005f, 0.5f))		// no more than 50% chance of big pain
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_pain2);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_pain2);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_pain1);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_pain1);
 	}
 	else
 #endif
 	if (random() < 0.5f)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_pain1);
 		gi.sound(self, CHAN_VOICE, sound_pain1);
 	}
 	else
 	{
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_pain2);
 		gi.sound(self, CHAN_VOICE, sound_pain2);
 	}
 
 #ifdef ROGUE_AI
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		monster_duck_up(self);
 #endif
 }
@@ -603,9 +603,9 @@ static void medic_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -680,7 +680,7 @@ static void medic_die(entity &self, entity &, entity &, int32_t damage, vector)
 	self.deadflag = true;
 	self.takedamage = true;
 
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_death);
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_death);
 }
 
 REGISTER_STATIC_SAVABLE(medic_die);
@@ -692,26 +692,26 @@ REGISTER_STATIC_SAVABLE(medic_die);
 #else
 static void medic_duck_down(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self.monsterinfo.aiflags |= AI_DUCKED;
+	self.monsterinfo->aiflags |= AI_DUCKED;
 	self.bounds.maxs[2] -= 32;
 	self.takedamage = true;
-	self.monsterinfo.pause_time = level.time + 1s;
+	self.monsterinfo->pause_time = level.time + 1s;
 	gi.linkentity(self);
 }
 
 static void medic_duck_hold(entity &self)
 {
-	if (level.time >= self.monsterinfo.pause_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->pause_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 static void medic_duck_up(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DUCKED;
+	self.monsterinfo->aiflags &= ~AI_DUCKED;
 	self.bounds.maxs[2] += 32;
 	self.takedamage = true;
 	gi.linkentity(self);
@@ -754,7 +754,7 @@ static void medic_dodge(entity &self, entity &attacker, gtimef)
 	if (!self.enemy.has_value())
 		self.enemy = attacker;
 
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_duck);
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(medic_dodge);
@@ -786,7 +786,7 @@ static void medic_continue(entity &self)
 {
 	if (visible(self, self.enemy))
 		if (random() <= 0.95f)
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_attackHyperBlaster);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_attackHyperBlaster);
 }
 
 constexpr mframe_t medic_frames_attackBlaster [] = {
@@ -884,12 +884,12 @@ static void medic_cable_attack(entity &self)
 		if (tr.ent.is_world())
 		{
 			// give up on second try
-			if (self.monsterinfo.medicTries > 1)
+			if (self.monsterinfo->medicTries > 1)
 			{
 				abortHeal (self, true, false, true);
 				return;
 			}
-			self.monsterinfo.medicTries++;
+			self.monsterinfo->medicTries++;
 			cleanupHeal (self, 1);
 			return;
 		}
@@ -911,18 +911,18 @@ static void medic_cable_attack(entity &self)
 			(self.mass > 400) ? commander_sound_hook_hit :
 #endif
 			sound_hook_hit);
-		self.enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		self.enemy->monsterinfo->aiflags |= AI_RESURRECTING;
 	}
 	else if (self.frame == FRAME_attack50)
 	{
 		self.enemy->spawnflags = NO_SPAWNFLAGS;
-		self.enemy->monsterinfo.aiflags = AI_NONE;
+		self.enemy->monsterinfo->aiflags = AI_NONE;
 		self.enemy->target = 0;
-		self.enemy->targetname = 0;
+		G_SetTargetname(self.enemy, nullptr);
 		self.enemy->combattarget = 0;
 		self.enemy->deathtarget = 0;
 #ifdef ROGUE_AI
-		self.enemy->monsterinfo.healer = self;
+		self.enemy->monsterinfo->healer = self;
 #else
 		self.enemy->owner = self;
 #endif
@@ -945,7 +945,7 @@ static void medic_cable_attack(entity &self)
 		}
 		else
 		{
-			self.enemy->monsterinfo.aiflags |= AI_DO_NOT_COUNT;
+			self.enemy->monsterinfo->aiflags |= AI_DO_NOT_COUNT;
 #endif
 
 			st.classname = FindClassnameFromEntityType(self.enemy->type);
@@ -957,23 +957,23 @@ static void medic_cable_attack(entity &self)
 #endif
 			if (self.enemy->think)
 			{
-				self.enemy->nextthink = level.time;
+				self.enemy->set_nextthink(level.time);
 				self.enemy->think(self.enemy);
 			}
 #if defined(ROGUE_AI) || defined(GROUND_ZERO)
-			self.enemy->monsterinfo.aiflags |= AI_IGNORE_SHOTS;
+			self.enemy->monsterinfo->aiflags |= AI_IGNORE_SHOTS;
 #endif
 #ifdef ROGUE_AI
-			self.enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
-			self.enemy->monsterinfo.aiflags |= AI_DO_NOT_COUNT;
+			self.enemy->monsterinfo->aiflags &= ~AI_RESURRECTING;
+			self.enemy->monsterinfo->aiflags |= AI_DO_NOT_COUNT;
 			// turn off flies
 			self.enemy->effects &= ~EF_FLIES;
-			self.enemy->monsterinfo.healer = 0;
+			self.enemy->monsterinfo->healer = 0;
 
 			if (self.oldenemy.has_value() && self.oldenemy->inuse && self.oldenemy->health > 0)
 			{
 #else
-			self.enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+			self.enemy->monsterinfo->aiflags |= AI_RESURRECTING;
 
 			if (self.oldenemy.has_value() && self.oldenemy->is_client)
 			{
@@ -989,8 +989,8 @@ static void medic_cable_attack(entity &self)
 				if (!FindTarget (self.enemy))
 				{
 					// no valid enemy, so stop acting
-					self.enemy->monsterinfo.pause_time = gtime::max();
-					self.enemy->monsterinfo.stand (self.enemy);
+					self.enemy->monsterinfo->pause_time = gtime::max();
+					self.enemy->monsterinfo->stand (self.enemy);
 				}
 
 				self.enemy = self.oldenemy = 0;
@@ -998,8 +998,8 @@ static void medic_cable_attack(entity &self)
 				if (!FindTarget (self))
 				{
 					// no valid enemy, so stop acting
-					self.monsterinfo.pause_time = gtime::max();
-					self.monsterinfo.stand (self);
+					self.monsterinfo->pause_time = gtime::max();
+					self.monsterinfo->stand (self);
 					return;
 				}
 			}
@@ -1032,7 +1032,7 @@ static void medic_hook_retract(entity &self)
 		sound_hook_retract);
 
 #ifdef ROGUE_AI
-	self.monsterinfo.aiflags &= ~AI_MEDIC;
+	self.monsterinfo->aiflags &= ~AI_MEDIC;
 
 	if (self.oldenemy.has_value() && self.oldenemy->inuse)
 		self.enemy = self.oldenemy;
@@ -1042,13 +1042,13 @@ static void medic_hook_retract(entity &self)
 		if (!FindTarget (self))
 		{
 			// no valid enemy, so stop acting
-			self.monsterinfo.pause_time = gtime::max();
-			self.monsterinfo.stand (self);
+			self.monsterinfo->pause_time = gtime::max();
+			self.monsterinfo->stand (self);
 			return;
 		}
 	}
 #else
-	self.enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+	self.enemy->monsterinfo->aiflags &= ~AI_RESURRECTING;
 #endif
 }
 
@@ -1101,7 +1101,7 @@ REGISTER_STATIC_SAVABLE(medic_move_attackCable);
 static void medic_start_spawn(entity &self)
 {
 	gi.sound (self, CHAN_WEAPON, commander_sound_spawn);
-	self.monsterinfo.nextframe = FRAME_attack48;
+	self.monsterinfo->nextframe = FRAME_attack48;
 }
 
 static void medic_determine_spawn(entity &self)
@@ -1140,7 +1140,7 @@ static void medic_determine_spawn(entity &self)
 	if (summonStr < 0)
 		summonStr = 0;
 
-	self.monsterinfo.summon_type = summonStr;
+	self.monsterinfo->summon_type = summonStr;
 	AngleVectors (self.angles, &f, &r, nullptr);
 
 // this yields either 1, 3, or 5
@@ -1201,7 +1201,7 @@ static void medic_determine_spawn(entity &self)
 
 		if (num_success)
 		{
-			self.monsterinfo.aiflags |= AI_MANUAL_STEERING;
+			self.monsterinfo->aiflags |= AI_MANUAL_STEERING;
 			self.ideal_yaw = anglemod(self.angles[YAW]) + 180;
 			if (self.ideal_yaw > 360.0f)
 				self.ideal_yaw -= 360.0f;
@@ -1209,7 +1209,7 @@ static void medic_determine_spawn(entity &self)
 	}
 
 	if (num_success == 0)
-		self.monsterinfo.nextframe = FRAME_attack53;
+		self.monsterinfo->nextframe = FRAME_attack53;
 }
 
 static void medic_spawngrows(entity &self)
@@ -1222,21 +1222,21 @@ static void medic_spawngrows(entity &self)
 	float	current_yaw;
 
 	// if we've been directed to turn around
-	if (self.monsterinfo.aiflags & AI_MANUAL_STEERING)
+	if (self.monsterinfo->aiflags & AI_MANUAL_STEERING)
 	{
 		current_yaw = anglemod(self.angles[YAW]);
 		if (fabs(current_yaw - self.ideal_yaw) > 0.1)
 		{
-			self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+			self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 			return;
 		}
 
 		// done turning around
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
-		self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
+		self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 	}
 
-	int32_t summonStr = self.monsterinfo.summon_type;
+	int32_t summonStr = self.monsterinfo->summon_type;
 
 	AngleVectors (self.angles, &f, &r, nullptr);
 
@@ -1270,7 +1270,7 @@ static void medic_spawngrows(entity &self)
 	}
 
 	if (num_success == 0)
-		self.monsterinfo.nextframe = FRAME_attack53;
+		self.monsterinfo->nextframe = FRAME_attack53;
 }
 
 static void medic_finish_spawn(entity &self)
@@ -1281,12 +1281,12 @@ static void medic_finish_spawn(entity &self)
 	int		num_summoned; // should be 1, 3, or 5
 	bool		behind = false;
 
-	if (self.monsterinfo.summon_type < 0)
+	if (self.monsterinfo->summon_type < 0)
 	{
 		behind = true;
-		self.monsterinfo.summon_type *= -1;
+		self.monsterinfo->summon_type *= -1;
 	}
-	int32_t summonStr = self.monsterinfo.summon_type;
+	int32_t summonStr = self.monsterinfo->summon_type;
 
 	AngleVectors (self.angles, &f, &r, nullptr);
 
@@ -1319,17 +1319,17 @@ static void medic_finish_spawn(entity &self)
 
 		if (ent->think)
 		{
-			ent->nextthink = level.time;
+			ent->set_nextthink(level.time);
 			ent->think(ent);
 		}
 
-		ent->monsterinfo.aiflags |= AI_IGNORE_SHOTS | AI_DO_NOT_COUNT | AI_SPAWNED_MEDIC_C;
-		ent->monsterinfo.commander = self;
-		self.monsterinfo.monster_slots--;
+		ent->monsterinfo->aiflags |= AI_IGNORE_SHOTS | AI_DO_NOT_COUNT | AI_SPAWNED_MEDIC_C;
+		ent->monsterinfo->commander = self;
+		self.monsterinfo->monster_slots--;
 
 		entityref designated_enemy;
 
-		if (self.monsterinfo.aiflags & AI_MEDIC)
+		if (self.monsterinfo->aiflags & AI_MEDIC)
 			designated_enemy = self.oldenemy;
 		else
 			designated_enemy = self.enemy;
@@ -1361,7 +1361,7 @@ static void medic_finish_spawn(entity &self)
 		else
 		{
 			ent->enemy = 0;
-			ent->monsterinfo.stand(ent);
+			ent->monsterinfo->stand(ent);
 		}
 	}
 }
@@ -1411,39 +1411,39 @@ static void medic_attack(entity &self)
 #endif
 #ifdef GROUND_ZERO
 	// signal from checkattack to spawn
-	if (self.monsterinfo.aiflags & AI_BLOCKED)
+	if (self.monsterinfo->aiflags & AI_BLOCKED)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_callReinforcements);
-		self.monsterinfo.aiflags &= ~AI_BLOCKED;
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_callReinforcements);
+		self.monsterinfo->aiflags &= ~AI_BLOCKED;
 	}
 #endif
 #ifdef GROUND_ZERO
 	float r = random();
 #endif
 
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 	{
 #ifdef GROUND_ZERO
-		if ((self.mass > 400) && (r > 0.8) && (self.monsterinfo.monster_slots > 2))
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_callReinforcements);
+		if ((self.mass > 400) && (r > 0.8) && (self.monsterinfo->monster_slots > 2))
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_callReinforcements);
 		else
 #endif
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_attackCable);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_attackCable);
 	}
 	else
 	{
 #ifdef GROUND_ZERO
-		if (self.monsterinfo.attack_state == AS_BLIND)
+		if (self.monsterinfo->attack_state == AS_BLIND)
 		{
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_callReinforcements);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_callReinforcements);
 			return;
 		}
 
-		if ((self.mass > 400) && (r > 0.2) && (VectorDistance(self.origin, self.enemy->origin) >= RANGE_MELEE) && (self.monsterinfo.monster_slots > 2))
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_callReinforcements);
+		if ((self.mass > 400) && (r > 0.2) && (VectorDistance(self.origin, self.enemy->origin) >= RANGE_MELEE) && (self.monsterinfo->monster_slots > 2))
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_callReinforcements);
 		else
 #endif
-			self.monsterinfo.currentmove = &SAVABLE(medic_move_attackBlaster);
+			self.monsterinfo->currentmove = &SAVABLE(medic_move_attackBlaster);
 	}
 }
 
@@ -1451,7 +1451,7 @@ REGISTER_STATIC_SAVABLE(medic_attack);
 
 static bool medic_checkattack(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 	{
 #ifdef ROGUE_AI
 		// if our target went away
@@ -1478,34 +1478,34 @@ static bool medic_checkattack(entity &self)
 		}
 		else
 		{
-			self.monsterinfo.attack_state = AS_STRAIGHT;
+			self.monsterinfo->attack_state = AS_STRAIGHT;
 			return false;
 		}
 #endif
 	}
 
 #ifdef GROUND_ZERO
-	if (self.enemy->is_client && !visible(self, self.enemy) && (self.monsterinfo.monster_slots > 2))
+	if (self.enemy->is_client && !visible(self, self.enemy) && (self.monsterinfo->monster_slots > 2))
 	{
-		self.monsterinfo.attack_state = AS_BLIND;
+		self.monsterinfo->attack_state = AS_BLIND;
 		return true;
 	}
 
 	// give a LARGE bias to spawning things when we have room
 	// use AI_BLOCKED as a signal to attack to spawn
-	if ((random() < 0.8) && (self.monsterinfo.monster_slots > 5) && (VectorDistance(self.origin, self.enemy->origin) > 150))
+	if ((random() < 0.8) && (self.monsterinfo->monster_slots > 5) && (VectorDistance(self.origin, self.enemy->origin) > 150))
 	{
-		self.monsterinfo.aiflags |= AI_BLOCKED;
-		self.monsterinfo.attack_state = AS_MISSILE;
+		self.monsterinfo->aiflags |= AI_BLOCKED;
+		self.monsterinfo->attack_state = AS_MISSILE;
 		return true;
 	}
 
 	// since his idle animation looks kinda bad in combat, if we're not in easy mode, always attack
 	// when he's on a combat point
 	if (skill > 0)
-		if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+		if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 		{
-			self.monsterinfo.attack_state = AS_MISSILE;
+			self.monsterinfo->attack_state = AS_MISSILE;
 			return true;
 		}
 #endif
@@ -1523,9 +1523,9 @@ static void MedicCommanderCache()
 	{
 		entity &newEnt = G_Spawn();
 
-		newEnt.type = reinforcements[i];
+		G_SetType(newEnt, reinforcements[i]);
 
-		newEnt.monsterinfo.aiflags |= AI_DO_NOT_COUNT;
+		newEnt.monsterinfo->aiflags |= AI_DO_NOT_COUNT;
 
 		ED_CallSpawn(newEnt);
 
@@ -1542,57 +1542,57 @@ static void MedicCommanderCache()
 static void medic_duck(entity &self, gtimef eta)
 {
 	//	don't dodge if you're healing
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 		return;
 
-	if ((self.monsterinfo.currentmove == &medic_move_attackHyperBlaster) ||
-		(self.monsterinfo.currentmove == &medic_move_attackCable) ||
-		(self.monsterinfo.currentmove == &medic_move_attackBlaster)
+	if ((self.monsterinfo->currentmove == &medic_move_attackHyperBlaster) ||
+		(self.monsterinfo->currentmove == &medic_move_attackCable) ||
+		(self.monsterinfo->currentmove == &medic_move_attackBlaster)
 #ifdef GROUND_ZERO
-		|| (self.monsterinfo.currentmove == &medic_move_callReinforcements)
+		|| (self.monsterinfo->currentmove == &medic_move_callReinforcements)
 #endif
 		)
 	{
 		// he ignores skill
-		self.monsterinfo.aiflags &= ~AI_DUCKED;
+		self.monsterinfo->aiflags &= ~AI_DUCKED;
 		return;
 	}
 
 	if (!skill)
 		// PMM - stupid dodge
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
 	else
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
 
 	// has to be done immediately otherwise he can get stuck
 	monster_duck_down(self);
 
-	self.monsterinfo.nextframe = FRAME_duck1;
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_duck);
+	self.monsterinfo->nextframe = FRAME_duck1;
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_duck);
 }
 
 REGISTER_STATIC_SAVABLE(medic_duck);
 
 static void medic_sidestep(entity &self)
 {
-	if ((self.monsterinfo.currentmove == &medic_move_attackHyperBlaster) ||
-		(self.monsterinfo.currentmove == &medic_move_attackCable) ||
-		(self.monsterinfo.currentmove == &medic_move_attackBlaster)
+	if ((self.monsterinfo->currentmove == &medic_move_attackHyperBlaster) ||
+		(self.monsterinfo->currentmove == &medic_move_attackCable) ||
+		(self.monsterinfo->currentmove == &medic_move_attackBlaster)
 #ifdef GROUND_ZERO
-		|| (self.monsterinfo.currentmove == &medic_move_callReinforcements)
+		|| (self.monsterinfo->currentmove == &medic_move_callReinforcements)
 #endif
 		)
 	{
 		// if we're shooting, and not on easy, don't dodge
 		if (skill)
 		{
-			self.monsterinfo.aiflags &= ~AI_DODGING;
+			self.monsterinfo->aiflags &= ~AI_DODGING;
 			return;
 		}
 	}
 
-	if (self.monsterinfo.currentmove != &medic_move_run)
-		self.monsterinfo.currentmove = &SAVABLE(medic_move_run);
+	if (self.monsterinfo->currentmove != &medic_move_run)
+		self.monsterinfo->currentmove = &SAVABLE(medic_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(medic_sidestep);
@@ -1621,7 +1621,7 @@ static void SP_monster_medic(entity &self)
 		return;
 	}
 
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.modelindex = gi.modelindex("models/monsters/medic/tris.md2");
 	self.bounds = {
@@ -1629,18 +1629,20 @@ static void SP_monster_medic(entity &self)
 		.maxs = { 24, 24, 32 }
 	};
 
+	self.monsterinfo.emplace();
+
 #if defined(GROUND_ZERO) || defined(ROGUE_AI)
-	self.monsterinfo.aiflags |= AI_IGNORE_SHOTS;
+	self.monsterinfo->aiflags |= AI_IGNORE_SHOTS;
 #endif
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blocked = SAVABLE(medic_blocked);
-	self.monsterinfo.dodge = SAVABLE(M_MonsterDodge);
-	self.monsterinfo.duck = SAVABLE(medic_duck);
-	self.monsterinfo.unduck = SAVABLE(monster_duck_up);
-	self.monsterinfo.sidestep = SAVABLE(medic_sidestep);
+	self.monsterinfo->blocked = SAVABLE(medic_blocked);
+	self.monsterinfo->dodge = SAVABLE(M_MonsterDodge);
+	self.monsterinfo->duck = SAVABLE(medic_duck);
+	self.monsterinfo->unduck = SAVABLE(monster_duck_up);
+	self.monsterinfo->sidestep = SAVABLE(medic_sidestep);
 #else
-	self.monsterinfo.dodge = SAVABLE(medic_dodge);
+	self.monsterinfo->dodge = SAVABLE(medic_dodge);
 #endif
 
 #ifdef GROUND_ZERO
@@ -1668,11 +1670,11 @@ static void SP_monster_medic(entity &self)
 		self.yaw_speed = 40.f;
 
 		if (skill == 0)
-			self.monsterinfo.monster_slots = 3;
+			self.monsterinfo->monster_slots = 3;
 		else if (skill == 1)
-			self.monsterinfo.monster_slots = 4;
+			self.monsterinfo->monster_slots = 4;
 		else
-			self.monsterinfo.monster_slots = 6;
+			self.monsterinfo->monster_slots = 6;
 	}
 	else
 	{
@@ -1700,20 +1702,20 @@ static void SP_monster_medic(entity &self)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(medic_die);
 
-	self.monsterinfo.stand = SAVABLE(medic_stand);
-	self.monsterinfo.walk = SAVABLE(medic_walk);
-	self.monsterinfo.run = SAVABLE(medic_run);
-	self.monsterinfo.attack = SAVABLE(medic_attack);
-	self.monsterinfo.sight = SAVABLE(medic_sight);
-	self.monsterinfo.idle = SAVABLE(medic_idle);
-	self.monsterinfo.search = SAVABLE(medic_search);
-	self.monsterinfo.checkattack = SAVABLE(medic_checkattack);
-	self.monsterinfo.reacttodamage = SAVABLE(medic_reacttodamage);
+	self.monsterinfo->stand = SAVABLE(medic_stand);
+	self.monsterinfo->walk = SAVABLE(medic_walk);
+	self.monsterinfo->run = SAVABLE(medic_run);
+	self.monsterinfo->attack = SAVABLE(medic_attack);
+	self.monsterinfo->sight = SAVABLE(medic_sight);
+	self.monsterinfo->idle = SAVABLE(medic_idle);
+	self.monsterinfo->search = SAVABLE(medic_search);
+	self.monsterinfo->checkattack = SAVABLE(medic_checkattack);
+	self.monsterinfo->reacttodamage = SAVABLE(medic_reacttodamage);
 
 	gi.linkentity(self);
 
-	self.monsterinfo.currentmove = &SAVABLE(medic_move_stand);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(medic_move_stand);
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
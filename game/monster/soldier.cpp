@@ -150,10 +150,10 @@ REGISTER_STATIC_SAVABLE(soldier_move_stand3);
 
 static void soldier_stand(entity &self)
 {
-	if ((self.monsterinfo.currentmove == &soldier_move_stand3) || (random() < 0.8f))
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_stand1);
+	if ((self.monsterinfo->currentmove == &soldier_move_stand3) || (random() < 0.8f))
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_stand1);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_stand3);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_stand3);
 }
 
 REGISTER_STATIC_SAVABLE(soldier_stand);
@@ -165,7 +165,7 @@ REGISTER_STATIC_SAVABLE(soldier_stand);
 static void soldier_walk1_random(entity &self)
 {
 	if (random() > 0.1f)
-		self.monsterinfo.nextframe = FRAME_walk101;
+		self.monsterinfo->nextframe = FRAME_walk101;
 }
 
 constexpr mframe_t soldier_frames_walk1 [] = {
@@ -226,9 +226,9 @@ REGISTER_STATIC_SAVABLE(soldier_move_walk2);
 static void soldier_walk(entity &self)
 {
 	if (random() < 0.5f)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_walk1);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_walk1);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_walk2);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_walk2);
 }
 
 REGISTER_STATIC_SAVABLE(soldier_walk);
@@ -249,12 +249,12 @@ REGISTER_STATIC_SAVABLE(soldier_move_start_run);
 #ifdef ROGUE_AI
 static void soldier_start_charge (entity &self)
 {
-	self.monsterinfo.aiflags |= AI_CHARGING;
+	self.monsterinfo->aiflags |= AI_CHARGING;
 }
 
 static void soldier_stop_charge (entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_CHARGING;
+	self.monsterinfo->aiflags &= ~AI_CHARGING;
 }
 #endif
 
@@ -284,17 +284,17 @@ static void soldier_run(entity &self)
 	monster_done_dodge (self);
 #endif
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND) {
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_stand1);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND) {
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_stand1);
 		return;
 	}
 
-	if (self.monsterinfo.currentmove == &soldier_move_walk1 ||
-		self.monsterinfo.currentmove == &soldier_move_walk2 ||
-		self.monsterinfo.currentmove == &soldier_move_start_run) {
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_run);
+	if (self.monsterinfo->currentmove == &soldier_move_walk1 ||
+		self.monsterinfo->currentmove == &soldier_move_walk2 ||
+		self.monsterinfo->currentmove == &soldier_move_start_run) {
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_run);
 	} else {
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_start_run);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_start_run);
 	}
 }
 
@@ -382,18 +382,18 @@ static void soldier_reacttodamage(entity &self, entity &, entity &, int32_t, int
 	soldier_stop_charge(self);
 
 	// if we're blind firing, this needs to be turned off here
-	self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+	self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 #endif
 
 	if (level.time < self.pain_debounce_time)
 	{
-		if ((self.velocity.z > 100) && ((self.monsterinfo.currentmove == &soldier_move_pain1) || (self.monsterinfo.currentmove == &soldier_move_pain2) || (self.monsterinfo.currentmove == &soldier_move_pain3)))
+		if ((self.velocity.z > 100) && ((self.monsterinfo->currentmove == &soldier_move_pain1) || (self.monsterinfo->currentmove == &soldier_move_pain2) || (self.monsterinfo->currentmove == &soldier_move_pain3)))
 		{
 #ifdef ROGUE_AI
-			if (self.monsterinfo.aiflags & AI_DUCKED)
+			if (self.monsterinfo->aiflags & AI_DUCKED)
 				monster_duck_up(self);
 #endif
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_pain4);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_pain4);
 		}
 		return;
 	}
@@ -411,11 +411,11 @@ static void soldier_reacttodamage(entity &self, entity &, entity &, int32_t, int
 	if (self.velocity.z > 100)
 	{
 #ifdef ROGUE_AI
-		if (self.monsterinfo.aiflags & AI_DUCKED)
+		if (self.monsterinfo->aiflags & AI_DUCKED)
 			monster_duck_up(self);
 #endif
 
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_pain4);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_pain4);
 		return;
 	}
 
@@ -425,18 +425,18 @@ static void soldier_reacttodamage(entity &self, entity &, entity &, int32_t, int
 	float r = random();
 
 	if (r < 0.33f)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_pain1);
 	else if (r < 0.66f)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_pain2);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_pain3);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_pain3);
 
 #ifdef THE_RECKONING
 	soldierh_end_hyper_sound(self);
 #endif
 
 #ifdef ROGUE_AI
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		monster_duck_up(self);
 #endif
 }
@@ -514,7 +514,7 @@ static void soldier_fire(entity &self, int32_t flash_number)
 
 	if (!self.enemy.has_value() || !self.enemy->inuse)
 	{
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 		return;
 	}
 
@@ -625,11 +625,11 @@ static void soldier_fire(entity &self, int32_t flash_number)
 #endif
 			monster_fire_shotgun(self, start, aim, 2, 1, DEFAULT_SHOTGUN_HSPREAD, DEFAULT_SHOTGUN_VSPREAD, DEFAULT_SHOTGUN_COUNT, flash_index);
 	} else {
-		if (!(self.monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(self.monsterinfo->aiflags & AI_HOLD_FRAME))
 #ifdef ROGUE_AI
 			self.wait =
 #else
-			self.monsterinfo.pause_time = 
+			self.monsterinfo->pause_time = 
 #endif
 				level.time + random(300ms, 1000ms);
 
@@ -644,12 +644,12 @@ static void soldier_fire(entity &self, int32_t flash_number)
 #ifdef ROGUE_AI
 			self.wait
 #else
-			self.monsterinfo.pause_time
+			self.monsterinfo->pause_time
 #endif
 			)
-			self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 		else
-			self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+			self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -689,9 +689,9 @@ static void soldier_fire1(entity &self)
 static void soldier_attack1_refire1(entity &self)
 {
 #ifdef ROGUE_AI
-	if (self.monsterinfo.aiflags & AI_MANUAL_STEERING)
+	if (self.monsterinfo->aiflags & AI_MANUAL_STEERING)
 	{
-		self.monsterinfo.aiflags &= ~AI_MANUAL_STEERING;
+		self.monsterinfo->aiflags &= ~AI_MANUAL_STEERING;
 		return;
 	}
 #endif
@@ -706,9 +706,9 @@ static void soldier_attack1_refire1(entity &self)
 		return;
 
 	if (((skill == 3) && (random() < 0.5f)) || (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE))
-		self.monsterinfo.nextframe = FRAME_attak102;
+		self.monsterinfo->nextframe = FRAME_attak102;
 	else
-		self.monsterinfo.nextframe = FRAME_attak110;
+		self.monsterinfo->nextframe = FRAME_attak110;
 }
 
 static void soldier_attack1_refire2(entity &self)
@@ -723,7 +723,7 @@ static void soldier_attack1_refire2(entity &self)
 		return;
 
 	if (((skill == 3) && (random() < 0.5f)) || (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE))
-		self.monsterinfo.nextframe = FRAME_attak102;
+		self.monsterinfo->nextframe = FRAME_attak102;
 }
 
 constexpr mframe_t soldier_frames_attack1 [] = {
@@ -801,9 +801,9 @@ static void soldier_attack2_refire1(entity &self)
 		return;
 
 	if (((skill == 3) && (random() < 0.5f)) || (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE))
-		self.monsterinfo.nextframe = FRAME_attak204;
+		self.monsterinfo->nextframe = FRAME_attak204;
 	else
-		self.monsterinfo.nextframe = FRAME_attak216;
+		self.monsterinfo->nextframe = FRAME_attak216;
 }
 
 static void soldier_attack2_refire2(entity &self)
@@ -818,7 +818,7 @@ static void soldier_attack2_refire2(entity &self)
 		return;
 
 	if (((skill == 3) && (random() < 0.5f)) || (VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE))
-		self.monsterinfo.nextframe = FRAME_attak204;
+		self.monsterinfo->nextframe = FRAME_attak204;
 }
 
 constexpr mframe_t soldier_frames_attack2 [] = {
@@ -863,18 +863,18 @@ REGISTER_STATIC_SAVABLE(soldier_move_attack2);
 #else
 static void soldier_duck_down(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_DUCKED)
+	if (self.monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self.monsterinfo.aiflags |= AI_DUCKED;
+	self.monsterinfo->aiflags |= AI_DUCKED;
 	self.bounds.maxs.z -= 32;
 	self.takedamage = true;
-	self.monsterinfo.pause_time = level.time + 1s;
+	self.monsterinfo->pause_time = level.time + 1s;
 	gi.linkentity(self);
 }
 
 static void soldier_duck_up(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DUCKED;
+	self.monsterinfo->aiflags &= ~AI_DUCKED;
 	self.bounds.maxs.z += 32;
 	self.takedamage = true;
 	gi.linkentity(self);
@@ -884,7 +884,7 @@ static void soldier_duck_up(entity &self)
 static void soldier_fire3(entity &self)
 {
 #ifdef GROUND_ZERO
-	if (!(self.monsterinfo.aiflags & AI_DUCKED))
+	if (!(self.monsterinfo->aiflags & AI_DUCKED))
 #endif
 		soldier_duck_down(self);
 	soldier_fire(self, 2);
@@ -894,12 +894,12 @@ static void soldier_attack3_refire(entity &self)
 {
 	if ((level.time + 400ms) <
 #ifdef ROGUE_AI
-		self.monsterinfo.duck_wait_time
+		self.monsterinfo->duck_wait_time
 #else
-		self.monsterinfo.pause_time
+		self.monsterinfo->pause_time
 #endif
 		)
-		self.monsterinfo.nextframe = FRAME_attak303;
+		self.monsterinfo->nextframe = FRAME_attak303;
 }
 
 constexpr mframe_t soldier_frames_attack3 [] = {
@@ -974,7 +974,7 @@ static void soldier_attack6_refire(entity &self)
 		 || (random() < (0.25f * skill))
 #endif
 		)
-		self.monsterinfo.nextframe = FRAME_runs03;
+		self.monsterinfo->nextframe = FRAME_runs03;
 }
 
 constexpr mframe_t soldier_frames_attack6 [] =
@@ -1012,22 +1012,22 @@ static void soldier_attack(entity &self)
 	monster_done_dodge (self);
 
 	// PMM - blindfire!
-	if (self.monsterinfo.attack_state == AS_BLIND)
+	if (self.monsterinfo->attack_state == AS_BLIND)
 	{
 		float chance = 0.1f;
 		// setup shot probabilities
-		if (self.monsterinfo.blind_fire_framedelay < 1s)
+		if (self.monsterinfo->blind_fire_framedelay < 1s)
 			chance = 1.0f;
-		else if (self.monsterinfo.blind_fire_framedelay < 7.5s)
+		else if (self.monsterinfo->blind_fire_framedelay < 7.5s)
 			chance = 0.4f;
 
 		float r = random();
 
 		// minimum of 2 seconds, plus 0-3, after the shots are done
-		self.monsterinfo.blind_fire_framedelay += duration_cast<gtime>(random(4.1s, 7.1s));
+		self.monsterinfo->blind_fire_framedelay += duration_cast<gtime>(random(4.1s, 7.1s));
 
 		// don't shoot at the origin
-		if (!self.monsterinfo.blind_fire_target)
+		if (!self.monsterinfo->blind_fire_target)
 			return;
 
 		// don't shoot if the dice say not to
@@ -1035,21 +1035,21 @@ static void soldier_attack(entity &self)
 			return;
 
 		// turn on manual steering to signal both manual steering and blindfire
-		self.monsterinfo.aiflags |= AI_MANUAL_STEERING;
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack1);
-		self.monsterinfo.attack_finished = level.time + duration_cast<gtime>(random(1.5s, 2.5s));
+		self.monsterinfo->aiflags |= AI_MANUAL_STEERING;
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack1);
+		self.monsterinfo->attack_finished = level.time + duration_cast<gtime>(random(1.5s, 2.5s));
 		return;
 	}
 
 	float r = random();
 
-	if ((!(self.monsterinfo.aiflags & (AI_BLOCKED|AI_STAND_GROUND))) &&
+	if ((!(self.monsterinfo->aiflags & (AI_BLOCKED|AI_STAND_GROUND))) &&
 		(VectorDistance(self.origin, self.enemy->origin) >= RANGE_MID) && 
 		(r < (skill * 0.25) && 
 		(self.skinnum <= 3)) &&
 		(visible(self, self.enemy)))
 	{
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack6);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack6);
 		return;
 	}
 #endif
@@ -1057,13 +1057,13 @@ static void soldier_attack(entity &self)
 	if (self.skinnum < 4)
 	{
 		if (random() < 0.5f)
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack1);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack1);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack2);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack2);
 	}
 	else
 	{
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack4);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack4);
 	}
 }
 
@@ -1085,12 +1085,12 @@ static void soldier_sight(entity &self, entity &)
 #if defined(THE_RECKONING) || defined(GROUND_ZERO)
 		{
 			if (self.skinnum < 4)	
-				self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack6);
+				self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack6);
 			else
-				self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack4);
+				self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack4);
 		}
 #else
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack6);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack6);
 #endif
 	}
 }
@@ -1104,10 +1104,10 @@ REGISTER_STATIC_SAVABLE(soldier_sight);
 #ifndef ROGUE_AI
 static void soldier_duck_hold(entity &self)
 {
-	if (level.time >= self.monsterinfo.pause_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->pause_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 #endif
 
@@ -1139,30 +1139,30 @@ static void soldier_dodge(entity &self, entity &attacker, gtimef eta)
 #endif
 
 	if (!skill) {
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_duck);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_duck);
 		return;
 	}
 
-	self.monsterinfo.pause_time = duration_cast<gtime>(level.time + (eta + 300ms));
+	self.monsterinfo->pause_time = duration_cast<gtime>(level.time + (eta + 300ms));
 	r = random();
 
 	if (skill == 1) {
 		if (r > 0.33f)
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_duck);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_duck);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack3);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack3);
 		return;
 	}
 
 	if (skill >= 2) {
 		if (r > 0.66f)
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_duck);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_duck);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack3);
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack3);
 		return;
 	}
 
-	self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack3);
+	self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack3);
 }
 
 REGISTER_STATIC_SAVABLE(soldier_dodge);
@@ -1196,9 +1196,9 @@ static void soldier_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity(self);
 }
 
@@ -1495,21 +1495,21 @@ static void soldier_die(entity &self, entity &, entity &, int32_t damage, vector
 
 	if (fabs((self.origin[2] + self.viewheight) - point[2]) <= 4) {
 		// head shot
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death3);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death3);
 		return;
 	}
 
 	n = Q_rand() % 5;
 	if (n == 0)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death1);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death1);
 	else if (n == 1)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death2);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death2);
 	else if (n == 2)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death4);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death4);
 	else if (n == 3)
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death5);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death5);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_death6);
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_death6);
 }
 
 REGISTER_STATIC_SAVABLE(soldier_die);
@@ -1523,13 +1523,13 @@ static void soldier_sidestep (entity &self)
 {
 	if (self.skinnum <= 3)
 	{
-		if (self.monsterinfo.currentmove != &soldier_move_attack6)
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack6);
+		if (self.monsterinfo->currentmove != &soldier_move_attack6)
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack6);
 	}
 	else
 	{
-		if (self.monsterinfo.currentmove != &soldier_move_start_run)
-			self.monsterinfo.currentmove = &SAVABLE(soldier_move_start_run);
+		if (self.monsterinfo->currentmove != &soldier_move_start_run)
+			self.monsterinfo->currentmove = &SAVABLE(soldier_move_start_run);
 	}
 }
 
@@ -1545,9 +1545,9 @@ static void soldier_duck (entity &self, gtimef eta)
 	if (!skill)
 	{
 		// PMM - stupid dodge
-		self.monsterinfo.nextframe = FRAME_duck01;
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_duck);
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
+		self.monsterinfo->nextframe = FRAME_duck01;
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_duck);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
 
 #ifdef THE_RECKONING
 		soldierh_end_hyper_sound(self);
@@ -1559,15 +1559,15 @@ static void soldier_duck (entity &self, gtimef eta)
 
 	if (r > (skill * 0.3))
 	{
-		self.monsterinfo.nextframe = FRAME_duck01;
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_duck);
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
+		self.monsterinfo->nextframe = FRAME_duck01;
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_duck);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + (100ms * (3 - skill)));
 	}
 	else
 	{
-		self.monsterinfo.nextframe = FRAME_attak301;
-		self.monsterinfo.currentmove = &SAVABLE(soldier_move_attack3);
-		self.monsterinfo.duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
+		self.monsterinfo->nextframe = FRAME_attak301;
+		self.monsterinfo->currentmove = &SAVABLE(soldier_move_attack3);
+		self.monsterinfo->duck_wait_time = duration_cast<gtime>(level.time + eta + 1s);
 	}
 
 #ifdef THE_RECKONING
@@ -1621,7 +1621,7 @@ REGISTER_STATIC_SAVABLE(soldier_move_blind);
 
 static void soldier_blind (entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(soldier_move_blind);
+	self.monsterinfo->currentmove = &SAVABLE(soldier_move_blind);
 }
 
 REGISTER_STATIC_SAVABLE(soldier_blind);
@@ -1629,7 +1629,7 @@ REGISTER_STATIC_SAVABLE(soldier_blind);
 static bool soldier_blocked (entity &self, float dist)
 {
 	// don't do anything if you're dodging
-	if ((self.monsterinfo.aiflags & AI_DODGING) || (self.monsterinfo.aiflags & AI_DUCKED))
+	if ((self.monsterinfo->aiflags & AI_DODGING) || (self.monsterinfo->aiflags & AI_DUCKED))
 		return false;
 
 	if(blocked_checkshot (self, 0.25f + (0.05f * skill)))
@@ -1651,12 +1651,13 @@ REGISTER_STATIC_SAVABLE(soldier_blocked);
 inline void SP_monster_soldier_x(entity &self, stringlit model)
 {
 	self.modelindex = gi.modelindex(model);
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo.emplace();
+	self.monsterinfo->scale = MODEL_SCALE;
 	self.bounds = {
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, 32 }
 	};
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 
 	sound_idle =    gi.soundindex("soldier/solidle1.wav");
@@ -1669,28 +1670,28 @@ inline void SP_monster_soldier_x(entity &self, stringlit model)
 	self.pain = SAVABLE(monster_pain);
 	self.die = SAVABLE(soldier_die);
 
-	self.monsterinfo.stand = SAVABLE(soldier_stand);
-	self.monsterinfo.walk = SAVABLE(soldier_walk);
-	self.monsterinfo.run = SAVABLE(soldier_run);
-	self.monsterinfo.attack = SAVABLE(soldier_attack);
-	self.monsterinfo.sight = SAVABLE(soldier_sight);
-	self.monsterinfo.reacttodamage = SAVABLE(soldier_reacttodamage);
+	self.monsterinfo->stand = SAVABLE(soldier_stand);
+	self.monsterinfo->walk = SAVABLE(soldier_walk);
+	self.monsterinfo->run = SAVABLE(soldier_run);
+	self.monsterinfo->attack = SAVABLE(soldier_attack);
+	self.monsterinfo->sight = SAVABLE(soldier_sight);
+	self.monsterinfo->reacttodamage = SAVABLE(soldier_reacttodamage);
 #ifdef ROGUE_AI
-	self.monsterinfo.dodge = SAVABLE(M_MonsterDodge);
-	self.monsterinfo.blocked = SAVABLE(soldier_blocked);
-	self.monsterinfo.duck = SAVABLE(soldier_duck);
-	self.monsterinfo.unduck = SAVABLE(monster_duck_up);
-	self.monsterinfo.sidestep = SAVABLE(soldier_sidestep);
+	self.monsterinfo->dodge = SAVABLE(M_MonsterDodge);
+	self.monsterinfo->blocked = SAVABLE(soldier_blocked);
+	self.monsterinfo->duck = SAVABLE(soldier_duck);
+	self.monsterinfo->unduck = SAVABLE(monster_duck_up);
+	self.monsterinfo->sidestep = SAVABLE(soldier_sidestep);
 
 	if(self.spawnflags & 8)	// blind
-		self.monsterinfo.stand = SAVABLE(soldier_blind);
+		self.monsterinfo->stand = SAVABLE(soldier_blind);
 #else
-	self.monsterinfo.dodge = SAVABLE(soldier_dodge);
+	self.monsterinfo->dodge = SAVABLE(soldier_dodge);
 #endif
 
 	gi.linkentity(self);
 
-	self.monsterinfo.stand(self);
+	self.monsterinfo->stand(self);
 
 	walkmonster_start(self);
 }
@@ -1719,7 +1720,7 @@ static void SP_monster_soldier_light(entity &self)
 	gi.soundindex("soldier/solatck2.wav");
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blindfire = true;
+	self.monsterinfo->blindfire = true;
 #endif
 }
 
@@ -1806,7 +1807,7 @@ static void SP_monster_soldier_ripper(entity &self)
 	gi.soundindex ("soldier/solatck2.wav");
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blindfire = true;
+	self.monsterinfo->blindfire = true;
 #endif
 }
 
@@ -1834,7 +1835,7 @@ static void SP_monster_soldier_hypergun(entity &self)
 	gi.soundindex ("soldier/solatck1.wav");
 
 #ifdef ROGUE_AI
-	self.monsterinfo.blindfire = true;
+	self.monsterinfo->blindfire = true;
 #endif
 }
 
@@ -303,7 +303,7 @@ bool SV_movestep(entity &ent, vector move, bool relink)
 		return SV_moveswimfly(ent, move, relink, oldorg);
 
 // push down from a step height above the wished position
-	if (!(ent.monsterinfo.aiflags & AI_NOSTEP))
+	if (!(ent.monsterinfo->aiflags & AI_NOSTEP))
 		stepsize = STEPSIZE;
 	else
 		stepsize = 1.f;
@@ -387,7 +387,7 @@ bool SV_movestep(entity &ent, vector move, bool relink)
 				if (!ent.enemy.has_value() || !ent.enemy->inuse)
 				{
 					TargetTesla (ent, new_bad->owner);
-					ent.monsterinfo.aiflags |= AI_BLOCKED;
+					ent.monsterinfo->aiflags |= AI_BLOCKED;
 				}
 				else if (ent.enemy->type == ET_TESLA)
 				{
@@ -396,13 +396,13 @@ bool SV_movestep(entity &ent, vector move, bool relink)
 						if (!visible(ent, ent.enemy))
 						{
 							TargetTesla (ent, new_bad->owner);
-							ent.monsterinfo.aiflags |= AI_BLOCKED;
+							ent.monsterinfo->aiflags |= AI_BLOCKED;
 						}
 					}
 					else
 					{
 						TargetTesla (ent, new_bad->owner);
-						ent.monsterinfo.aiflags |= AI_BLOCKED;
+						ent.monsterinfo->aiflags |= AI_BLOCKED;
 					}
 				}
 			}
@@ -513,7 +513,7 @@ static bool SV_StepDirection(entity &ent, float yaw, float dist)
 			return true;
 
 #ifdef ROGUE_AI
-		ent.monsterinfo.aiflags &= ~AI_BLOCKED;
+		ent.monsterinfo->aiflags &= ~AI_BLOCKED;
 #endif
 		
 		delta = ent.angles[YAW] - ent.ideal_yaw;
@@ -606,7 +606,7 @@ void SV_NewChaseDir(entity &actor, entityref enemy, float dist)
 		return;
 
 #ifdef ROGUE_AI
-	if (actor.monsterinfo.blocked && actor.inuse && actor.health > 0 && actor.monsterinfo.blocked(actor, dist))
+	if (actor.monsterinfo->blocked && actor.inuse && actor.health > 0 && actor.monsterinfo->blocked(actor, dist))
 		return;
 #endif
 
@@ -647,16 +647,16 @@ void M_MoveToGoal(entity &ent, float dist)
 // bump around...
 	if (
 #ifdef ROGUE_AI
-		((Q_rand() & 3) == 1 && !(ent.monsterinfo.aiflags & AI_CHARGING))
+		((Q_rand() & 3) == 1 && !(ent.monsterinfo->aiflags & AI_CHARGING))
 #else
 		(Q_rand() & 3) == 1
 #endif
 		|| !SV_StepDirection(ent, ent.ideal_yaw, dist))
 	{
 #ifdef ROGUE_AI
-		if (ent.monsterinfo.aiflags & AI_BLOCKED)
+		if (ent.monsterinfo->aiflags & AI_BLOCKED)
 		{
-			ent.monsterinfo.aiflags &= ~AI_BLOCKED;
+			ent.monsterinfo->aiflags &= ~AI_BLOCKED;
 			return;
 		}
 #endif
@@ -681,7 +681,7 @@ bool M_walkmove(entity &ent, float yaw, float dist)
 
 #ifdef ROGUE_AI
 	bool retval = SV_movestep(ent, move, true);
-	ent.monsterinfo.aiflags &= ~AI_BLOCKED;
+	ent.monsterinfo->aiflags &= ~AI_BLOCKED;
 	return retval;
 #else
 	return SV_movestep(ent, move, true);
@@ -4,6 +4,8 @@
 #include "phys.h"
 #include "lib/gi.h"
 #include "game/util.h"
+#include "game/profile.h"
+#include "game/think.h"
 #include "lib/types/dynarray.h"
 #include "lib/types/set.h"
 #include "lib/string/format.h"
@@ -68,15 +70,18 @@ Runs thinking code for this frame if necessary
 */
 static inline bool SV_RunThink(entity &ent)
 {
-	if (ent.nextthink <= gtime::zero() || ent.nextthink > level.time)
+	if (!G_ThinkDue(ent))
 		return true;
 
-	ent.nextthink = gtime::zero();
+	ent.set_nextthink(gtime::zero());
 
 	if (!ent.think)
 		gi.dprintfmt("{}: NULL think", ent);
 	else
+	{
+		profile_scope scope(ent.think, PROFILE_THINK);
 		ent.think(ent);
+	}
 
 	return false;
 }
@@ -86,10 +91,16 @@ void SV_Impact(entity &e1, const trace &tr)
 	entity &e2 = tr.ent;
 
 	if (e1.touch && e1.solid != SOLID_NOT)
+	{
+		profile_scope scope(e1.touch, PROFILE_TOUCH);
 		e1.touch(e1, e2, tr.normal, tr.surface);
+	}
 
 	if (e2.touch && e2.solid != SOLID_NOT)
+	{
+		profile_scope scope(e2.touch, PROFILE_TOUCH);
 		e2.touch(e2, e1, vec3_origin, null_surface);
+	}
 }
 
 #ifdef SINGLE_PLAYER
@@ -333,15 +344,12 @@ static bool SV_Push(entity &pusher, vector move, vector amove)
 	gi.linkentity(pusher);
 
 // see if any solid entities are inside the final position
-	for (uint32_t e = 1; e < num_entities; e++)
+	for (entity &check : G_IterateLive(1))
 	{
-		entity &check = itoe(e);
-		if (!check.inuse)
-			continue;
-		if (check.movetype == MOVETYPE_PUSH
-			|| check.movetype == MOVETYPE_STOP
-			|| check.movetype == MOVETYPE_NONE
-			|| check.movetype == MOVETYPE_NOCLIP)
+		if (check.get_movetype() == MOVETYPE_PUSH
+			|| check.get_movetype() == MOVETYPE_STOP
+			|| check.get_movetype() == MOVETYPE_NONE
+			|| check.get_movetype() == MOVETYPE_NOCLIP)
 			continue;
 
 		if (!check.is_linked())
@@ -364,7 +372,7 @@ static bool SV_Push(entity &pusher, vector move, vector amove)
 				continue;
 		}
 
-		if ((pusher.movetype == MOVETYPE_PUSH) || (check.groundentity == pusher)) {
+		if ((pusher.get_movetype() == MOVETYPE_PUSH) || (check.groundentity == pusher)) {
 			// move this entity
 			check.pushed.origin = check.origin;
 			check.pushed.angles = check.angles;
@@ -469,8 +477,8 @@ static void SV_Physics_Pusher(entity &ent)
 		{
 			// the move failed, bump all nextthink times and back out moves
 			for (entity &mv : G_IterateChain<&entity::teamchain>(ent))
-				if (mv.nextthink > gtime::zero())
-					mv.nextthink += 1_hz;
+				if (mv.get_nextthink() > gtime::zero())
+					mv.set_nextthink(mv.get_nextthink() + 1_hz);
 
 			// if the pusher has a "blocked" function, call it
 			// otherwise, just stay in place until the obstacle is gone
@@ -569,12 +577,12 @@ static void SV_Physics_Toss(entity &ent)
 	SV_CheckVelocity(ent);
 
 // add gravity
-	if (ent.movetype != MOVETYPE_FLY
-		&& ent.movetype != MOVETYPE_FLYMISSILE
+	if (ent.get_movetype() != MOVETYPE_FLY
+		&& ent.get_movetype() != MOVETYPE_FLYMISSILE
 #ifdef THE_RECKONING
 		// RAFAEL
 		// move type for rippergun projectile
-		&& ent.movetype != MOVETYPE_WALLBOUNCE
+		&& ent.get_movetype() != MOVETYPE_WALLBOUNCE
 #endif
 		)
 		SV_AddGravity(ent);
@@ -595,11 +603,11 @@ static void SV_Physics_Toss(entity &ent)
 
 #ifdef THE_RECKONING
 		// RAFAEL
-		if (ent.movetype == MOVETYPE_WALLBOUNCE)
+		if (ent.get_movetype() == MOVETYPE_WALLBOUNCE)
 			backoff = 2.0;	
 		else
 #endif
-		if (ent.movetype == MOVETYPE_BOUNCE)
+		if (ent.get_movetype() == MOVETYPE_BOUNCE)
 			backoff = 1.5;
 		else
 			backoff = 1.f;
@@ -608,18 +616,18 @@ static void SV_Physics_Toss(entity &ent)
 
 #ifdef THE_RECKONING
 		// RAFAEL
-		if (ent.movetype == MOVETYPE_WALLBOUNCE)
+		if (ent.get_movetype() == MOVETYPE_WALLBOUNCE)
 			ent.angles = vectoangles (ent.velocity);
 #endif
 
 		// stop if on ground
 		if (tr.normal[2] > 0.7f
 #ifdef THE_RECKONING
-			 && ent.movetype != MOVETYPE_WALLBOUNCE
+			 && ent.get_movetype() != MOVETYPE_WALLBOUNCE
 #endif
 			)
 		{
-			if (ent.velocity.z < 60.f || ent.movetype != MOVETYPE_BOUNCE)
+			if (ent.velocity.z < 60.f || ent.get_movetype() != MOVETYPE_BOUNCE)
 			{
 				ent.groundentity = tr.ent;
 				ent.groundentity_linkcount = tr.ent.linkcount;
@@ -822,10 +830,15 @@ G_RunEntity
 */
 void G_RunEntity(entity &ent)
 {
-	if (ent.prethink)
-		ent.prethink(ent);
+	if (ent.get_prethink())
+	{
+		profile_scope scope(ent.get_prethink(), PROFILE_PRETHINK);
+		ent.get_prethink()(ent);
+	}
+
+	profile_scope scope(ent.get_movetype());
 
-	switch (ent.movetype)
+	switch (ent.get_movetype())
 	{
 	case MOVETYPE_PUSH:
 	case MOVETYPE_STOP:
@@ -867,6 +880,6 @@ void G_RunEntity(entity &ent)
 		SV_Physics_Toss(ent);
 		break;
 	default:
-		gi.errorfmt("SV_Physics: bad movetype {}", (int32_t) ent.movetype);
+		gi.errorfmt("SV_Physics: bad movetype {}", (int32_t) ent.get_movetype());
 	}
 }
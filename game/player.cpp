@@ -27,6 +27,8 @@
 #include "combat.h"
 #include "player_frames.h"
 #include "game/items/entity.h"
+#include "game/profile.h"
+#include "game/pmove.h"
 
 #ifdef SINGLE_PLAYER
 //
@@ -52,8 +54,8 @@ static void SP_FixCoopSpots(entity &self)
 
 		if (VectorLength(d) < 384)
 		{
-			if (!striequals(self.targetname, spot.targetname))
-				self.targetname = spot.targetname;
+			if (self.targetname != spot.targetname)
+				G_SetTargetname(self, spot.targetname);
 
 			return;
 		}
@@ -72,31 +74,31 @@ static void SP_CreateCoopSpots(entity &)
 	{
 		{
 			entity &spot = G_Spawn();
-			spot.type = ET_INFO_PLAYER_COOP;
+			G_SetType(spot, ET_INFO_PLAYER_COOP);
 			spot.origin[0] = 188.f - 64.f;
 			spot.origin[1] = -164.f;
 			spot.origin[2] = 80.f;
-			spot.targetname = "jail3";
+			G_SetTargetname(spot, "jail3");
 			spot.angles[1] = 90.f;
 		}
 
 		{
 			entity &spot = G_Spawn();
-			spot.type = ET_INFO_PLAYER_COOP;
+			G_SetType(spot, ET_INFO_PLAYER_COOP);
 			spot.origin[0] = 188.f + 64.f;
 			spot.origin[1] = -164.f;
 			spot.origin[2] = 80.f;
-			spot.targetname = "jail3";
+			G_SetTargetname(spot, "jail3");
 			spot.angles[1] = 90.f;
 		}
 
 		{
 			entity &spot = G_Spawn();
-			spot.type = ET_INFO_PLAYER_COOP;
+			G_SetType(spot, ET_INFO_PLAYER_COOP);
 			spot.origin[0] = 188.f + 128.f;
 			spot.origin[1] = -164.f;
 			spot.origin[2] = 80.f;
-			spot.targetname = "jail3";
+			G_SetTargetname(spot, "jail3");
 			spot.angles[1] = 90.f;
 		}
 	}
@@ -118,7 +120,7 @@ static void SP_info_player_start(entity &self [[maybe_unused]])
 	{
 		// invoke one of our gross, ugly, disgusting hacks
 		self.think = SAVABLE(SP_CreateCoopSpots);
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	}
 #endif
 }
@@ -172,7 +174,7 @@ static void SP_info_player_coop(entity &self)
 	{
 		// invoke one of our gross, ugly, disgusting hacks
 		self.think = SAVABLE(SP_FixCoopSpots);
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	}
 }
 
@@ -255,7 +257,7 @@ static void TossClientWeapon(entity &self)
 		drop.spawnflags |= DROPPED_PLAYER_ITEM;
 
 		drop.touch = SAVABLE(Touch_Item);
-		drop.nextthink = self.client.quad_time;
+		drop.set_nextthink(self.client.quad_time);
 		drop.think = SAVABLE(G_FreeEdict);
 	}
 	
@@ -268,7 +270,7 @@ static void TossClientWeapon(entity &self)
 		drop.spawnflags |= DROPPED_PLAYER_ITEM;
 
 		drop.touch = SAVABLE(Touch_Item);
-		drop.nextthink = self.client.quadfire_time;
+		drop.set_nextthink(self.client.quadfire_time);
 		drop.think = SAVABLE(G_FreeEdict);
 	}
 #endif
@@ -309,7 +311,7 @@ void player_die(entity &self, entity &inflictor, entity &attacker, int32_t damag
 	self.avelocity = vec3_origin;
 
 	self.takedamage = true;
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 
 	self.modelindex2 = MODEL_NONE; // remove linked weapon model
 #ifdef CTF
@@ -767,10 +769,12 @@ static entityref SelectCoopSpawnPoint(entity &ent)
 	if (!index)
 		return null_entity;
 
+	const atom spawnpoint = atom::find(game.spawnpoint.view());
+
 	// assume there are four coop spots at each spawnpoint
 	for (entity &spot : G_IterateEquals<&entity::type>(ET_INFO_PLAYER_COOP))
 	{
-		if (striequals(game.spawnpoint, spot.targetname))
+		if (spot.targetname == spawnpoint)
 		{
 			// this is a coop spawn point for one of the clients here
 			index--;
@@ -816,13 +820,13 @@ static void SelectSpawnPoint(entity &ent [[maybe_unused]], vector &origin, vecto
 
 	// find a single player start spot
 	if (!spot.has_value())
+	{
+		const atom spawnpoint = atom::find(game.spawnpoint.view());
+
 		while ((spot = G_FindEquals<&entity::type>(spot, ET_INFO_PLAYER_START)).has_value())
-		{
-			if (!game.spawnpoint && !spot->targetname)
-				break;
-			else if (striequals(game.spawnpoint, spot->targetname))
+			if (spot->targetname == spawnpoint)
 				break;
-		}
+	}
 
 	if (!spot.has_value())
 		// there wasn't a spawnpoint found yet
@@ -894,7 +898,7 @@ static void CopyToBodyQue(entity &ent)
 	body.owner = ent.owner;
 	body.velocity = ent.velocity;
 	body.avelocity = ent.avelocity;
-	body.movetype = ent.movetype;
+	body.set_movetype(ent.get_movetype());
 	body.groundentity = ent.groundentity;
 	
 	body.die = SAVABLE(body_die);
@@ -915,7 +919,7 @@ void respawn(entity &self)
 
 #endif
 	// spectator's don't leave bodies
-	if (self.movetype != MOVETYPE_NOCLIP)
+	if (self.get_movetype() != MOVETYPE_NOCLIP)
 		CopyToBodyQue(self);
 	self.svflags &= ~SVF_NOCLIENT;
 	PutClientInServer(self);
@@ -1092,9 +1096,10 @@ void PutClientInServer(entity &ent)
 	// clear entity values
 	ent.groundentity = null_entity;
 	ent.takedamage = true;
-	ent.movetype = MOVETYPE_WALK;
+	ent.set_movetype(MOVETYPE_WALK);
 	ent.viewheight = 22;
 	ent.inuse = true;
+	G_AddLiveEntity(ent);
 	ent.mass = 200;
 	ent.solid = SOLID_BBOX;
 	ent.deadflag = false;
@@ -1143,7 +1148,7 @@ void PutClientInServer(entity &ent)
 		ent.client.chase_target = null_entity;
 		ent.client.resp.spectator = true;
 
-		ent.movetype = MOVETYPE_NOCLIP;
+		ent.set_movetype(MOVETYPE_NOCLIP);
 		ent.solid = SOLID_NOT;
 		ent.svflags |= SVF_NOCLIENT;
 		ent.client.ps.gunindex = MODEL_NONE;
@@ -1412,6 +1417,7 @@ void ClientDisconnect(entity &ent)
 	ent.effects = EF_NONE;
 	ent.solid = SOLID_NOT;
 	ent.inuse = false;
+	G_RemoveLiveEntity(ent);
 	ent.client.pers.connected = false;
 }
 
@@ -1437,14 +1443,18 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 		ent.client.resp.cmd_angles = ucmd.get_angles();
 	else
 	{
+#ifdef CUSTOM_PMOVE
+		const content_flags mask = (ent.health > 0) ? MASK_PLAYERSOLID : MASK_DEADSOLID;
+#else
 		static entityref passent;
 		static content_flags mask;
 
 		passent = ent;
 		mask = (ent.health > 0) ? MASK_PLAYERSOLID : MASK_DEADSOLID;
+#endif
 		
 		// set up for pmove
-		if (ent.movetype == MOVETYPE_NOCLIP)
+		if (ent.get_movetype() == MOVETYPE_NOCLIP)
 			ent.client.ps.pmove.pm_type = PM_SPECTATOR;
 		else if (ent.modelindex != MODEL_PLAYER)
 			ent.client.ps.pmove.pm_type = PM_GIB;
@@ -1460,8 +1470,10 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 #endif
 		pmove pm = pmove(ent.client.ps.pmove);
 
+#ifndef CUSTOM_PMOVE
 		pm.trace = [](auto start, auto mins, auto maxs, auto end) { return gi.trace(start, { mins, maxs }, end, passent, mask); };
 		pm.pointcontents = [](auto point) { return gi.pointcontents(point); };
+#endif
 
 		pm.set_origin(ent.origin);
 		pm.set_velocity(ent.velocity);
@@ -1471,8 +1483,8 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 		pm.cmd = ucmd;
 
 		// perform a pmove
-#ifdef QUAKEC_PMOVE
-		Pmove(&pm);
+#ifdef CUSTOM_PMOVE
+		Pmove(pm, ent, mask);
 #else
 		gi.Pmove(pm);
 #endif
@@ -1520,7 +1532,7 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 
 		gi.linkentity(ent);
 
-		if (ent.movetype != MOVETYPE_NOCLIP)
+		if (ent.get_movetype() != MOVETYPE_NOCLIP)
 			G_TouchTriggers(ent);
 
 #ifdef GROUND_ZERO
@@ -1534,7 +1546,10 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 				break;
 
 			if (other->touch)
+			{
+				profile_scope scope(other->touch, PROFILE_TOUCH);
 				other->touch(other, ent, vec3_origin, null_surface);
+			}
 		}
 	}
 
@@ -1545,7 +1560,7 @@ void ClientThink(entity &ent, const usercmd &ucmd)
 	// fire weapon from final position if needed
 	if ((ent.client.latched_buttons & BUTTON_ATTACK)
 #ifdef CTF
-		&& ent.movetype != MOVETYPE_NOCLIP
+		&& ent.get_movetype() != MOVETYPE_NOCLIP
 #endif
 		)
 	{
@@ -1622,7 +1637,7 @@ void ClientBeginServerFrame(entity &ent)
 	// run weapon animations if it hasn't been done by a ucmd_t
 	if (!ent.client.weapon_thunk && !ent.client.resp.spectator
 #ifdef CTF
-		&& ent->movetype != MOVETYPE_NOCLIP
+		&& ent->get_movetype() != MOVETYPE_NOCLIP
 #endif
 		)
 		Think_Weapon(ent);
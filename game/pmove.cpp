@@ -0,0 +1,1446 @@
+#include "config.h"
+
+#ifdef CUSTOM_PMOVE
+#include "lib/gi.h"
+#include "lib/string/format.h"
+#include "game/entity.h"
+#include "pmove.h"
+
+/*
+
+This is a straight port of pmove.c. The float/double mixing of the
+original is kept as-is on purpose: it's what the client's copy does,
+and any difference in rounding shows up as prediction errors.
+
+*/
+
+constexpr float STEPSIZE = 18;
+
+// can't step up onto very steep slopes
+constexpr float MIN_STEP_NORMAL = 0.7f;
+constexpr size_t MAX_CLIP_PLANES = 5;
+
+constexpr float pm_stopspeed = 100;
+constexpr float pm_maxspeed = 300;
+constexpr float pm_duckspeed = 100;
+constexpr float pm_accelerate = 10;
+constexpr float pm_wateraccelerate = 10;
+constexpr float pm_friction = 6;
+constexpr float pm_waterfriction = 1;
+constexpr float pm_waterspeed = 400;
+
+// the engine uses this one as it was when the map was loaded; since
+// the cvar is latched, the current value is always that.
+static float pm_airaccelerate()
+{
+	static cvarref sv_airaccelerate = gi.cvar("sv_airaccelerate", "0", CVAR_LATCH);
+	return sv_airaccelerate.value;
+}
+
+// number of traces/pointcontents to remember during a single move
+constexpr size_t PMOVE_CACHED_TRACES = 8;
+constexpr size_t PMOVE_CACHED_CONTENTS = 4;
+
+struct pmove_stats
+{
+	uint64_t					moves;
+	uint64_t					traces, cached_traces;
+	uint64_t					contents, cached_contents;
+	std::chrono::nanoseconds	time;
+};
+
+static pmove_stats pmove_totals;
+
+// most recent input per client, kept for "sv pmove bench"
+struct pmove_input
+{
+	pmove			pm;
+	entityref		passent;
+	content_flags	mask;
+};
+
+static array<pmove_input, MAX_CLIENTS> pmove_inputs;
+
+/*
+================
+PM_AngleVectors
+
+q_shared's AngleVectors; the angles go through double
+sin/cos, which the library version doesn't do.
+================
+*/
+static void PM_AngleVectors(const vector &angles, vector &forward, vector &right, vector &up)
+{
+	// M_PI*2 / 360; PI is only a float
+	constexpr double deg2rad = 3.14159265358979323846 * 2 / 360;
+
+	float angle = angles[YAW] * deg2rad;
+	const float sy = (float) std::sin((double) angle);
+	const float cy = (float) std::cos((double) angle);
+	angle = angles[PITCH] * deg2rad;
+	const float sp = (float) std::sin((double) angle);
+	const float cp = (float) std::cos((double) angle);
+	angle = angles[ROLL] * deg2rad;
+	const float sr = (float) std::sin((double) angle);
+	const float cr = (float) std::cos((double) angle);
+
+	forward = { cp * cy, cp * sy, -sp };
+	right = { (-1 * sr * sp * cy + -1 * cr * -sy), (-1 * sr * sp * sy + -1 * cr * cy), -1 * sr * cp };
+	up = { (cr * sp * cy + -sr * -sy), (cr * sp * sy + -sr * cy), cr * cp };
+}
+
+/*
+==================
+PM_ClipVelocity
+
+Slide off of the impacting object
+returns the blocked flags (1 = floor, 2 = step / wall)
+==================
+*/
+static void PM_ClipVelocity(const vector &in, const vector &normal, vector &out, float overbounce)
+{
+	const float backoff = (in * normal) * overbounce;
+
+	for (size_t i = 0; i < 3; i++)
+	{
+		const float change = normal[i] * backoff;
+		out[i] = in[i] - change;
+
+		// STOP_EPSILON from pmove.c is a double
+		if (out[i] > -0.1 && out[i] < 0.1)
+			out[i] = 0;
+	}
+}
+
+// all of the local state for a single move
+struct pmove_local
+{
+	using packed_origin = decltype(pmove_state::origin);
+
+	pmove			&pm;
+	entityref		passent;
+	content_flags	mask;
+
+	// full float precision
+	vector	origin, velocity;
+	vector	forward, right, up;
+	float	frametime = 0;
+
+	const surface	*groundsurface = nullptr;
+	content_flags	groundcontents = CONTENTS_NONE;
+
+	packed_origin	previous_origin;
+	bool			ladder = false;
+
+	// queries already sent to the engine during this move. nothing can
+	// move while a player is moving, so they're good until it's over.
+	struct cached_trace
+	{
+		vector	start, mins, maxs, end;
+		trace	result;
+	};
+
+	struct cached_contents
+	{
+		vector			point;
+		content_flags	result;
+	};
+
+	array<cached_trace, PMOVE_CACHED_TRACES>		traces;
+	size_t											num_traces = 0;
+	array<cached_contents, PMOVE_CACHED_CONTENTS>	contents;
+	size_t											num_contents = 0;
+
+	pmove_local(pmove &pm, entityref passent, content_flags mask) :
+		pm(pm),
+		passent(passent),
+		mask(mask)
+	{
+	}
+
+	// vectors are compared bit for bit; a -0 in place of a 0 can
+	// come out of the engine as a different endpos.
+	static bool same(const vector &a, const vector &b)
+	{
+		return !memcmp(&a, &b, sizeof(vector));
+	}
+
+	// location is passed along so that "sv traces" can
+	// tell the callers apart
+	trace box_trace(const vector &start, const vector &end, std::source_location location = std::source_location::current())
+	{
+		const vector &mins = pm.bounds.mins, &maxs = pm.bounds.maxs;
+		const size_t count = std::min(num_traces, PMOVE_CACHED_TRACES);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const cached_trace &c = traces[i];
+
+			if (same(c.start, start) && same(c.end, end) && same(c.mins, mins) && same(c.maxs, maxs))
+			{
+				pmove_totals.cached_traces++;
+				return c.result;
+			}
+		}
+
+		pmove_totals.traces++;
+
+		cached_trace &c = traces[num_traces++ % PMOVE_CACHED_TRACES];
+		c.start = start;
+		c.mins = mins;
+		c.maxs = maxs;
+		c.end = end;
+		c.result = gi.trace(start, pm.bounds, end, passent, mask, location);
+		return c.result;
+	}
+
+	content_flags point_contents(const vector &point, std::source_location location = std::source_location::current())
+	{
+		const size_t count = std::min(num_contents, PMOVE_CACHED_CONTENTS);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			if (same(contents[i].point, point))
+			{
+				pmove_totals.cached_contents++;
+				return contents[i].result;
+			}
+		}
+
+		pmove_totals.contents++;
+
+		cached_contents &c = contents[num_contents++ % PMOVE_CACHED_CONTENTS];
+		c.point = point;
+		c.result = gi.pointcontents(point, location);
+		return c.result;
+	}
+
+	void touch(entity &ent)
+	{
+		if (pm.numtouch < (int32_t) MAX_TOUCH)
+			pm.touchents[pm.numtouch++] = ent;
+	}
+
+	/*
+	==================
+	StepSlideMove_
+
+	Each intersection will try to step over the obstruction instead of
+	sliding along it.
+
+	Returns a new origin, velocity, and contact entity
+	Does not modify any world state?
+	==================
+	*/
+	void StepSlideMove_()
+	{
+		const int32_t numbumps = 4;
+		array<vector, MAX_CLIP_PLANES> planes;
+		const vector primal_velocity = velocity;
+		size_t numplanes = 0;
+		float time_left = frametime;
+
+		for (int32_t bumpcount = 0; bumpcount < numbumps; bumpcount++)
+		{
+			vector end;
+
+			for (size_t i = 0; i < 3; i++)
+				end[i] = origin[i] + time_left * velocity[i];
+
+			const trace tr = box_trace(origin, end);
+
+			if (tr.allsolid)
+			{
+				// entity is trapped in another solid
+				velocity[2] = 0;	// don't build up falling damage
+				return;
+			}
+
+			if (tr.fraction > 0)
+			{
+				// actually covered some distance
+				origin = tr.endpos;
+				numplanes = 0;
+			}
+
+			if (tr.fraction == 1)
+				break;		// moved the entire distance
+
+			// save entity for contact
+			touch(tr.ent);
+
+			time_left -= time_left * tr.fraction;
+
+			// slide along this plane
+			if (numplanes >= MAX_CLIP_PLANES)
+			{
+				// this shouldn't really happen
+				velocity = vec3_origin;
+				break;
+			}
+
+			planes[numplanes] = tr.normal;
+			numplanes++;
+
+			// modify original_velocity so it parallels all of the clip planes
+			size_t i, j;
+
+			for (i = 0; i < numplanes; i++)
+			{
+				PM_ClipVelocity(velocity, planes[i], velocity, 1.01f);
+
+				for (j = 0; j < numplanes; j++)
+					if (j != i && (velocity * planes[j]) < 0)
+						break;	// not ok
+
+				if (j == numplanes)
+					break;
+			}
+
+			// if i != numplanes, go along this plane; otherwise,
+			// go along the crease
+			if (i == numplanes)
+			{
+				if (numplanes != 2)
+				{
+					velocity = vec3_origin;
+					break;
+				}
+
+				const vector dir = CrossProduct(planes[0], planes[1]);
+				const float d = dir * velocity;
+				velocity = dir * d;
+			}
+
+			// if velocity is against the original velocity, stop dead
+			// to avoid tiny occilations in sloping corners
+			if ((velocity * primal_velocity) <= 0)
+			{
+				velocity = vec3_origin;
+				break;
+			}
+		}
+
+		if (pm.pm_time)
+			velocity = primal_velocity;
+	}
+
+	/*
+	==================
+	StepSlideMove
+	==================
+	*/
+	void StepSlideMove()
+	{
+		const vector start_o = origin;
+		const vector start_v = velocity;
+
+		StepSlideMove_();
+
+		const vector down_o = origin;
+		const vector down_v = velocity;
+
+		vector up = start_o;
+		up[2] += STEPSIZE;
+
+		trace tr = box_trace(up, up);
+
+		if (tr.allsolid)
+			return;		// can't step up
+
+		// try sliding above
+		origin = up;
+		velocity = start_v;
+
+		StepSlideMove_();
+
+		// push down the final amount
+		vector down = origin;
+		down[2] -= STEPSIZE;
+		tr = box_trace(origin, down);
+
+		if (!tr.allsolid)
+			origin = tr.endpos;
+
+		up = origin;
+
+		// decide which one went farther
+		const float down_dist = (down_o[0] - start_o[0]) * (down_o[0] - start_o[0])
+			+ (down_o[1] - start_o[1]) * (down_o[1] - start_o[1]);
+		const float up_dist = (up[0] - start_o[0]) * (up[0] - start_o[0])
+			+ (up[1] - start_o[1]) * (up[1] - start_o[1]);
+
+		if (down_dist > up_dist || tr.normal[2] < MIN_STEP_NORMAL)
+		{
+			origin = down_o;
+			velocity = down_v;
+			return;
+		}
+
+		//!! Special case
+		// if we were walking along a plane, then we need to copy the Z over
+		velocity[2] = down_v[2];
+	}
+
+	/*
+	==================
+	Friction
+
+	Handles both ground friction and water friction
+	==================
+	*/
+	void Friction()
+	{
+		const float speed = (float) std::sqrt((double) (velocity[0] * velocity[0] + velocity[1] * velocity[1] + velocity[2] * velocity[2]));
+
+		if (speed < 1)
+		{
+			velocity[0] = 0;
+			velocity[1] = 0;
+			return;
+		}
+
+		float drop = 0;
+
+		// apply ground friction
+		if ((pm.groundentity.has_value() && groundsurface && !(groundsurface->flags & SURF_SLICK)) || ladder)
+		{
+			const float friction = pm_friction;
+			const float control = speed < pm_stopspeed ? pm_stopspeed : speed;
+			drop += control * friction * frametime;
+		}
+
+		// apply water friction
+		if (pm.waterlevel && !ladder)
+			drop += speed * pm_waterfriction * (int32_t) pm.waterlevel * frametime;
+
+		// scale the velocity
+		float newspeed = speed - drop;
+
+		if (newspeed < 0)
+			newspeed = 0;
+
+		newspeed /= speed;
+
+		velocity[0] = velocity[0] * newspeed;
+		velocity[1] = velocity[1] * newspeed;
+		velocity[2] = velocity[2] * newspeed;
+	}
+
+	/*
+	==============
+	Accelerate
+
+	Handles user intended acceleration
+	==============
+	*/
+	void Accelerate(const vector &wishdir, float wishspeed, float accel)
+	{
+		const float currentspeed = velocity * wishdir;
+		const float addspeed = wishspeed - currentspeed;
+
+		if (addspeed <= 0)
+			return;
+
+		float accelspeed = accel * frametime * wishspeed;
+
+		if (accelspeed > addspeed)
+			accelspeed = addspeed;
+
+		for (size_t i = 0; i < 3; i++)
+			velocity[i] += accelspeed * wishdir[i];
+	}
+
+	void AirAccelerate(const vector &wishdir, float wishspeed, float accel)
+	{
+		float wishspd = wishspeed;
+
+		if (wishspd > 30)
+			wishspd = 30;
+
+		const float currentspeed = velocity * wishdir;
+		const float addspeed = wishspd - currentspeed;
+
+		if (addspeed <= 0)
+			return;
+
+		float accelspeed = accel * wishspeed * frametime;
+
+		if (accelspeed > addspeed)
+			accelspeed = addspeed;
+
+		for (size_t i = 0; i < 3; i++)
+			velocity[i] += accelspeed * wishdir[i];
+	}
+
+	/*
+	=============
+	AddCurrents
+	=============
+	*/
+	void AddCurrents(vector &wishvel)
+	{
+		// account for ladders
+		if (ladder && std::fabs(velocity[2]) <= 200)
+		{
+			if ((pm.viewangles[PITCH] <= -15) && (pm.cmd.forwardmove > 0))
+				wishvel[2] = 200;
+			else if ((pm.viewangles[PITCH] >= 15) && (pm.cmd.forwardmove > 0))
+				wishvel[2] = -200;
+			else if (pm.cmd.upmove > 0)
+				wishvel[2] = 200;
+			else if (pm.cmd.upmove < 0)
+				wishvel[2] = -200;
+			else
+				wishvel[2] = 0;
+
+			// limit horizontal speed when on a ladder
+			if (wishvel[0] < -25)
+				wishvel[0] = -25;
+			else if (wishvel[0] > 25)
+				wishvel[0] = 25;
+
+			if (wishvel[1] < -25)
+				wishvel[1] = -25;
+			else if (wishvel[1] > 25)
+				wishvel[1] = 25;
+		}
+
+		// add water currents
+		if (pm.watertype & MASK_CURRENT)
+		{
+			vector v = vec3_origin;
+
+			if (pm.watertype & CONTENTS_CURRENT_0)
+				v[0] += 1;
+			if (pm.watertype & CONTENTS_CURRENT_90)
+				v[1] += 1;
+			if (pm.watertype & CONTENTS_CURRENT_180)
+				v[0] -= 1;
+			if (pm.watertype & CONTENTS_CURRENT_270)
+				v[1] -= 1;
+			if (pm.watertype & CONTENTS_CURRENT_UP)
+				v[2] += 1;
+			if (pm.watertype & CONTENTS_CURRENT_DOWN)
+				v[2] -= 1;
+
+			float s = pm_waterspeed;
+
+			if ((pm.waterlevel == WATER_LEGS) && pm.groundentity.has_value())
+				s /= 2;
+
+			for (size_t i = 0; i < 3; i++)
+				wishvel[i] = wishvel[i] + s * v[i];
+		}
+
+		// add conveyor belt velocities
+		if (pm.groundentity.has_value())
+		{
+			vector v = vec3_origin;
+
+			if (groundcontents & CONTENTS_CURRENT_0)
+				v[0] += 1;
+			if (groundcontents & CONTENTS_CURRENT_90)
+				v[1] += 1;
+			if (groundcontents & CONTENTS_CURRENT_180)
+				v[0] -= 1;
+			if (groundcontents & CONTENTS_CURRENT_270)
+				v[1] -= 1;
+			if (groundcontents & CONTENTS_CURRENT_UP)
+				v[2] += 1;
+			if (groundcontents & CONTENTS_CURRENT_DOWN)
+				v[2] -= 1;
+
+			for (size_t i = 0; i < 3; i++)
+				wishvel[i] = wishvel[i] + 100 * v[i];
+		}
+	}
+
+	/*
+	===================
+	WaterMove
+	===================
+	*/
+	void WaterMove()
+	{
+		vector wishvel;
+
+		// user intentions
+		for (size_t i = 0; i < 3; i++)
+			wishvel[i] = forward[i] * pm.cmd.forwardmove + right[i] * pm.cmd.sidemove;
+
+		if (!pm.cmd.forwardmove && !pm.cmd.sidemove && !pm.cmd.upmove)
+			wishvel[2] -= 60;		// drift towards bottom
+		else
+			wishvel[2] += pm.cmd.upmove;
+
+		AddCurrents(wishvel);
+
+		vector wishdir = wishvel;
+		float wishspeed = VectorNormalize(wishdir);
+
+		if (wishspeed > pm_maxspeed)
+		{
+			wishvel *= pm_maxspeed / wishspeed;
+			wishspeed = pm_maxspeed;
+		}
+
+		wishspeed *= 0.5;
+
+		Accelerate(wishdir, wishspeed, pm_wateraccelerate);
+
+		StepSlideMove();
+	}
+
+	/*
+	===================
+	AirMove
+	===================
+	*/
+	void AirMove()
+	{
+		const float fmove = pm.cmd.forwardmove;
+		const float smove = pm.cmd.sidemove;
+		vector wishvel;
+
+		for (size_t i = 0; i < 2; i++)
+			wishvel[i] = forward[i] * fmove + right[i] * smove;
+
+		wishvel[2] = 0;
+
+		AddCurrents(wishvel);
+
+		vector wishdir = wishvel;
+		float wishspeed = VectorNormalize(wishdir);
+
+		// clamp to server defined max speed
+		const float maxspeed = (pm.pm_flags & PMF_DUCKED) ? pm_duckspeed : pm_maxspeed;
+
+		if (wishspeed > maxspeed)
+		{
+			wishvel *= maxspeed / wishspeed;
+			wishspeed = maxspeed;
+		}
+
+		if (ladder)
+		{
+			Accelerate(wishdir, wishspeed, pm_accelerate);
+
+			if (!wishvel[2])
+			{
+				if (velocity[2] > 0)
+				{
+					velocity[2] -= pm.gravity * frametime;
+
+					if (velocity[2] < 0)
+						velocity[2] = 0;
+				}
+				else
+				{
+					velocity[2] += pm.gravity * frametime;
+
+					if (velocity[2] > 0)
+						velocity[2] = 0;
+				}
+			}
+
+			StepSlideMove();
+		}
+		else if (pm.groundentity.has_value())
+		{
+			// walking on ground
+			velocity[2] = 0; //!!! this is before the accel
+			Accelerate(wishdir, wishspeed, pm_accelerate);
+
+			// PGM	-- fix for negative trigger_gravity fields
+			if (pm.gravity > 0)
+				velocity[2] = 0;
+			else
+				velocity[2] -= pm.gravity * frametime;
+
+			if (!velocity[0] && !velocity[1])
+				return;
+
+			StepSlideMove();
+		}
+		else
+		{
+			// not on ground, so little effect on velocity;
+			// yes, the stock one passes pm_accelerate here
+			if (pm_airaccelerate())
+				AirAccelerate(wishdir, wishspeed, pm_accelerate);
+			else
+				Accelerate(wishdir, wishspeed, 1);
+
+			// add gravity
+			velocity[2] -= pm.gravity * frametime;
+			StepSlideMove();
+		}
+	}
+
+	/*
+	=============
+	CatagorizePosition
+	=============
+	*/
+	void CatagorizePosition()
+	{
+		// if the player hull point one unit down is solid, the player
+		// is on ground
+
+		// see if standing on something solid
+		vector point = { origin[0], origin[1], (float) (origin[2] - 0.25) };
+
+		if (velocity[2] > 180) //!!ZOID changed from 100 to 180 (ramp accel)
+		{
+			pm.pm_flags &= ~PMF_ON_GROUND;
+			pm.groundentity = nullptr;
+		}
+		else
+		{
+			const trace tr = box_trace(origin, point);
+			groundsurface = &tr.surface;
+			groundcontents = tr.contents;
+
+			// the engine always returns an entity, so unlike the stock
+			// one there's no check for a missing one
+			if (tr.normal[2] < 0.7 && !tr.startsolid)
+			{
+				pm.groundentity = nullptr;
+				pm.pm_flags &= ~PMF_ON_GROUND;
+			}
+			else
+			{
+				pm.groundentity = tr.ent;
+
+				// hitting solid ground will end a waterjump
+				if (pm.pm_flags & PMF_TIME_WATERJUMP)
+				{
+					pm.pm_flags &= ~(PMF_TIME_WATERJUMP | PMF_TIME_LAND | PMF_TIME_TELEPORT);
+					pm.pm_time = 0;
+				}
+
+				if (!(pm.pm_flags & PMF_ON_GROUND))
+				{
+					// just hit the ground
+					pm.pm_flags |= PMF_ON_GROUND;
+
+					// don't do landing time if we were just going down a slope
+					if (velocity[2] < -200)
+					{
+						pm.pm_flags |= PMF_TIME_LAND;
+
+						// don't allow another jump for a little while
+						if (velocity[2] < -400)
+							pm.pm_time = 25;
+						else
+							pm.pm_time = 18;
+					}
+				}
+			}
+
+			touch(tr.ent);
+		}
+
+		// get waterlevel, accounting for ducking
+		pm.waterlevel = WATER_NONE;
+		pm.watertype = CONTENTS_NONE;
+
+		const int32_t sample2 = (int32_t) (pm.viewheight - pm.bounds.mins[2]);
+		const int32_t sample1 = sample2 / 2;
+
+		point[2] = origin[2] + pm.bounds.mins[2] + 1;
+		content_flags cont = point_contents(point);
+
+		if (cont & MASK_WATER)
+		{
+			pm.watertype = cont;
+			pm.waterlevel = WATER_LEGS;
+			point[2] = origin[2] + pm.bounds.mins[2] + sample1;
+			cont = point_contents(point);
+
+			if (cont & MASK_WATER)
+			{
+				pm.waterlevel = WATER_WAIST;
+				point[2] = origin[2] + pm.bounds.mins[2] + sample2;
+				cont = point_contents(point);
+
+				if (cont & MASK_WATER)
+					pm.waterlevel = WATER_UNDER;
+			}
+		}
+	}
+
+	/*
+	=============
+	CheckJump
+	=============
+	*/
+	void CheckJump()
+	{
+		// hasn't been long enough since landing to jump again
+		if (pm.pm_flags & PMF_TIME_LAND)
+			return;
+
+		if (pm.cmd.upmove < 10)
+		{
+			// not holding jump
+			pm.pm_flags &= ~PMF_JUMP_HELD;
+			return;
+		}
+
+		// must wait for jump to be released
+		if (pm.pm_flags & PMF_JUMP_HELD)
+			return;
+
+		if (pm.pm_type == PM_DEAD)
+			return;
+
+		if (pm.waterlevel >= WATER_WAIST)
+		{
+			// swimming, not jumping
+			pm.groundentity = nullptr;
+
+			if (velocity[2] <= -300)
+				return;
+
+			if (pm.watertype == CONTENTS_WATER)
+				velocity[2] = 100;
+			else if (pm.watertype == CONTENTS_SLIME)
+				velocity[2] = 80;
+			else
+				velocity[2] = 50;
+
+			return;
+		}
+
+		if (!pm.groundentity.has_value())
+			return;		// in air, so no effect
+
+		pm.pm_flags |= PMF_JUMP_HELD;
+
+		pm.groundentity = nullptr;
+		velocity[2] += 270;
+
+		if (velocity[2] < 270)
+			velocity[2] = 270;
+	}
+
+	/*
+	=============
+	CheckSpecialMovement
+	=============
+	*/
+	void CheckSpecialMovement()
+	{
+		if (pm.pm_time)
+			return;
+
+		ladder = false;
+
+		// check for ladder
+		vector flatforward = { forward[0], forward[1], 0 };
+		VectorNormalize(flatforward);
+
+		vector spot;
+
+		for (size_t i = 0; i < 3; i++)
+			spot[i] = origin[i] + 1 * flatforward[i];
+
+		const trace tr = box_trace(origin, spot);
+
+		if ((tr.fraction < 1) && (tr.contents & CONTENTS_LADDER))
+			ladder = true;
+
+		// check for water jump
+		if (pm.waterlevel != WATER_WAIST)
+			return;
+
+		for (size_t i = 0; i < 3; i++)
+			spot[i] = origin[i] + 30 * flatforward[i];
+
+		spot[2] += 4;
+
+		if (!(point_contents(spot) & CONTENTS_SOLID))
+			return;
+
+		spot[2] += 16;
+
+		if (point_contents(spot))
+			return;
+
+		// jump out of water
+		velocity = flatforward * 50;
+		velocity[2] = 350;
+
+		pm.pm_flags |= PMF_TIME_WATERJUMP;
+		pm.pm_time = 255;
+	}
+
+	/*
+	===============
+	FlyMove
+	===============
+	*/
+	void FlyMove(bool doclip)
+	{
+		pm.viewheight = 22;
+
+		// friction
+		const float speed = VectorLength(velocity);
+
+		if (speed < 1)
+			velocity = vec3_origin;
+		else
+		{
+			float drop = 0;
+
+			const float friction = (float) (pm_friction * 1.5);	// extra friction
+			const float control = speed < pm_stopspeed ? pm_stopspeed : speed;
+			drop += control * friction * frametime;
+
+			// scale the velocity
+			float newspeed = speed - drop;
+
+			if (newspeed < 0)
+				newspeed = 0;
+
+			newspeed /= speed;
+
+			velocity *= newspeed;
+		}
+
+		// accelerate
+		const float fmove = pm.cmd.forwardmove;
+		const float smove = pm.cmd.sidemove;
+
+		VectorNormalize(forward);
+		VectorNormalize(right);
+
+		vector wishvel;
+
+		for (size_t i = 0; i < 3; i++)
+			wishvel[i] = forward[i] * fmove + right[i] * smove;
+
+		wishvel[2] += pm.cmd.upmove;
+
+		vector wishdir = wishvel;
+		float wishspeed = VectorNormalize(wishdir);
+
+		// clamp to server defined max speed
+		if (wishspeed > pm_maxspeed)
+		{
+			wishvel *= pm_maxspeed / wishspeed;
+			wishspeed = pm_maxspeed;
+		}
+
+		const float currentspeed = velocity * wishdir;
+		const float addspeed = wishspeed - currentspeed;
+
+		if (addspeed <= 0)
+			return;
+
+		float accelspeed = pm_accelerate * frametime * wishspeed;
+
+		if (accelspeed > addspeed)
+			accelspeed = addspeed;
+
+		for (size_t i = 0; i < 3; i++)
+			velocity[i] += accelspeed * wishdir[i];
+
+		if (doclip)
+		{
+			vector end;
+
+			for (size_t i = 0; i < 3; i++)
+				end[i] = origin[i] + frametime * velocity[i];
+
+			origin = box_trace(origin, end).endpos;
+		}
+		else
+		{
+			// move
+			for (size_t i = 0; i < 3; i++)
+				origin[i] = origin[i] + frametime * velocity[i];
+		}
+	}
+
+	/*
+	==============
+	CheckDuck
+
+	Sets mins, maxs, and pm->viewheight
+	==============
+	*/
+	void CheckDuck()
+	{
+		pm.bounds.mins[0] = -16;
+		pm.bounds.mins[1] = -16;
+
+		pm.bounds.maxs[0] = 16;
+		pm.bounds.maxs[1] = 16;
+
+		if (pm.pm_type == PM_GIB)
+		{
+			pm.bounds.mins[2] = 0;
+			pm.bounds.maxs[2] = 16;
+			pm.viewheight = 8;
+			return;
+		}
+
+		pm.bounds.mins[2] = -24;
+
+		if (pm.pm_type == PM_DEAD)
+			pm.pm_flags |= PMF_DUCKED;
+		else if (pm.cmd.upmove < 0 && (pm.pm_flags & PMF_ON_GROUND))
+			pm.pm_flags |= PMF_DUCKED;	// duck
+		else if (pm.pm_flags & PMF_DUCKED)
+		{
+			// try to stand up
+			pm.bounds.maxs[2] = 32;
+
+			if (!box_trace(origin, origin).allsolid)
+				pm.pm_flags &= ~PMF_DUCKED;
+		}
+
+		if (pm.pm_flags & PMF_DUCKED)
+		{
+			pm.bounds.maxs[2] = 4;
+			pm.viewheight = -2;
+		}
+		else
+		{
+			pm.bounds.maxs[2] = 32;
+			pm.viewheight = 22;
+		}
+	}
+
+	/*
+	==============
+	DeadMove
+	==============
+	*/
+	void DeadMove()
+	{
+		if (!pm.groundentity.has_value())
+			return;
+
+		// extra friction
+		float forward_speed = VectorLength(velocity);
+		forward_speed -= 20;
+
+		if (forward_speed <= 0)
+			velocity = vec3_origin;
+		else
+		{
+			VectorNormalize(velocity);
+			velocity *= forward_speed;
+		}
+	}
+
+	bool GoodPosition()
+	{
+		if (pm.pm_type == PM_SPECTATOR)
+			return true;
+
+		vector point;
+
+		for (size_t i = 0; i < 3; i++)
+			point[i] = (float) (pm.origin[i] * 0.125);
+
+		return !box_trace(point, point).allsolid;
+	}
+
+	/*
+	================
+	SnapPosition
+
+	On exit, the origin will have a value that is pre-quantized to the 0.125
+	precision of the network channel and in a valid position.
+	================
+	*/
+	void SnapPosition()
+	{
+		// try all single bits first
+		static constexpr int32_t jitterbits[8] = { 0, 4, 1, 2, 3, 5, 6, 7 };
+		array<int32_t, 3> sign;
+
+		// snap velocity to eigths
+		for (size_t i = 0; i < 3; i++)
+			pm.velocity[i] = (int16_t) (int32_t) (velocity[i] * 8);
+
+		for (size_t i = 0; i < 3; i++)
+		{
+			if (origin[i] >= 0)
+				sign[i] = 1;
+			else
+				sign[i] = -1;
+
+			pm.origin[i] = (packed_origin::value_type) (int32_t) (origin[i] * 8);
+
+			if (pm.origin[i] * 0.125 == origin[i])
+				sign[i] = 0;
+		}
+
+		const packed_origin base = pm.origin;
+
+		// try all combinations
+		for (const int32_t bits : jitterbits)
+		{
+			pm.origin = base;
+
+			for (size_t i = 0; i < 3; i++)
+				if (bits & (1 << i))
+					pm.origin[i] += sign[i];
+
+			if (GoodPosition())
+				return;
+		}
+
+		// go back to the last position
+		pm.origin = previous_origin;
+	}
+
+	/*
+	================
+	InitialSnapPosition
+	================
+	*/
+	void InitialSnapPosition()
+	{
+		static constexpr int32_t offset[3] = { 0, -1, 1 };
+		const packed_origin base = pm.origin;
+
+		for (const int32_t z : offset)
+		{
+			pm.origin[2] = base[2] + z;
+
+			for (const int32_t y : offset)
+			{
+				pm.origin[1] = base[1] + y;
+
+				for (const int32_t x : offset)
+				{
+					pm.origin[0] = base[0] + x;
+
+					if (GoodPosition())
+					{
+						for (size_t i = 0; i < 3; i++)
+							origin[i] = (float) (pm.origin[i] * 0.125);
+
+						previous_origin = pm.origin;
+						return;
+					}
+				}
+			}
+		}
+
+		gi.dprint("Bad InitialSnapPosition\n");
+	}
+
+	/*
+	================
+	ClampAngles
+	================
+	*/
+	void ClampAngles()
+	{
+		if (pm.pm_flags & PMF_TIME_TELEPORT)
+		{
+			pm.viewangles[YAW] = (float) ((pm.cmd.angles[YAW] + pm.delta_angles[YAW]) * (360.0 / 65536));
+			pm.viewangles[PITCH] = 0;
+			pm.viewangles[ROLL] = 0;
+		}
+		else
+		{
+			// circularly clamp the angles with deltas
+			for (size_t i = 0; i < 3; i++)
+			{
+				const int16_t temp = (int16_t) (pm.cmd.angles[i] + pm.delta_angles[i]);
+				pm.viewangles[i] = (float) (temp * (360.0 / 65536));
+			}
+
+			// don't let the player look up or down more than 90 degrees
+			if (pm.viewangles[PITCH] > 89 && pm.viewangles[PITCH] < 180)
+				pm.viewangles[PITCH] = 89;
+			else if (pm.viewangles[PITCH] < 271 && pm.viewangles[PITCH] >= 180)
+				pm.viewangles[PITCH] = 271;
+		}
+
+		PM_AngleVectors(pm.viewangles, forward, right, up);
+	}
+
+	void Move()
+	{
+		// clear results
+		pm.numtouch = 0;
+		pm.viewangles = vec3_origin;
+		pm.viewheight = 0;
+		pm.groundentity = nullptr;
+		pm.watertype = CONTENTS_NONE;
+		pm.waterlevel = WATER_NONE;
+
+		// convert origin and velocity to float values
+		for (size_t i = 0; i < 3; i++)
+		{
+			origin[i] = (float) (pm.origin[i] * 0.125);
+			velocity[i] = (float) (pm.velocity[i] * 0.125);
+		}
+
+		// save old org in case we get stuck
+		previous_origin = pm.origin;
+
+		frametime = (float) (pm.cmd.msec * 0.001);
+
+		ClampAngles();
+
+		if (pm.pm_type == PM_SPECTATOR)
+		{
+			FlyMove(false);
+			SnapPosition();
+			return;
+		}
+
+		if (pm.pm_type >= PM_DEAD)
+		{
+			pm.cmd.forwardmove = 0;
+			pm.cmd.sidemove = 0;
+			pm.cmd.upmove = 0;
+		}
+
+		if (pm.pm_type == PM_FREEZE)
+			return;		// no movement at all
+
+		// set mins, maxs, and viewheight
+		CheckDuck();
+
+		if (pm.snapinitial)
+			InitialSnapPosition();
+
+		// set groundentity, watertype, and waterlevel
+		CatagorizePosition();
+
+		if (pm.pm_type == PM_DEAD)
+			DeadMove();
+
+		CheckSpecialMovement();
+
+		// drop timing counter
+		if (pm.pm_time)
+		{
+			int32_t msec = pm.cmd.msec >> 3;
+
+			if (!msec)
+				msec = 1;
+
+			if (msec >= pm.pm_time)
+			{
+				pm.pm_flags &= ~(PMF_TIME_WATERJUMP | PMF_TIME_LAND | PMF_TIME_TELEPORT);
+				pm.pm_time = 0;
+			}
+			else
+				pm.pm_time -= msec;
+		}
+
+		if (pm.pm_flags & PMF_TIME_TELEPORT)
+		{
+			// teleport pause stays exactly in place
+		}
+		else if (pm.pm_flags & PMF_TIME_WATERJUMP)
+		{
+			// waterjump has no control, but falls
+			velocity[2] -= pm.gravity * frametime;
+
+			if (velocity[2] < 0)
+			{
+				// cancel as soon as we are falling down again
+				pm.pm_flags &= ~(PMF_TIME_WATERJUMP | PMF_TIME_LAND | PMF_TIME_TELEPORT);
+				pm.pm_time = 0;
+			}
+
+			StepSlideMove();
+		}
+		else
+		{
+			CheckJump();
+
+			Friction();
+
+			if (pm.waterlevel >= WATER_WAIST)
+				WaterMove();
+			else
+			{
+				vector angles = pm.viewangles;
+
+				if (angles[PITCH] > 180)
+					angles[PITCH] = angles[PITCH] - 360;
+
+				angles[PITCH] /= 3;
+
+				PM_AngleVectors(angles, forward, right, up);
+
+				AirMove();
+			}
+		}
+
+		// set groundentity, watertype, and waterlevel for final spot
+		CatagorizePosition();
+
+		SnapPosition();
+	}
+};
+
+/*
+================
+Pmove
+
+Can be called by either the server or the client
+================
+*/
+void Pmove(pmove &pm, entityref passent, content_flags mask)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	if (passent.has_value() && passent->number >= 1 && passent->number <= (int32_t) MAX_CLIENTS)
+		pmove_inputs[passent->number - 1] = { pm, passent, mask };
+
+	pmove_local(pm, passent, mask).Move();
+
+	pmove_totals.moves++;
+	pmove_totals.time += std::chrono::steady_clock::now() - start;
+}
+
+// compares everything the server reads back out of a move
+static bool PM_SameResult(const pmove &a, const pmove &b)
+{
+	if (memcmp(&static_cast<const pmove_state &>(a), &static_cast<const pmove_state &>(b), sizeof(pmove_state)))
+		return false;
+
+	if (a.numtouch != b.numtouch || a.groundentity != b.groundentity || a.watertype != b.watertype || a.waterlevel != b.waterlevel)
+		return false;
+
+	if (memcmp(&a.viewangles, &b.viewangles, sizeof(vector)) || a.viewheight != b.viewheight ||
+		memcmp(&a.bounds, &b.bounds, sizeof(bbox)))
+		return false;
+
+	for (int32_t i = 0; i < a.numtouch; i++)
+		if (a.touchents[i] != b.touchents[i])
+			return false;
+
+	return true;
+}
+
+/*
+================
+PM_Bench
+
+Runs the last move of every client count times through
+both the engine's Pmove and this one, and checks that
+they agree.
+================
+*/
+static void PM_Bench(size_t count)
+{
+	static entityref bench_passent;
+	static content_flags bench_mask;
+
+	// the bench shouldn't show up in the running totals
+	const pmove_stats saved_totals = pmove_totals;
+	std::chrono::nanoseconds engine_time {}, game_time {};
+	size_t clients = 0, mismatches = 0;
+
+	for (const pmove_input &input : pmove_inputs)
+	{
+		if (!input.passent.has_value() || !input.passent->inuse)
+			continue;
+
+		pmove engine_pm = input.pm, game_pm = input.pm;
+
+		bench_passent = input.passent;
+		bench_mask = input.mask;
+
+		auto started = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			engine_pm = input.pm;
+			engine_pm.trace = [](auto start, auto mins, auto maxs, auto end) { return gi.trace(start, { mins, maxs }, end, bench_passent, bench_mask); };
+			engine_pm.pointcontents = [](auto point) { return gi.pointcontents(point); };
+			gi.Pmove(engine_pm);
+		}
+
+		engine_time += std::chrono::steady_clock::now() - started;
+		started = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i < count; i++)
+		{
+			game_pm = input.pm;
+			pmove_local(game_pm, input.passent, input.mask).Move();
+		}
+
+		game_time += std::chrono::steady_clock::now() - started;
+
+		clients++;
+
+		if (!PM_SameResult(engine_pm, game_pm))
+		{
+			mismatches++;
+			gi.dprintfmt("{}: engine {} / {}, game {} / {}\n", input.passent, engine_pm.get_origin(), engine_pm.get_velocity(),
+				game_pm.get_origin(), game_pm.get_velocity());
+		}
+	}
+
+	pmove_totals = saved_totals;
+
+	if (!clients)
+	{
+		gi.dprint("No moves recorded yet.\n");
+		return;
+	}
+
+	const size_t moves = clients * count;
+
+	gi.dprintfmt("{} clients x {} moves: engine {:.2f}us/move, game {:.2f}us/move, {} mismatched\n", clients, count,
+		engine_time.count() / 1000.f / moves, game_time.count() / 1000.f / moves, mismatches);
+}
+
+/*
+=================
+Svcmd_Pmove_f
+
+sv pmove				- print counters since the last reset
+sv pmove reset			- reset the counters
+sv pmove bench [count]	- time the last move of every client against the engine's Pmove; 1000 runs by default
+=================
+*/
+void Svcmd_Pmove_f()
+{
+	const string cmd = gi.argv(2);
+
+	if (cmd == "reset")
+	{
+		pmove_totals = {};
+		return;
+	}
+	else if (cmd == "bench")
+	{
+		const string arg = gi.argv(3);
+		PM_Bench(arg ? (size_t) std::max(1, atoi(arg.ptr())) : 1000);
+		return;
+	}
+
+	const pmove_stats &s = pmove_totals;
+
+	if (!s.moves)
+	{
+		gi.dprint("No moves yet.\n");
+		return;
+	}
+
+	gi.dprintfmt("{} moves, {:.2f}us/move\n", s.moves, s.time.count() / 1000.f / s.moves);
+	gi.dprintfmt("traces: {:.2f}/move, {} cached ({:.1f}%)\n", (float) s.traces / s.moves, s.cached_traces,
+		s.cached_traces * 100.f / std::max<uint64_t>(1, s.traces + s.cached_traces));
+	gi.dprintfmt("pointcontents: {:.2f}/move, {} cached ({:.1f}%)\n", (float) s.contents / s.moves, s.cached_contents,
+		s.cached_contents * 100.f / std::max<uint64_t>(1, s.contents + s.cached_contents));
+}
+#endif
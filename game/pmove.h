@@ -0,0 +1,32 @@
+#pragma once
+
+#include "config.h"
+
+#ifdef CUSTOM_PMOVE
+/*
+==============================================================================
+
+PLAYER MOVEMENT
+
+==============================================================================
+
+Game-side copy of the engine's player movement. As it ships it is a
+straight port of the stock pmove.c and gives the same results bit for
+bit, so clients keep predicting correctly; anything changed in here has
+to be changed in the client's copy too, or prediction will be off.
+
+Collision queries go straight to gi.trace/gi.pointcontents, so they show
+up per line under "sv traces". Identical queries inside of one move are
+only sent to the engine once; a player standing still repeats most of
+theirs.
+*/
+
+#include "lib/protocol.h"
+#include "game/entity_types.h"
+
+// run one player move. traces skip passent and clip against mask.
+void Pmove(pmove &pm, entityref passent, content_flags mask);
+
+// handler for "sv pmove"
+void Svcmd_Pmove_f();
+#endif
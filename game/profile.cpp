@@ -0,0 +1,249 @@
+#include "config.h"
+
+#ifdef PROFILING
+#include "lib/gi.h"
+#include "lib/string/format.h"
+#include "lib/types/dynarray.h"
+#include "lib/types/map.h"
+#include "game.h"
+#include "profile.h"
+
+using profile_clock = std::chrono::steady_clock;
+
+// the CSV log is rotated to <name>.1 after this many frames
+constexpr uint64_t PROFILE_CSV_FRAMES = 6000;
+
+struct profile_entry
+{
+	string			name;
+	profile_kind	kind;
+
+	// totals since the profiler was started
+	uint64_t					calls;
+	std::chrono::nanoseconds	self, total;
+	// worst self time in a single frame
+	std::chrono::nanoseconds	peak;
+
+	// this frame only
+	uint32_t					frame_calls;
+	std::chrono::nanoseconds	frame_self;
+};
+
+bool profile_active;
+
+static map<const void *, profile_entry>	profile_entries;
+// entries that were called this frame
+static dynarray<profile_entry *>		profile_frame_entries;
+static profile_scope					*profile_current;
+static uint64_t							profile_frames;
+
+static std::ofstream	profile_csv;
+static string			profile_csv_name;
+static uint64_t			profile_csv_frames;
+
+static constexpr stringlit profile_kind_names[] = {
+	"think",
+	"prethink",
+	"touch",
+	"physics"
+};
+
+static constexpr stringlit movetype_names[] = {
+	"MOVETYPE_NONE",
+	"MOVETYPE_NOCLIP",
+	"MOVETYPE_PUSH",
+	"MOVETYPE_STOP",
+	"MOVETYPE_WALK",
+#ifdef SINGLE_PLAYER
+	"MOVETYPE_STEP",
+#endif
+	"MOVETYPE_FLY",
+	"MOVETYPE_TOSS",
+	"MOVETYPE_FLYMISSILE",
+	"MOVETYPE_BOUNCE",
+#ifdef THE_RECKONING
+	"MOVETYPE_WALLBOUNCE"
+#endif
+};
+
+profile_scope::profile_scope(move_type movetype)
+{
+	if (!profile_active || movetype >= lengthof(movetype_names))
+		return;
+
+	begin(&movetype_names[movetype], movetype_names[movetype], PROFILE_PHYSICS);
+}
+
+void profile_scope::begin(const void *key, stringlit name, profile_kind kind)
+{
+	auto [it, added] = profile_entries.try_emplace(key);
+	entry = &it->second;
+
+	if (added)
+	{
+		entry->name = name ? string(name) : string(format("{}", key));
+		entry->kind = kind;
+	}
+
+	parent = profile_current;
+	children = {};
+	profile_current = this;
+	start = profile_clock::now();
+}
+
+void profile_scope::end()
+{
+	const std::chrono::nanoseconds elapsed = profile_clock::now() - start;
+	const std::chrono::nanoseconds self = elapsed - children;
+
+	if (!entry->frame_calls)
+		profile_frame_entries.push_back(entry);
+
+	entry->calls++;
+	entry->self += self;
+	entry->total += elapsed;
+	entry->frame_calls++;
+	entry->frame_self += self;
+
+	if (parent)
+		parent->children += elapsed;
+
+	profile_current = parent;
+}
+
+static void G_ProfileOpenCSV()
+{
+	profile_csv.open(profile_csv_name.ptr(), std::ios::out | std::ios::trunc);
+
+	if (!profile_csv.is_open())
+	{
+		gi.dprintfmt("Couldn't open {} for writing\n", profile_csv_name);
+		return;
+	}
+
+	profile_csv << "frame,time,kind,name,calls,self_us\n";
+	profile_csv_frames = 0;
+}
+
+static void G_ProfileCloseCSV()
+{
+	if (profile_csv.is_open())
+		profile_csv.close();
+}
+
+void G_ProfileEndFrame()
+{
+	// a gi.error inside of a scope never unwinds it
+	profile_current = nullptr;
+
+	if (!profile_active)
+		return;
+
+	profile_frames++;
+
+	if (profile_csv.is_open() && profile_csv_frames++ == PROFILE_CSV_FRAMES)
+	{
+		const string old_name(format("{}.1", profile_csv_name));
+
+		G_ProfileCloseCSV();
+		std::remove(old_name.ptr());
+		std::rename(profile_csv_name.ptr(), old_name.ptr());
+		G_ProfileOpenCSV();
+	}
+
+	for (profile_entry *e : profile_frame_entries)
+	{
+		e->peak = std::max(e->peak, e->frame_self);
+
+		if (profile_csv.is_open())
+			profile_csv << format("{},{},{},{},{},{:.1f}\n", profile_frames, level.time.count(), profile_kind_names[e->kind], e->name,
+				e->frame_calls, e->frame_self.count() / 1000.f);
+
+		e->frame_calls = 0;
+		e->frame_self = {};
+	}
+
+	profile_frame_entries.clear();
+}
+
+static void G_ProfileReset()
+{
+	profile_entries.clear();
+	profile_frame_entries.clear();
+	profile_current = nullptr;
+	profile_frames = 0;
+}
+
+static void G_ProfilePrint(size_t count)
+{
+	if (!profile_frames)
+	{
+		gi.dprint("No frames profiled; use \"sv prof start\".\n");
+		return;
+	}
+
+	dynarray<const profile_entry *> sorted;
+	sorted.reserve(profile_entries.size());
+
+	for (auto &[key, e] : profile_entries)
+		sorted.push_back(&e);
+
+	count = std::min(count, sorted.size());
+
+	std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(), [](const profile_entry *a, const profile_entry *b) {
+		return a->self > b->self;
+	});
+
+	gi.dprintfmt("{} frames, {} entries\n", profile_frames, sorted.size());
+	gi.dprintfmt("{:<9} {:>9} {:>10} {:>10} {:>10} {:>10}  {}\n", "kind", "calls", "self ms", "us/frame", "us/call", "peak us", "name");
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const profile_entry &e = *sorted[i];
+
+		gi.dprintfmt("{:<9} {:>9} {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f}  {}\n", profile_kind_names[e.kind], e.calls,
+			e.self.count() / 1000000.f, e.self.count() / 1000.f / profile_frames, e.self.count() / 1000.f / e.calls,
+			e.peak.count() / 1000.f, e.name);
+	}
+}
+
+/*
+=================
+Svcmd_Prof_f
+
+sv prof start [csv]	- reset and start collecting, optionally logging every frame to csv
+sv prof stop		- stop collecting
+sv prof reset		- throw away everything collected so far
+sv prof [count]		- print the entries with the most self time; 20 by default
+=================
+*/
+void Svcmd_Prof_f()
+{
+	const string cmd = gi.argv(2);
+
+	if (cmd == "start")
+	{
+		G_ProfileReset();
+		G_ProfileCloseCSV();
+
+		if (gi.argc() > 3)
+		{
+			profile_csv_name = gi.argv(3);
+			G_ProfileOpenCSV();
+		}
+
+		profile_active = true;
+		gi.dprint("Profiler started.\n");
+	}
+	else if (cmd == "stop")
+	{
+		profile_active = false;
+		G_ProfileCloseCSV();
+		gi.dprint("Profiler stopped.\n");
+	}
+	else if (cmd == "reset")
+		G_ProfileReset();
+	else
+		G_ProfilePrint(cmd ? (size_t) std::max(1, atoi(cmd.ptr())) : 20);
+}
+#endif
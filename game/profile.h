@@ -0,0 +1,90 @@
+#pragma once
+
+#include "config.h"
+
+/*
+==============================================================================
+
+PROFILER
+
+==============================================================================
+
+Times think, prethink, touch and physics calls made by the frame loop.
+Calls are keyed by their savable, so they show up under the same name
+as in save files; physics is keyed by move type. Each entry tracks self
+time, which excludes any scope that runs inside of it, so a train's
+physics doesn't get billed for the thinks of everything it pushed.
+
+Nothing is collected until "sv prof start" is run.
+*/
+
+#include "lib/std.h"
+
+// which kind of call a profile entry is timing
+enum profile_kind : uint8_t
+{
+	PROFILE_THINK,
+	PROFILE_PRETHINK,
+	PROFILE_TOUCH,
+	PROFILE_PHYSICS
+};
+
+#ifdef PROFILING
+#include "game/entity.h"
+#include "game/savables.h"
+
+// whether the profiler is collecting
+extern bool profile_active;
+
+// times one call for as long as it is in scope
+class profile_scope
+{
+	struct profile_entry		*entry = nullptr;
+	profile_scope				*parent;
+	std::chrono::steady_clock::time_point	start;
+	std::chrono::nanoseconds	children;
+
+	void begin(const void *key, stringlit name, profile_kind kind);
+	void end();
+
+public:
+	template<typename T>
+	inline profile_scope(const T &func, profile_kind kind)
+	{
+		if (!profile_active)
+			return;
+#ifdef SAVING
+		begin(func.registry, func.registry ? func.registry->name : nullptr, kind);
+#else
+		begin((const void *) func, nullptr, kind);
+#endif
+	}
+
+	profile_scope(move_type movetype);
+
+	inline ~profile_scope()
+	{
+		if (entry)
+			end();
+	}
+
+	profile_scope(const profile_scope &) = delete;
+	profile_scope &operator=(const profile_scope &) = delete;
+};
+
+// finish the frame; rolls the frame's numbers into the
+// totals and writes them out to the CSV log, if one is open.
+void G_ProfileEndFrame();
+
+// handler for "sv prof"
+void Svcmd_Prof_f();
+#else
+// profiling disabled; scopes compile away
+struct profile_scope
+{
+	template<typename ...T>
+	constexpr profile_scope(const T &...) { }
+};
+
+constexpr void G_ProfileEndFrame() { }
+#endif
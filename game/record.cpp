@@ -0,0 +1,214 @@
+#include "config.h"
+#include "lib/gi.h"
+#include "lib/types/dynarray.h"
+#include "game.h"
+#include "entity.h"
+#include "record.h"
+
+extern client *clients;
+
+static_assert(sizeof(usercmd) == RECORD_USERCMD_SIZE, "usercmd doesn't match the recording format");
+
+static std::ofstream record_file;
+
+// the last usercmd recorded for each entity number, as bytes
+using record_cmd = array<uint8_t, RECORD_USERCMD_SIZE>;
+static dynarray<record_cmd> record_last_cmds;
+
+static void G_RecordBytes(const void *data, size_t length)
+{
+	record_file.write((const char *) data, length);
+}
+
+template<typename T>
+static void G_RecordValue(const T &value)
+{
+	G_RecordBytes(&value, sizeof(value));
+}
+
+static void G_RecordVarint(uint64_t value)
+{
+	do
+	{
+		uint8_t b = value & 0x7f;
+		value >>= 7;
+
+		if (value)
+			b |= 0x80;
+
+		G_RecordValue(b);
+	} while (value);
+}
+
+static void G_RecordString(std::string_view s)
+{
+	G_RecordVarint(s.size());
+	G_RecordBytes(s.data(), s.size());
+}
+
+static void G_RecordClient(record_op op, const entity &ent)
+{
+	G_RecordValue(op);
+	G_RecordVarint(ent.number);
+}
+
+void G_RecordStop()
+{
+	if (!record_file.is_open())
+		return;
+
+	record_file.close();
+	gi.dprint("Recording stopped.\n");
+}
+
+void G_RecordSpawn(const char *mapname, const char *entities, const char *spawnpoint)
+{
+	// fetched here rather than kept; the string would be stale
+	const cvarref record = gi.cvar("g_record", "", CVAR_NONE);
+
+	if (record.modified || !record)
+	{
+		G_RecordStop();
+		record.modified = false;
+	}
+
+	const bool starting = !record_file.is_open() && record;
+
+	if (starting)
+	{
+		record_file.open(record.string, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!record_file.is_open())
+		{
+			gi.dprintfmt("Couldn't open {} for writing\n", record.string);
+			return;
+		}
+
+		G_RecordValue(RECORD_MAGIC);
+		G_RecordValue(RECORD_VERSION);
+		G_RecordValue(game.maxclients);
+
+		gi.dprintfmt("Recording to {}.\n", record.string);
+	}
+
+	if (!record_file.is_open())
+		return;
+
+	record_last_cmds.assign(game.maxclients + 1, {});
+
+	G_RecordValue(REC_SPAWN);
+	G_RecordString(mapname);
+	G_RecordString(entities);
+	G_RecordString(spawnpoint);
+
+	// clients stay connected across level changes, so ones that
+	// connected before the recording started have to be put in
+	if (starting)
+	{
+		for (uint32_t i = 0; i < game.maxclients; i++)
+		{
+			if (!clients[i].pers.connected)
+				continue;
+
+			G_RecordValue(REC_CONNECT);
+			G_RecordVarint(i + 1);
+			G_RecordString(clients[i].pers.userinfo.view());
+		}
+	}
+}
+
+void G_RecordConnect(const entity &ent, const char *userinfo)
+{
+	if (!record_file.is_open())
+		return;
+
+	record_last_cmds[ent.number] = {};
+
+	G_RecordClient(REC_CONNECT, ent);
+	G_RecordString(userinfo);
+}
+
+void G_RecordBegin(const entity &ent)
+{
+	if (record_file.is_open())
+		G_RecordClient(REC_BEGIN, ent);
+}
+
+void G_RecordUserinfo(const entity &ent, const char *userinfo)
+{
+	if (!record_file.is_open())
+		return;
+
+	G_RecordClient(REC_USERINFO, ent);
+	G_RecordString(userinfo);
+}
+
+void G_RecordDisconnect(const entity &ent)
+{
+	if (record_file.is_open())
+		G_RecordClient(REC_DISCONNECT, ent);
+}
+
+// recorded as one string, so that the replay can tokenize it again
+static void G_RecordCommandLine(std::string_view cmd, std::string_view args)
+{
+	const bool space = !cmd.empty() && !args.empty();
+
+	G_RecordVarint(cmd.size() + space + args.size());
+	G_RecordBytes(cmd.data(), cmd.size());
+
+	if (space)
+		G_RecordValue(' ');
+
+	G_RecordBytes(args.data(), args.size());
+}
+
+void G_RecordCommand(const entity &ent)
+{
+	if (!record_file.is_open())
+		return;
+
+	G_RecordClient(REC_COMMAND, ent);
+	G_RecordCommandLine(gi.argv(0), gi.args());
+}
+
+void G_RecordServerCommand()
+{
+	if (!record_file.is_open())
+		return;
+
+	// argv(0) is "sv", so args() is the whole command
+	G_RecordValue(REC_SERVER);
+	G_RecordCommandLine({}, gi.args());
+}
+
+void G_RecordThink(const entity &ent, const usercmd &cmd)
+{
+	if (!record_file.is_open())
+		return;
+
+	record_cmd &last = record_last_cmds[ent.number];
+	record_cmd bytes;
+	uint16_t changed = 0;
+
+	memcpy(bytes.data(), &cmd, sizeof(cmd));
+
+	for (size_t i = 0; i < bytes.size(); i++)
+		if (bytes[i] != last[i])
+			changed |= 1 << i;
+
+	G_RecordClient(REC_THINK, ent);
+	G_RecordValue(changed);
+
+	for (size_t i = 0; i < bytes.size(); i++)
+		if (changed & (1 << i))
+			G_RecordValue(bytes[i]);
+
+	last = bytes;
+}
+
+void G_RecordFrame()
+{
+	if (record_file.is_open())
+		G_RecordValue(REC_FRAME);
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+==============================================================================
+
+INPUT RECORDING
+
+==============================================================================
+
+Everything the game does follows from the calls the engine makes into it, so
+recording those calls is enough to play a match back without the engine. With
+g_record set to a file name, the next level that starts gets recorded into it,
+and so does every level after it until g_record is cleared:
+
+- SpawnEntities, with the map name, entity string and spawn point
+- ClientConnect, ClientBegin, ClientUserinfoChanged and ClientDisconnect
+- ClientCommand and ServerCommand, as their command lines
+- ClientThink, with the usercmd stored as a delta against the client's last one
+- the end of each RunFrame
+
+Loading a save stops the recording, since the state it starts from can't be
+rebuilt from the log. "bench <script> -replay <log>" feeds a log back into the
+game as fast as it will go.
+
+This header describes the file format too, so that the bench can read it
+without any of the game's headers. All numbers are little-endian; "varint" is
+LEB128 and a string is a varint length followed by that many bytes.
+*/
+
+// "Q2RC"
+constexpr uint32_t RECORD_MAGIC = 0x43523251;
+constexpr uint32_t RECORD_VERSION = 1;
+
+// the header is magic, version, then maxclients; all uint32_t
+
+// size of a usercmd on the wire. a recorded usercmd is a uint16_t mask of
+// the bytes that changed since the last one for that client (all zero
+// at the start of each level), followed by those bytes in order.
+constexpr size_t RECORD_USERCMD_SIZE = 16;
+
+enum record_op : uint8_t
+{
+	REC_SPAWN = 1,	// string mapname, string entities, string spawnpoint
+	REC_CONNECT,	// varint client, string userinfo
+	REC_BEGIN,		// varint client
+	REC_USERINFO,	// varint client, string userinfo
+	REC_DISCONNECT,	// varint client
+	REC_COMMAND,	// varint client, string command line
+	REC_SERVER,		// string command line, without the leading "sv"
+	REC_THINK,		// varint client, usercmd
+	REC_FRAME		// RunFrame
+};
+
+// clients are recorded by entity number
+struct entity;
+struct usercmd;
+
+void G_RecordSpawn(const char *mapname, const char *entities, const char *spawnpoint);
+void G_RecordConnect(const entity &ent, const char *userinfo);
+void G_RecordBegin(const entity &ent);
+void G_RecordUserinfo(const entity &ent, const char *userinfo);
+void G_RecordDisconnect(const entity &ent);
+// reads the command line from gi.argv/gi.args
+void G_RecordCommand(const entity &ent);
+void G_RecordServerCommand();
+void G_RecordThink(const entity &ent, const usercmd &cmd);
+void G_RecordFrame();
+
+// stop recording, if we are
+void G_RecordStop();
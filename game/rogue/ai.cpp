@@ -42,12 +42,12 @@ bool blocked_checkshot(entity &self, float shot_chance)
 	{
 		// turn on AI_BLOCKED to let the monster know the attack is being called
 		// by the blocked functions...
-		self.monsterinfo.aiflags |= AI_BLOCKED;
+		self.monsterinfo->aiflags |= AI_BLOCKED;
 
-		if (self.monsterinfo.attack)
-			self.monsterinfo.attack(self);
+		if (self.monsterinfo->attack)
+			self.monsterinfo->attack(self);
 
-		self.monsterinfo.aiflags &= ~AI_BLOCKED;
+		self.monsterinfo->aiflags &= ~AI_BLOCKED;
 		return true;
 	}
 #endif
@@ -62,12 +62,12 @@ bool blocked_checkshot(entity &self, float shot_chance)
 	{
 		// turn on AI_BLOCKED to let the monster know the attack is being called
 		// by the blocked functions...
-		self.monsterinfo.aiflags |= AI_BLOCKED;
+		self.monsterinfo->aiflags |= AI_BLOCKED;
 
-		if (self.monsterinfo.attack)
-			self.monsterinfo.attack(self);
+		if (self.monsterinfo->attack)
+			self.monsterinfo->attack(self);
 
-		self.monsterinfo.aiflags &= ~AI_BLOCKED;
+		self.monsterinfo->aiflags &= ~AI_BLOCKED;
 		return true;
 	}
 
@@ -97,12 +97,12 @@ bool blocked_checkshot(entity &self, float shot_chance)
 
 		if (tr.ent != self.enemy)
 		{
-			self.monsterinfo.aiflags |= AI_BLOCKED;
+			self.monsterinfo->aiflags |= AI_BLOCKED;
 			
-			if (self.monsterinfo.attack)
-				self.monsterinfo.attack(self);
+			if (self.monsterinfo->attack)
+				self.monsterinfo->attack(self);
 			
-			self.monsterinfo.aiflags &= ~AI_BLOCKED;
+			self.monsterinfo->aiflags &= ~AI_BLOCKED;
 			return true;
 		}
 	}
@@ -157,8 +157,8 @@ bool blocked_checkplat(entity &self, float dist)
 	// if we've found a plat, trigger it.
 	if (player_position == 1)
 	{
-		if ((self.groundentity == plat && plat->moveinfo.state == STATE_BOTTOM) ||
-			(self.groundentity != plat && plat->moveinfo.state == STATE_TOP))
+		if ((self.groundentity == plat && plat->moveinfo->state == STATE_BOTTOM) ||
+			(self.groundentity != plat && plat->moveinfo->state == STATE_TOP))
 		{
 			plat->use (plat, self, self);
 			return true;			
@@ -166,8 +166,8 @@ bool blocked_checkplat(entity &self, float dist)
 	}
 	else if(player_position == -1)
 	{
-		if ((self.groundentity == plat && plat->moveinfo.state == STATE_TOP) ||
-			(self.groundentity != plat && plat->moveinfo.state == STATE_BOTTOM))
+		if ((self.groundentity == plat && plat->moveinfo->state == STATE_TOP) ||
+			(self.groundentity != plat && plat->moveinfo->state == STATE_BOTTOM))
 		{
 			plat->use (plat, self, self);
 			return true;
@@ -289,12 +289,12 @@ static void hintpath_go(entity &self, entity &point)
 {
 	self.ideal_yaw = vectoyaw(point.origin - self.origin);
 	self.goalentity = self.movetarget = point;
-	self.monsterinfo.pause_time = gtime::zero();
-	self.monsterinfo.aiflags |= AI_HINT_PATH;
-	self.monsterinfo.aiflags &= ~(AI_SOUND_TARGET | AI_PURSUIT_LAST_SEEN | AI_PURSUE_NEXT | AI_PURSUE_TEMP);
+	self.monsterinfo->pause_time = gtime::zero();
+	self.monsterinfo->aiflags |= AI_HINT_PATH;
+	self.monsterinfo->aiflags &= ~(AI_SOUND_TARGET | AI_PURSUIT_LAST_SEEN | AI_PURSUE_NEXT | AI_PURSUE_TEMP);
 	// run for it
-	self.monsterinfo.search_time = level.time;
-	self.monsterinfo.run (self);
+	self.monsterinfo->search_time = level.time;
+	self.monsterinfo->run (self);
 }
 
 bool has_valid_enemy(entity &self)
@@ -309,9 +309,9 @@ void hintpath_stop(entity &self)
 {
 	self.goalentity = 0;
 	self.movetarget = 0;
-	self.monsterinfo.last_hint_time = level.time;
-	self.monsterinfo.goal_hint = 0;
-	self.monsterinfo.aiflags &= ~AI_HINT_PATH;
+	self.monsterinfo->last_hint_time = level.time;
+	self.monsterinfo->goal_hint = 0;
+	self.monsterinfo->aiflags &= ~AI_HINT_PATH;
 
 	if (has_valid_enemy(self))
 	{
@@ -332,8 +332,8 @@ void hintpath_stop(entity &self)
 	// will just revert to walking with no target and
 	// the monsters will wonder around aimlessly trying
 	// to hunt the world entity
-	self.monsterinfo.pause_time = gtime::max();
-	self.monsterinfo.stand (self);
+	self.monsterinfo->pause_time = gtime::max();
+	self.monsterinfo->stand (self);
 }
 
 // temp
@@ -363,7 +363,7 @@ bool monsterlost_checkhint(entity &self)
 	if(!self.enemy.has_value())
 		return false;
 
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
 		return false;
 	
 #ifdef GROUND_ZERO
@@ -655,7 +655,7 @@ bool monsterlost_checkhint(entity &self)
 	
 	destination = closest;
 
-	self.monsterinfo.goal_hint = destination;
+	self.monsterinfo->goal_hint = destination;
 	hintpath_go(self, start);
 	return true;
 }
@@ -673,7 +673,7 @@ static void hint_path_touch(entity &self, entity &other, vector, const surface &
 	if (other.movetarget != self)
 		return;
 
-	entityref goal = other.monsterinfo.goal_hint;
+	entityref goal = other.monsterinfo->goal_hint;
 	
 	// if the monster is where he wants to be
 	if (goal == self)
@@ -721,7 +721,7 @@ static void hint_path_touch(entity &self, entity &other, vector, const surface &
 	// have the monster freeze if the hint path we just touched has a wait time
 	// on it, for example, when riding a plat.
 	if (self.wait != gtimef::zero())
-		other.nextthink = duration_cast<gtime>(level.time + self.wait);
+		other.set_nextthink(duration_cast<gtime>(level.time + self.wait));
 }
 
 REGISTER_STATIC_SAVABLE(hint_path_touch);
@@ -809,9 +809,9 @@ void InitHintPaths()
 		current = hint_path_start[i];
 		current->hint_chain_id = i;
 
-		e = G_FindEquals<&entity::targetname>(world, current->target);
+		e = G_FindTargetname(world, current->target);
 
-		if (G_FindEquals<&entity::targetname>(e, current->target).has_value())
+		if (G_FindTargetname(e, current->target).has_value())
 		{
 			gi.dprintfmt("{}: fork detected for chain {}, target {}\n", 
 				current, num_hint_paths, current->target);
@@ -840,8 +840,8 @@ void InitHintPaths()
 			if (!current->target)
 				break;
 
-			e = G_FindEquals<&entity::targetname>(world, current->target);
-			if (G_FindEquals<&entity::targetname>(e, current->target).has_value())
+			e = G_FindTargetname(world, current->target);
+			if (G_FindTargetname(e, current->target).has_value())
 			{
 				gi.dprintfmt("{}: fork detected for chain {}, target {}\n", 
 					current, num_hint_paths, current->target);
@@ -890,16 +890,16 @@ entity &SpawnBadArea(vector cmins, vector cmaxs, gtime lifespan_frames, entityre
 	entity &badarea = G_Spawn();
 	badarea.origin = corigin;
 	badarea.bounds = { .mins = cmins, .maxs = cmaxs };
-	badarea.movetype = MOVETYPE_NONE;
+	badarea.set_movetype(MOVETYPE_NONE);
 	badarea.solid = SOLID_TRIGGER;
-	badarea.type = ET_BAD_AREA;
+	G_SetType(badarea, ET_BAD_AREA);
 	badarea.touch = SAVABLE(badarea_touch);
 	gi.linkentity (badarea);
 
 	if (lifespan_frames != gtime::zero())
 	{
 		badarea.think = SAVABLE(G_FreeEdict);
-		badarea.nextthink = level.time + lifespan_frames;
+		badarea.set_nextthink(level.time + lifespan_frames);
 	}
 
 	badarea.owner = cowner;
@@ -912,7 +912,7 @@ entity &SpawnBadArea(vector cmins, vector cmaxs, gtime lifespan_frames, entityre
 //		for bad area triggers and return them if they're touched.
 entityref CheckForBadArea(entity &ent)
 {
-	dynarray<entityref> entities = gi.BoxEdicts(ent.bounds.offsetted(ent.origin), AREA_TRIGGERS);
+	std::span<entityref> entities = gi.BoxEdicts(ent.bounds.offsetted(ent.origin), AREA_TRIGGERS);
 
 	// be careful, it is possible to have an entity in this
 	// list removed before we get to it (killtriggered)
@@ -975,7 +975,7 @@ bool below(entity &self, entity &other)
 
 void monster_done_dodge(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DODGING;
+	self.monsterinfo->aiflags &= ~AI_DODGING;
 }
 
 //
@@ -987,8 +987,8 @@ void M_MonsterDodge(entity &self, entity &attacker, gtimef eta, trace &tr)
 	if (self.health < 1)
 		return;
 
-	bool ducker = (self.monsterinfo.duck && self.monsterinfo.unduck);
-	bool dodger = (self.monsterinfo.sidestep && !(self.monsterinfo.aiflags & AI_STAND_GROUND));
+	bool ducker = (self.monsterinfo->duck && self.monsterinfo->unduck);
+	bool dodger = (self.monsterinfo->sidestep && !(self.monsterinfo->aiflags & AI_STAND_GROUND));
 
 	if (!ducker && !dodger)
 		return;
@@ -1018,7 +1018,7 @@ void M_MonsterDodge(entity &self, entity &attacker, gtimef eta, trace &tr)
 		// if we only duck, and ducking won't help or we're already ducking, do nothing
 		//
 		// need to add monsterinfo.abort_duck() and monsterinfo.next_duck_time
-		if (!dodger && (tr.endpos[2] <= height || (self.monsterinfo.aiflags & AI_DUCKED)))
+		if (!dodger && (tr.endpos[2] <= height || (self.monsterinfo->aiflags & AI_DUCKED)))
 			return;
 	}
 	else
@@ -1027,43 +1027,43 @@ void M_MonsterDodge(entity &self, entity &attacker, gtimef eta, trace &tr)
 	if (dodger)
 	{
 		// if we're already dodging, just finish the sequence, i.e. don't do anything else
-		if (self.monsterinfo.aiflags & AI_DODGING)
+		if (self.monsterinfo->aiflags & AI_DODGING)
 			return;
 
 		// if we're ducking already, or the shot is at our knees
-		if (tr.endpos[2] <= height || (self.monsterinfo.aiflags & AI_DUCKED))
+		if (tr.endpos[2] <= height || (self.monsterinfo->aiflags & AI_DUCKED))
 		{
 			vector right;
 			AngleVectors (self.angles, nullptr, &right, nullptr);
 
 			vector diff = tr.endpos - self.origin;
 
-			self.monsterinfo.lefty = (right * diff) >= 0;
+			self.monsterinfo->lefty = (right * diff) >= 0;
 	
 			// if we are currently ducked, unduck
 
-			if (ducker && (self.monsterinfo.aiflags & AI_DUCKED))
-				self.monsterinfo.unduck(self);
+			if (ducker && (self.monsterinfo->aiflags & AI_DUCKED))
+				self.monsterinfo->unduck(self);
 
-			self.monsterinfo.aiflags |= AI_DODGING;
-			self.monsterinfo.attack_state = AS_SLIDING;
+			self.monsterinfo->aiflags |= AI_DODGING;
+			self.monsterinfo->attack_state = AS_SLIDING;
 
 			// call the monster specific code here
-			self.monsterinfo.sidestep (self);
+			self.monsterinfo->sidestep (self);
 			return;
 		}
 	}
 
 	if (ducker)
 	{
-		if (self.monsterinfo.next_duck_time > level.time)
+		if (self.monsterinfo->next_duck_time > level.time)
 			return;
 
 		monster_done_dodge (self);
 
 		// set this prematurely; it doesn't hurt, and prevents extra iterations
-		self.monsterinfo.aiflags |= AI_DUCKED;
-		self.monsterinfo.duck(self, eta);
+		self.monsterinfo->aiflags |= AI_DUCKED;
+		self.monsterinfo->duck(self, eta);
 	}
 }
 
@@ -1071,30 +1071,30 @@ REGISTER_SAVABLE(M_MonsterDodge);
 
 void monster_duck_down(entity &self)
 {
-	self.monsterinfo.aiflags |= AI_DUCKED;
-	self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	self.monsterinfo->aiflags |= AI_DUCKED;
+	self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 
-	self.bounds.maxs[2] = self.monsterinfo.base_height - 32;
+	self.bounds.maxs[2] = self.monsterinfo->base_height - 32;
 	self.takedamage = true;
-	if (self.monsterinfo.duck_wait_time < level.time)
-		self.monsterinfo.duck_wait_time = level.time + 1s;
+	if (self.monsterinfo->duck_wait_time < level.time)
+		self.monsterinfo->duck_wait_time = level.time + 1s;
 	gi.linkentity (self);
 }
 
 void monster_duck_hold(entity &self)
 {
-	if (level.time >= self.monsterinfo.duck_wait_time)
-		self.monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self.monsterinfo->duck_wait_time)
+		self.monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self.monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self.monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 void monster_duck_up(entity &self)
 {
-	self.monsterinfo.aiflags &= ~AI_DUCKED;
-	self.bounds.maxs[2] = self.monsterinfo.base_height;
+	self.monsterinfo->aiflags &= ~AI_DUCKED;
+	self.bounds.maxs[2] = self.monsterinfo->base_height;
 	self.takedamage = true;
-	self.monsterinfo.next_duck_time = level.time + DUCK_INTERVAL;
+	self.monsterinfo->next_duck_time = level.time + DUCK_INTERVAL;
 	gi.linkentity (self);
 }
 
@@ -1160,7 +1160,7 @@ bool MarkTeslaArea(entity &tesla)
 		if (tesla.air_finished_time != gtime::zero())
 			area = SpawnBadArea (trigger.absbounds.mins, trigger.absbounds.maxs, tesla.air_finished_time, tesla);
 		else
-			area = SpawnBadArea (trigger.absbounds.mins, trigger.absbounds.maxs, tesla.nextthink, tesla);
+			area = SpawnBadArea (trigger.absbounds.mins, trigger.absbounds.maxs, tesla.get_nextthink(), tesla);
 	}
 	// otherwise we just guess at how long it'll last.
 	else
@@ -1181,29 +1181,29 @@ bool MarkTeslaArea(entity &tesla)
 void TargetTesla(entity &self, entity &tesla)
 {
 	// PMM - medic bails on healing things
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 	{
 #ifdef ROGUE_AI
 		if (self.enemy.has_value())
 			cleanupHealTarget(self.enemy);
 #endif
-		self.monsterinfo.aiflags &= ~AI_MEDIC;
+		self.monsterinfo->aiflags &= ~AI_MEDIC;
 	}
 
 #ifdef ROGUE_AI
 	// store the player enemy in case we lose track of him.
 	if (self.enemy.has_value() && self.enemy->is_client)
-		self.monsterinfo.last_player_enemy = self.enemy;
+		self.monsterinfo->last_player_enemy = self.enemy;
 #endif
 
 	if (self.enemy != tesla)
 	{
 		self.oldenemy = self.enemy;
 		self.enemy = tesla;
-		if (self.monsterinfo.attack)
+		if (self.monsterinfo->attack)
 		{
 			if (self.health > 0)
-				self.monsterinfo.attack(self);
+				self.monsterinfo->attack(self);
 		}
 		else
 			FoundTarget(self);
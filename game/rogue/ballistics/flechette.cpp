@@ -48,7 +48,7 @@ void fire_flechette(entity &self, vector start, vector dir, int32_t damage, int3
 	flechette.angles = vectoangles (dir);
 
 	flechette.velocity = dir * speed;
-	flechette.movetype = MOVETYPE_FLYMISSILE;
+	flechette.set_movetype(MOVETYPE_FLYMISSILE);
 	flechette.clipmask = MASK_SHOT;
 	flechette.solid = SOLID_BBOX;
 	flechette.renderfx = RF_FULLBRIGHT;
@@ -57,7 +57,7 @@ void fire_flechette(entity &self, vector start, vector dir, int32_t damage, int3
 
 	flechette.owner = self;
 	flechette.touch = SAVABLE(flechette_touch);
-	flechette.nextthink = level.time + seconds(8000 / speed);
+	flechette.set_nextthink(level.time + seconds(8000 / speed));
 	flechette.think = SAVABLE(G_FreeEdict);
 	flechette.dmg = damage;
 	flechette.dmg_radius = (float)kick;
@@ -48,7 +48,7 @@ static void Nuke_Quake(entity &self)
 	}
 
 	if (level.time < self.timestamp)
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	else
 		G_FreeEdict (self);
 }
@@ -149,7 +149,7 @@ static void Nuke_Explode(entity &ent)
 	ent.think = SAVABLE(Nuke_Quake);
 	ent.speed = NUKE_QUAKE_STRENGTH;
 	ent.timestamp = level.time + NUKE_QUAKE_TIME;
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.last_move_time = gtime::zero();
 }
 
@@ -212,7 +212,7 @@ static void Nuke_Think(entity &ent)
 		}
 
 		ent.think = SAVABLE(Nuke_Think);
-		ent.nextthink = level.time + 100ms;
+		ent.set_nextthink(level.time + 100ms);
 		ent.health = 1;
 		ent.owner = 0;
 
@@ -240,7 +240,7 @@ static void Nuke_Think(entity &ent)
 			ent.timestamp = level.time + 1s;
 		}
 
-		ent.nextthink = level.time + 100ms;
+		ent.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -267,7 +267,7 @@ void fire_nuke(entity &self, vector start, vector aimdir, int32_t speed)
 	nuke.velocity = aimdir * speed;
 	nuke.velocity += random(190.f, 210.f) * up;
 	nuke.velocity += crandom(10.f) * right;
-	nuke.movetype = MOVETYPE_BOUNCE;
+	nuke.set_movetype(MOVETYPE_BOUNCE);
 	nuke.clipmask = MASK_SHOT;
 	nuke.solid = SOLID_BBOX;
 	nuke.effects |= EF_GRENADE;
@@ -279,7 +279,7 @@ void fire_nuke(entity &self, vector start, vector aimdir, int32_t speed)
 	nuke.modelindex = gi.modelindex ("models/weapons/g_nuke/tris.md2");
 	nuke.owner = self;
 	nuke.teammaster = self;
-	nuke.nextthink = level.time + 1_hz;
+	nuke.set_nextthink(level.time + 1_hz);
 	nuke.wait = level.time + NUKE_DELAY + NUKE_TIME_TO_LIVE;
 	nuke.think = SAVABLE(Nuke_Think);
 	nuke.touch = SAVABLE(nuke_bounce);
@@ -294,7 +294,7 @@ void fire_nuke(entity &self, vector start, vector aimdir, int32_t speed)
 	else
 		nuke.dmg_radius = NUKE_RADIUS + NUKE_RADIUS * (0.25f * damage_multiplier);
 
-	nuke.type = ET_NUKE;
+	G_SetType(nuke, ET_NUKE);
 	nuke.die = SAVABLE(nuke_die);
 
 	gi.linkentity (nuke);
@@ -68,7 +68,7 @@ static void prox_die(entity &self, entity &inflictor, entity &, int32_t, vector)
 	else
 	{
 		self.think = SAVABLE(Prox_Explode);
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -92,7 +92,7 @@ static void Prox_Field_Touch(entity &ent, entity &other, vector, const surface &
 	{
 		gi.sound (ent, CHAN_VOICE, gi.soundindex ("weapons/proxwarn.wav"));
 		prox->think = SAVABLE(Prox_Explode);
-		prox->nextthink = level.time + PROX_TIME_DELAY;
+		prox->set_nextthink(level.time + PROX_TIME_DELAY);
 		return;
 	}
 
@@ -116,7 +116,7 @@ static void prox_seek(entity &ent)
 		if (ent.frame > 13)
 			ent.frame = 9;
 		ent.think = SAVABLE(prox_seek);
-		ent.nextthink = level.time + 100ms;
+		ent.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -170,7 +170,7 @@ static void prox_open(entity &ent)
 		ent.wait = level.time + PROX_TIME_TO_LIVE / multiplier;
 
 		ent.think = SAVABLE(prox_seek);
-		ent.nextthink = level.time + 2200ms;
+		ent.set_nextthink(level.time + 2200ms);
 	}
 	else
 	{
@@ -179,7 +179,7 @@ static void prox_open(entity &ent)
 
 		ent.frame++;
 		ent.think = SAVABLE(prox_open);
-		ent.nextthink = level.time + 100ms;
+		ent.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -227,7 +227,7 @@ static void prox_land(entity &ent, entity &other, vector normal, const surface &
 
 		cmovetype = MOVETYPE_BOUNCE;
 
-		bool stick_ok = (other.movetype == MOVETYPE_PUSH && normal[2] > 0.7);
+		bool stick_ok = (other.get_movetype() == MOVETYPE_PUSH && normal[2] > 0.7);
 
 		// if we're here, we're going to stop on an entity
 		if (stick_ok) // it's a happy entity
@@ -252,7 +252,7 @@ static void prox_land(entity &ent, entity &other, vector normal, const surface &
 	entity &field = G_Spawn();
 	field.origin = ent.origin;
 	field.bounds = PROX_BOUND_SIZE;
-	field.movetype = MOVETYPE_NONE;
+	field.set_movetype(MOVETYPE_NONE);
 	field.solid = SOLID_TRIGGER;
 	field.owner = ent;
 	field.teammaster = ent;
@@ -263,11 +263,11 @@ static void prox_land(entity &ent, entity &other, vector normal, const surface &
 	dir[PITCH] += 90;
 	ent.angles = dir;
 	ent.takedamage = true;
-	ent.movetype = cmovetype;		// either bounce or none, depending on whether we stuck to something
+	ent.set_movetype(cmovetype);		// either bounce or none, depending on whether we stuck to something
 	ent.die = SAVABLE(prox_die);
 	ent.teamchain = field;
 	ent.health = PROX_HEALTH;
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.think = SAVABLE(prox_open);
 	ent.touch = nullptr;
 	ent.solid = SOLID_BBOX;
@@ -290,7 +290,7 @@ void fire_prox(entity &self, vector start, vector aimdir, int32_t dmg_multiplier
 	prox.velocity += crandom(10.f) * right;
 	prox.angles = dir;
 	prox.angles[PITCH] -= 90;
-	prox.movetype = MOVETYPE_BOUNCE;
+	prox.set_movetype(MOVETYPE_BOUNCE);
 	prox.solid = SOLID_BBOX; 
 	prox.effects |= EF_GRENADE;
 	prox.clipmask = MASK_SHOT|CONTENTS_LAVA|CONTENTS_SLIME;
@@ -302,10 +302,10 @@ void fire_prox(entity &self, vector start, vector aimdir, int32_t dmg_multiplier
 	prox.touch = SAVABLE(prox_land);
 	prox.think = SAVABLE(Prox_Explode);
 	prox.dmg = PROX_DAMAGE * dmg_multiplier;
-	prox.type = ET_PROX;
+	G_SetType(prox, ET_PROX);
 	prox.bleed_style = BLEED_MECHANICAL;
 	prox.flags |= FL_DAMAGEABLE;
-	prox.nextthink = level.time + (PROX_TIME_TO_LIVE / dmg_multiplier);
+	prox.set_nextthink(level.time + (PROX_TIME_TO_LIVE / dmg_multiplier));
 
 	gi.linkentity (prox);
 }
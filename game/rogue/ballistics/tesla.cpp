@@ -80,7 +80,7 @@ static void tesla_think_active(entity &self)
 	vector start = self.origin;
 	start[2] += 16;
 
-	dynarray<entityref> entities = gi.BoxEdicts(self.teamchain->absbounds, AREA_SOLID);
+	std::span<entityref> entities = gi.BoxEdicts(self.teamchain->absbounds, AREA_SOLID);
 
 	for (auto &hit : entities)
 	{
@@ -131,7 +131,7 @@ static void tesla_think_active(entity &self)
 	if(self.inuse)
 	{
 		self.think = SAVABLE(tesla_think_active);
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 }
 
@@ -176,7 +176,7 @@ static void tesla_activate(entity &self)
 		.mins = { -TESLA_DAMAGE_RADIUS, -TESLA_DAMAGE_RADIUS, self.bounds.mins[2] },
 		.maxs = { TESLA_DAMAGE_RADIUS, TESLA_DAMAGE_RADIUS, TESLA_DAMAGE_RADIUS }
 	};
-	trigger.movetype = MOVETYPE_NONE;
+	trigger.set_movetype(MOVETYPE_NONE);
 	trigger.solid = SOLID_TRIGGER;
 	trigger.owner = self;
 	trigger.touch = nullptr;
@@ -191,7 +191,7 @@ static void tesla_activate(entity &self)
 		self.owner = 0;
 	self.teamchain = trigger;
 	self.think = SAVABLE(tesla_think_active);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	self.air_finished_time = level.time + TESLA_TIME_TO_LIVE;
 }
 
@@ -220,7 +220,7 @@ static void tesla_think(entity &ent)
 	{
 		ent.frame = 14;
 		ent.think = SAVABLE(tesla_activate);
-		ent.nextthink = level.time + 100ms;
+		ent.set_nextthink(level.time + 100ms);
 		return;
 	}
 
@@ -242,7 +242,7 @@ static void tesla_think(entity &ent)
 			ent.skinnum = 3;
 	}
 	ent.think = SAVABLE(tesla_think);
-	ent.nextthink = level.time + 100ms;
+	ent.set_nextthink(level.time + 100ms);
 }
 
 static void tesla_lava(entity &ent, entity &, vector normal, const surface &)
@@ -278,7 +278,7 @@ void fire_tesla(entity &self, vector start, vector aimdir, int32_t dmg_multiplie
 	tesla.velocity = aimdir * speed;
 	tesla.velocity += random(190.f, 210.f) * up;
 	tesla.velocity += crandom(10.f) * right;
-	tesla.movetype = MOVETYPE_BOUNCE;
+	tesla.set_movetype(MOVETYPE_BOUNCE);
 	tesla.solid = SOLID_BBOX;
 	tesla.effects |= EF_GRENADE;
 	tesla.renderfx |= RF_IR_VISIBLE;
@@ -293,7 +293,7 @@ void fire_tesla(entity &self, vector start, vector aimdir, int32_t dmg_multiplie
 
 	tesla.wait = level.time + TESLA_TIME_TO_LIVE;
 	tesla.think = SAVABLE(tesla_think);
-	tesla.nextthink = level.time + TESLA_ACTIVATE_TIME;
+	tesla.set_nextthink(level.time + TESLA_ACTIVATE_TIME);
 
 	// blow up on contact with lava & slime code
 	tesla.touch = SAVABLE(tesla_lava);
@@ -308,7 +308,7 @@ void fire_tesla(entity &self, vector start, vector aimdir, int32_t dmg_multiplie
 	tesla.takedamage = true;
 	tesla.die = SAVABLE(tesla_die);
 	tesla.dmg = TESLA_DAMAGE * dmg_multiplier;
-	tesla.type = ET_TESLA;
+	G_SetType(tesla, ET_TESLA);
 	tesla.flags |= FL_DAMAGEABLE;
 	tesla.clipmask = MASK_SHOT|CONTENTS_SLIME|CONTENTS_LAVA;
 	tesla.bleed_style = BLEED_MECHANICAL;
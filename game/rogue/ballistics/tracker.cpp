@@ -43,7 +43,7 @@ static void tracker_pain_daemon_think(entity &self)
 		else
 			self.enemy->effects |= EF_TRACKERTRAIL;
 		
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 		return;
 	}
 
@@ -59,7 +59,7 @@ static inline void tracker_pain_daemon_spawn(entity &cowner, entity &cenemy, int
 {
 	entity &daemon = G_Spawn();
 	daemon.think = SAVABLE(tracker_pain_daemon_think);
-	daemon.nextthink = level.time + 100ms;
+	daemon.set_nextthink(level.time + 100ms);
 	daemon.timestamp = level.time;
 	daemon.owner = cowner;
 	daemon.enemy = cenemy;
@@ -150,7 +150,7 @@ static void tracker_fly(entity &self)
 	self.angles = vectoangles(dir);
 	self.velocity = dir * self.speed;
 
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(tracker_fly);
@@ -163,7 +163,7 @@ void fire_tracker(entity &self, vector start, vector dir, int32_t damage, int32_
 	bolt.origin = bolt.old_origin = start;
 	bolt.angles = vectoangles (dir);
 	bolt.velocity = dir * cspeed;
-	bolt.movetype = MOVETYPE_FLYMISSILE;
+	bolt.set_movetype(MOVETYPE_FLYMISSILE);
 	bolt.clipmask = MASK_SHOT;
 	bolt.solid = SOLID_BBOX;
 	bolt.speed = cspeed;
@@ -179,12 +179,12 @@ void fire_tracker(entity &self, vector start, vector dir, int32_t damage, int32_
 
 	if (cenemy.has_value())
 	{
-		bolt.nextthink = level.time + 1_hz;
+		bolt.set_nextthink(level.time + 1_hz);
 		bolt.think = SAVABLE(tracker_fly);
 	}
 	else
 	{
-		bolt.nextthink = level.time + 10s;
+		bolt.set_nextthink(level.time + 10s);
 		bolt.think = SAVABLE(G_FreeEdict);
 	}
 
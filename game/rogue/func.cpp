@@ -40,7 +40,7 @@ static void fd_secret_use(entity &self, entity &, entity &)
 	// trigger all paired doors
 	if (!(self.flags & FL_TEAMSLAVE))
 		for (entity &ent : G_IterateChain<&entity::teamchain>(self))
-			Move_Calc(ent, ent.moveinfo.start_origin, SAVABLE(fd_secret_move1));
+			Move_Calc(ent, ent.moveinfo->start_origin, SAVABLE(fd_secret_move1));
 }
 
 REGISTER_STATIC_SAVABLE(fd_secret_use);
@@ -65,7 +65,7 @@ REGISTER_STATIC_SAVABLE(fd_secret_move2);
 // Wait after first movement...
 static void fd_secret_move1(entity &self)
 {
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 	self.think = SAVABLE(fd_secret_move2);
 }
 
@@ -76,7 +76,7 @@ REGISTER_STATIC_SAVABLE(fd_secret_move3);
 // Start moving sideways w/sound...
 static void fd_secret_move2(entity &self)
 {
-	Move_Calc(self, self.moveinfo.end_origin, SAVABLE(fd_secret_move3));
+	Move_Calc(self, self.moveinfo->end_origin, SAVABLE(fd_secret_move3));
 }
 
 static void fd_secret_move4(entity &self);
@@ -88,7 +88,7 @@ static void fd_secret_move3(entity &self)
 {
 	if (!(self.spawnflags & SEC_OPEN_ONCE))
 	{
-		self.nextthink = duration_cast<gtime>(level.time + self.wait);
+		self.set_nextthink(duration_cast<gtime>(level.time + self.wait));
 		self.think = SAVABLE(fd_secret_move4);
 	}
 }
@@ -100,7 +100,7 @@ REGISTER_STATIC_SAVABLE(fd_secret_move5);
 // Move backward...
 static void fd_secret_move4(entity &self)
 {
-	Move_Calc(self, self.moveinfo.start_origin, SAVABLE(fd_secret_move5));          
+	Move_Calc(self, self.moveinfo->start_origin, SAVABLE(fd_secret_move5));          
 }
 
 static void fd_secret_move6(entity &self);
@@ -110,7 +110,7 @@ REGISTER_STATIC_SAVABLE(fd_secret_move6);
 // Wait 1 second...
 static void fd_secret_move5(entity &self)
 {
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 	self.think = SAVABLE(fd_secret_move6);
 }
 
@@ -186,9 +186,10 @@ dmg  = damage to inflict when blocked (2 default)
 */
 static void SP_func_door_secret2(entity &ent)
 {
-	ent.moveinfo.sound_start = gi.soundindex  ("doors/dr1_strt.wav");
-	ent.moveinfo.sound_middle = gi.soundindex  ("doors/dr1_mid.wav");
-	ent.moveinfo.sound_end = gi.soundindex  ("doors/dr1_end.wav");
+	ent.moveinfo.emplace();
+	ent.moveinfo->sound_start = gi.soundindex  ("doors/dr1_strt.wav");
+	ent.moveinfo->sound_middle = gi.soundindex  ("doors/dr1_mid.wav");
+	ent.moveinfo->sound_end = gi.soundindex  ("doors/dr1_end.wav");
 
 	if (!ent.dmg)
 		ent.dmg = 2;
@@ -200,7 +201,7 @@ static void SP_func_door_secret2(entity &ent)
 	ent.move_angles = ent.angles;
 
 	G_SetMovedir (ent.angles, ent.movedir);
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_BSP;
 	gi.setmodel (ent, ent.model);
 
@@ -234,21 +235,21 @@ static void SP_func_door_secret2(entity &ent)
 
 	if (ent.spawnflags & SEC_1ST_DOWN)
 	{
-		ent.moveinfo.start_origin = ent.origin + forward;
-		ent.moveinfo.end_origin = ent.moveinfo.start_origin + right;
+		ent.moveinfo->start_origin = ent.origin + forward;
+		ent.moveinfo->end_origin = ent.moveinfo->start_origin + right;
 	}
 	else
 	{
-		ent.moveinfo.start_origin = ent.origin + right;
-		ent.moveinfo.end_origin = ent.moveinfo.start_origin + forward;
+		ent.moveinfo->start_origin = ent.origin + right;
+		ent.moveinfo->end_origin = ent.moveinfo->start_origin + forward;
 	}
 
 	ent.touch = SAVABLE(secret_touch);
 	ent.blocked = SAVABLE(secret_blocked);
 	ent.use = SAVABLE(fd_secret_use);
-	ent.moveinfo.speed = 50.f;
-	ent.moveinfo.accel = 50.f;
-	ent.moveinfo.decel = 50.f;
+	ent.moveinfo->speed = 50.f;
+	ent.moveinfo->accel = 50.f;
+	ent.moveinfo->decel = 50.f;
 
 	if (!ent.targetname || ent.spawnflags & SEC_YES_SHOOT)
 	{
@@ -279,7 +280,7 @@ static void force_wall_think(entity &self)
 		gi.ConstructMessage(svc_temp_entity, TE_FORCEWALL, self.pos1, self.pos2, (uint8_t) self.style).multicast(self.offset, MULTICAST_PVS);
 
 	self.think = SAVABLE(force_wall_think);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 static void force_wall_use(entity &self, entity &, entity &)
@@ -288,7 +289,7 @@ static void force_wall_use(entity &self, entity &, entity &)
 	{
 		self.wait = 1s;
 		self.think = nullptr;
-		self.nextthink = gtime::zero();
+		self.set_nextthink(gtime::zero());
 		self.solid = SOLID_NOT;
 		gi.linkentity(self);
 	}
@@ -296,7 +297,7 @@ static void force_wall_use(entity &self, entity &, entity &)
 	{
 		self.wait = gtime::zero();
 		self.think = SAVABLE(force_wall_think);
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 		self.solid = SOLID_BSP;
 		KillBox(self);		// Is this appropriate?
 		gi.linkentity (self);
@@ -340,14 +341,14 @@ static void SP_func_force_wall(entity &ent)
 	if (!ent.style)
 		ent.style = 208;
 
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.wait = 1s;
 
 	if (ent.spawnflags & FWALL_START_ON)
 	{
 		ent.solid = SOLID_BSP;
 		ent.think = SAVABLE(force_wall_think);
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 	}
 	else
 		ent.solid = SOLID_NOT;
@@ -397,12 +398,12 @@ static void plat2_hit_top(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_end)
-			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo.sound_end, ATTN_STATIC);
+		if (ent.moveinfo->sound_end)
+			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo->sound_end, ATTN_STATIC);
 		ent.sound = SOUND_NONE;
 	}
 
-	ent.moveinfo.state = STATE_TOP;
+	ent.moveinfo->state = STATE_TOP;
 
 	if (ent.plat2flags & PLAT2_CALLED)
 	{
@@ -411,7 +412,7 @@ static void plat2_hit_top(entity &ent)
 		if (!(ent.spawnflags & PLAT2_TOGGLE))
 		{
 			ent.think = SAVABLE(plat2_go_down);
-			ent.nextthink = level.time + 5s;
+			ent.set_nextthink(level.time + 5s);
 		}
 
 #ifdef SINGLE_PLAYER
@@ -425,7 +426,7 @@ static void plat2_hit_top(entity &ent)
 	{
 		ent.plat2flags = PLAT2_NONE;
 		ent.think = SAVABLE(plat2_go_down);
-		ent.nextthink = level.time + 2s;
+		ent.set_nextthink(level.time + 2s);
 		ent.last_move_time = level.time;
 	}
 	else
@@ -443,11 +444,11 @@ static void plat2_hit_bottom(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_end)
-			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo.sound_end, ATTN_STATIC);
+		if (ent.moveinfo->sound_end)
+			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo->sound_end, ATTN_STATIC);
 		ent.sound = SOUND_NONE;
 	}
-	ent.moveinfo.state = STATE_BOTTOM;
+	ent.moveinfo->state = STATE_BOTTOM;
 	
 	if (ent.plat2flags & PLAT2_CALLED)
 	{
@@ -456,7 +457,7 @@ static void plat2_hit_bottom(entity &ent)
 		if (!(ent.spawnflags & PLAT2_TOGGLE))
 		{
 			ent.think = SAVABLE(plat2_go_up);
-			ent.nextthink = level.time + 5s;
+			ent.set_nextthink(level.time + 5s);
 		}
 #ifdef SINGLE_PLAYER
 
@@ -470,7 +471,7 @@ static void plat2_hit_bottom(entity &ent)
 	{
 		ent.plat2flags = PLAT2_NONE;
 		ent.think = SAVABLE(plat2_go_up);
-		ent.nextthink = level.time + 2s;
+		ent.set_nextthink(level.time + 2s);
 		ent.last_move_time = level.time;
 	}
 	else
@@ -491,31 +492,31 @@ static void plat2_go_down(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_start)
-			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo.sound_start, ATTN_STATIC);
-		ent.sound = ent.moveinfo.sound_middle;
+		if (ent.moveinfo->sound_start)
+			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo->sound_start, ATTN_STATIC);
+		ent.sound = ent.moveinfo->sound_middle;
 	}
-	ent.moveinfo.state = STATE_DOWN;
+	ent.moveinfo->state = STATE_DOWN;
 	ent.plat2flags |= PLAT2_MOVING;
 
-	Move_Calc (ent, ent.moveinfo.end_origin, SAVABLE(plat2_hit_bottom));
+	Move_Calc (ent, ent.moveinfo->end_origin, SAVABLE(plat2_hit_bottom));
 }
 
 static void plat2_go_up(entity &ent)
 {
 	if (!(ent.flags & FL_TEAMSLAVE))
 	{
-		if (ent.moveinfo.sound_start)
-			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo.sound_start, ATTN_STATIC);
-		ent.sound = ent.moveinfo.sound_middle;
+		if (ent.moveinfo->sound_start)
+			gi.sound (ent, CHAN_NO_PHS_ADD | CHAN_VOICE, ent.moveinfo->sound_start, ATTN_STATIC);
+		ent.sound = ent.moveinfo->sound_middle;
 	}
-	ent.moveinfo.state = STATE_UP;
+	ent.moveinfo->state = STATE_UP;
 	ent.plat2flags |= PLAT2_MOVING;
 
 #ifdef ROGUE_AI
 	plat2_spawn_danger_area(ent);
 #endif
-	Move_Calc (ent, ent.moveinfo.start_origin, SAVABLE(plat2_hit_top));
+	Move_Calc (ent, ent.moveinfo->start_origin, SAVABLE(plat2_hit_top));
 }
 
 static void plat2_operate(entity &trigger, entity &other)
@@ -531,7 +532,7 @@ static void plat2_operate(entity &trigger, entity &other)
 	float platCenter = (trigger.absbounds.mins[2] + trigger.absbounds.maxs[2]) / 2;
 	move_state otherState;
 
-	if (ent.moveinfo.state == STATE_TOP)
+	if (ent.moveinfo->state == STATE_TOP)
 	{
 		if (ent.spawnflags & PLAT2_BOX_LIFT)
 		{
@@ -566,7 +567,7 @@ static void plat2_operate(entity &trigger, entity &other)
 	gtime pauseTime = 300ms;
 #endif
 
-	if (ent.moveinfo.state != otherState)
+	if (ent.moveinfo->state != otherState)
 	{
 		ent.plat2flags |= PLAT2_CALLED;
 		pauseTime = 100ms;
@@ -574,12 +575,12 @@ static void plat2_operate(entity &trigger, entity &other)
 
 	ent.last_move_time = level.time;
 	
-	if (ent.moveinfo.state == STATE_BOTTOM)
+	if (ent.moveinfo->state == STATE_BOTTOM)
 		ent.think = SAVABLE(plat2_go_up);
 	else
 		ent.think = SAVABLE(plat2_go_down);
 
-	ent.nextthink = level.time + pauseTime;
+	ent.set_nextthink(level.time + pauseTime);
 }
 
 static void Touch_Plat_Center2(entity &ent, entity &other, vector, const surface &)
@@ -615,9 +616,9 @@ static void plat2_blocked(entity &self, entity &other)
 
 	T_Damage (other, self, self, vec3_origin, other.origin, vec3_origin, self.dmg, 1, { DAMAGE_NONE }, MOD_CRUSH);
 
-	if (self.moveinfo.state == STATE_UP)
+	if (self.moveinfo->state == STATE_UP)
 		plat2_go_down (self);
-	else if (self.moveinfo.state == STATE_DOWN)
+	else if (self.moveinfo->state == STATE_DOWN)
 		plat2_go_up (self);
 }
 
@@ -625,7 +626,7 @@ REGISTER_STATIC_SAVABLE(plat2_blocked);
 
 static void Use_Plat2(entity &ent, entity &, entity &cactivator)
 { 
-	if (ent.moveinfo.state > STATE_BOTTOM)
+	if (ent.moveinfo->state > STATE_BOTTOM)
 		return;
 	if ((ent.last_move_time + 2s) > level.time)
 		return;
@@ -690,7 +691,7 @@ static void SP_func_plat2(entity &ent)
 {
 	ent.angles = vec3_origin;
 	ent.solid = SOLID_BSP;
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 
 	gi.setmodel (ent, ent.model);
 
@@ -735,7 +736,8 @@ static void SP_func_plat2(entity &ent)
 	else
 		ent.pos2[2] -= (ent.bounds.maxs[2] - ent.bounds.mins[2]) - st.lip;
 
-	ent.moveinfo.state = STATE_TOP;
+	ent.moveinfo.emplace();
+	ent.moveinfo->state = STATE_TOP;
 
 	if (ent.targetname)
 		ent.use = SAVABLE(plat2_activate);
@@ -757,24 +759,24 @@ static void SP_func_plat2(entity &ent)
 		if (!(ent.spawnflags & PLAT2_TOP))
 		{
 			ent.origin = ent.pos2;
-			ent.moveinfo.state = STATE_BOTTOM;
+			ent.moveinfo->state = STATE_BOTTOM;
 		}	
 	}
 
 	gi.linkentity (ent);
 
-	ent.moveinfo.speed = ent.speed;
-	ent.moveinfo.accel = ent.accel;
-	ent.moveinfo.decel = ent.decel;
-	ent.moveinfo.wait = ent.wait;
-	ent.moveinfo.start_origin = ent.pos1;
-	ent.moveinfo.start_angles = ent.angles;
-	ent.moveinfo.end_origin = ent.pos2;
-	ent.moveinfo.end_angles = ent.angles;
-
-	ent.moveinfo.sound_start = gi.soundindex ("plats/pt1_strt.wav");
-	ent.moveinfo.sound_middle = gi.soundindex ("plats/pt1_mid.wav");
-	ent.moveinfo.sound_end = gi.soundindex ("plats/pt1_end.wav");
+	ent.moveinfo->speed = ent.speed;
+	ent.moveinfo->accel = ent.accel;
+	ent.moveinfo->decel = ent.decel;
+	ent.moveinfo->wait = ent.wait;
+	ent.moveinfo->start_origin = ent.pos1;
+	ent.moveinfo->start_angles = ent.angles;
+	ent.moveinfo->end_origin = ent.pos2;
+	ent.moveinfo->end_angles = ent.angles;
+
+	ent.moveinfo->sound_start = gi.soundindex ("plats/pt1_strt.wav");
+	ent.moveinfo->sound_middle = gi.soundindex ("plats/pt1_mid.wav");
+	ent.moveinfo->sound_end = gi.soundindex ("plats/pt1_end.wav");
 }
 
 static REGISTER_ENTITY_INHERIT(FUNC_PLAT2, func_plat2, ET_FUNC_PLAT);
@@ -92,7 +92,7 @@ void SetTriggeredSpawn(entity &ent)
 		return;
 
 	ent.think = nullptr;
-	ent.nextthink = gtime::zero();
+	ent.set_nextthink(gtime::zero());
 	ent.use = SAVABLE(Item_TriggeredSpawn);
 	ent.svflags |= SVF_NOCLIENT;
 	ent.solid = SOLID_NOT;
@@ -60,9 +60,9 @@ entity &CreateMonster(vector origin, vector angles, const entity_type &type)
 
 	new_ent.origin = origin;
 	new_ent.angles = angles;
-	new_ent.monsterinfo.aiflags |= AI_DO_NOT_COUNT;
+	new_ent.monsterinfo->aiflags |= AI_DO_NOT_COUNT;
 
-	new_ent.type = type;
+	G_SetType(new_ent, type);
 
 	ED_CallSpawn(new_ent);
 
@@ -266,7 +266,7 @@ static void spawngrow_think(entity &self)
 		}
 	}
 
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 }
 
 REGISTER_STATIC_SAVABLE(spawngrow_think);
@@ -278,7 +278,7 @@ void SpawnGrow_Spawn(vector startpos, int32_t size)
 	ent.angles = randomv({ 360, 360, 360 });	
 	ent.solid = SOLID_NOT;
 	ent.renderfx = RF_IR_VISIBLE;
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 
 	gtimef lifespan = SPAWNGROW_LIFESPAN;
 
@@ -295,7 +295,7 @@ void SpawnGrow_Spawn(vector startpos, int32_t size)
 	ent.think = SAVABLE(spawngrow_think);
 
 	ent.wait = level.time + lifespan;
-	ent.nextthink = level.time + 100ms;
+	ent.set_nextthink(level.time + 100ms);
 	if (size != 2)
 		ent.effects |= EF_SPHERETRANS;
 	gi.linkentity (ent);
@@ -319,8 +319,8 @@ static void widow_gib_touch(entity &self, entity &, vector, const surface &)
 	self.angles[ROLL] = 0;
 	self.avelocity = vec3_origin;
 
-	if (self.moveinfo.sound_start)
-		gi.sound (self, CHAN_VOICE, self.moveinfo.sound_start);
+	if (std::as_const(self.moveinfo)->sound_start)
+		gi.sound (self, CHAN_VOICE, std::as_const(self.moveinfo)->sound_start);
 }
 
 REGISTER_STATIC_SAVABLE(widow_gib_touch);
@@ -353,30 +353,30 @@ void ThrowWidowGibReal(entity &self, stringlit gibname, int32_t damage, gib_type
 	{
 		// sized gibs last longer
 		if (sized)
-			gib.nextthink = level.time + random(20s, 35s);
+			gib.set_nextthink(level.time + random(20s, 35s));
 		else
-			gib.nextthink = level.time + random(5s, 15s);
+			gib.set_nextthink(level.time + random(5s, 15s));
 	}
 	else
 	{
 		// sized gibs last longer
 		if (sized)
-			gib.nextthink = level.time + random(60s, 75s);
+			gib.set_nextthink(level.time + random(60s, 75s));
 		else
-			gib.nextthink = level.time + random(25s, 35s);
+			gib.set_nextthink(level.time + random(25s, 35s));
 	}
 
 	float vscale;
 
 	if (type == GIB_ORGANIC)
 	{
-		gib.movetype = MOVETYPE_TOSS;
+		gib.set_movetype(MOVETYPE_TOSS);
 		gib.touch = SAVABLE(gib_touch);
 		vscale = 0.5f;
 	}
 	else
 	{
-		gib.movetype = MOVETYPE_BOUNCE;
+		gib.set_movetype(MOVETYPE_BOUNCE);
 		vscale = 1.0f;
 	}
 
@@ -388,7 +388,8 @@ void ThrowWidowGibReal(entity &self, stringlit gibname, int32_t damage, gib_type
 
 	if (sized)
 	{
-		gib.moveinfo.sound_start = hitsound;
+		gib.moveinfo.emplace();
+		gib.moveinfo->sound_start = hitsound;
 		gib.solid = SOLID_BBOX;
 		gib.avelocity = randomv({ 400.f, 400.f, 200.f });
 		if (gib.velocity[2] < 0)
@@ -483,7 +484,7 @@ static void widowlegs_think(entity &self)
 	if (self.frame < MAX_LEGSFRAME)
 	{
 		self.frame++;
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 		return;
 	}
 	else if (self.wait == gtime::zero())
@@ -527,7 +528,7 @@ static void widowlegs_think(entity &self)
 		gi.ConstructMessage(svc_temp_entity, TE_EXPLOSION1, start).multicast(start, MULTICAST_ALL);
 	}
 
-	self.nextthink = level.time + 100ms;
+	self.set_nextthink(level.time + 100ms);
 }
 
 REGISTER_STATIC_SAVABLE(widowlegs_think);
@@ -539,12 +540,12 @@ void Widowlegs_Spawn(vector startpos, vector cangles)
 	ent.angles = cangles;
 	ent.solid = SOLID_NOT;
 	ent.renderfx = RF_IR_VISIBLE;
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 
 	ent.modelindex = gi.modelindex("models/monsters/legs/tris.md2");
 	ent.think = SAVABLE(widowlegs_think);
 
-	ent.nextthink = level.time + 100ms;
+	ent.set_nextthink(level.time + 100ms);
 	gi.linkentity (ent);
 }
 
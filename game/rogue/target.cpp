@@ -77,7 +77,7 @@ static void target_steam_start(entity &self)
 
 	if (self.target)
 	{
-		entityref ent = G_FindEquals<&entity::targetname>(world, self.target);
+		entityref ent = G_FindTargetname(world, self.target);
 		if (!ent.has_value())
 			gi.dprintfmt("{}: {} is a bad target\n", self, self.target);
 		self.enemy = ent;
@@ -104,7 +104,7 @@ static void SP_target_steam(entity &self)
 	if (self.target)
 	{
 		self.think = SAVABLE(target_steam_start);
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	}
 	else
 		target_steam_start (self);
@@ -119,17 +119,18 @@ static REGISTER_ENTITY(TARGET_STEAM, target_steam);
 
 static void target_anger_use(entity &self, entity &, entity &)
 {
-	entityref ctarget = G_FindEquals<&entity::targetname>(world, self.killtarget);
+	entityref ctarget = G_FindTargetname(world, self.killtarget);
 
 	if (!ctarget.has_value())
 		return;
 
 	// Make whatever a "good guy" so the monster will try to kill it!
-	ctarget->monsterinfo.aiflags |= AI_GOOD_GUY;
+	ctarget->monsterinfo.emplace();
+	ctarget->monsterinfo->aiflags |= AI_GOOD_GUY;
 	ctarget->svflags |= SVF_MONSTER;
 	ctarget->health = 300;
 
-	for (entity &t : G_IterateEquals<&entity::targetname>(self.target))
+	for (entity &t : G_IterateTargetname(self.target))
 	{
 		if (t == self)
 			gi.dprint("WARNING: entity used itself.\n");
@@ -139,7 +140,8 @@ static void target_anger_use(entity &self, entity &, entity &)
 				return;
 
 			t.enemy = ctarget;
-			t.monsterinfo.aiflags |= AI_TARGET_ANGER;
+			t.monsterinfo.emplace();
+			t.monsterinfo->aiflags |= AI_TARGET_ANGER;
 			FoundTarget(t);
 		}
 
@@ -238,7 +240,7 @@ Pulsing black light with sphere in the center
 static void blacklight_think(entity &self)
 {
 	self.angles = randomv({ 360.f, 360.f, 360.f });
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 static REGISTER_SAVABLE(blacklight_think);
@@ -255,7 +257,7 @@ static void SP_target_blacklight(entity &ent)
 	ent.think = SAVABLE(blacklight_think);
 	ent.modelindex = gi.modelindex ("models/items/spawngro2/tris.md2");
 	ent.frame = 1;
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	gi.linkentity (ent);
 }
 
@@ -274,7 +276,7 @@ static void SP_target_orb(entity &ent)
 	}
 
 	ent.think = SAVABLE(blacklight_think);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.modelindex = gi.modelindex ("models/items/spawngro2/tris.md2");
 	ent.frame = 2;
 	ent.effects |= EF_SPHERETRANS;
@@ -7,7 +7,10 @@
 #include "game/entity.h"
 #include "game/game.h"
 #include "game/player.h"
+#include "game/util.h"
 #include "lib/math/bbox.h"
+#include "lib/types/map.h"
+#include "game/think.h"
 
 #ifdef SINGLE_PLAYER
 #include "game/target.h"
@@ -16,6 +19,53 @@
 registered_savable<void *> *registered_data_head;
 registered_savable<void(*)()> *registered_functions_head;
 
+// name -> registry entry; built from the linked lists on startup so
+// that loading doesn't have to walk them for every savable.
+static map<std::string_view, const registered_savable<void *> *> registered_data;
+static map<std::string_view, const registered_savable<void(*)()> *> registered_functions;
+
+template<typename T>
+static void IndexSavables(const registered_savable<T> *head, map<std::string_view, const registered_savable<T> *> &index, stringlit kind)
+{
+	index.clear();
+
+	for (auto p = head; p; p = p->next)
+		if (!index.emplace(p->name, p).second)
+			gi.errorfmt("duplicate savable {} \"{}\"\n", kind, p->name);
+}
+
+void InitSavables()
+{
+	IndexSavables(registered_functions_head, registered_functions, "function");
+	IndexSavables(registered_data_head, registered_data, "data");
+}
+
+// resolve a saved name back to its registry entry
+template<typename T>
+static savable<T> FindSavable(const string &name)
+{
+	const std::string_view key(name.ptr(), name.length());
+
+	if constexpr(is_function_pointer_v<T>)
+	{
+		auto it = registered_functions.find(key);
+
+		if (it == registered_functions.end())
+			gi.errorfmt("No function matching {}\n", name);
+
+		return (const registered_savable<T> *) it->second;
+	}
+	else
+	{
+		auto it = registered_data.find(key);
+
+		if (it == registered_data.end())
+			gi.errorfmt("No data matching {}\n", name);
+
+		return (const registered_savable<T> *) it->second;
+	}
+}
+
 #ifdef JSON_SAVE_FORMAT
 #include "save/json.hpp"
 using nlohmann::json;
@@ -27,6 +77,11 @@ using maybe_json = std::optional<::json>;
 
 using write_func = maybe_json (*)(serializer &, const void *);
 using read_func = void(*)(const json &, serializer &, void *);
+#elif defined(COMPACT_SAVE_FORMAT)
+using serializer = struct compact_serializer;
+
+using write_func = bool(*)(serializer &, const void *);
+using read_func = void(*)(serializer &, void *);
 #else
 using serializer = struct binary_serializer;
 
@@ -164,6 +219,14 @@ inline maybe_json json_serializer_write(serializer&, const string &v, const bool
 	return ::json(v.ptr());
 }
 
+inline maybe_json json_serializer_write(serializer&, const atom &v, const bool& defaultable = false)
+{
+	if (defaultable && !v)
+		return std::nullopt;
+
+	return ::json(v.ptr());
+}
+
 inline maybe_json json_serializer_write(serializer&, const entityref &v, const bool& defaultable = false)
 {
 	if (defaultable && !v.has_value())
@@ -306,6 +369,14 @@ inline void json_serializer_read(const json &json, serializer &, string &str)
 	str = string(json.get<std::string>().c_str());
 }
 
+inline void json_serializer_read(const json &json, serializer &, atom &str)
+{
+	if (!json.is_string())
+		throw std::bad_cast();
+
+	str = atom(json.get<std::string>().c_str());
+}
+
 inline void json_serializer_read(const json &json, serializer &, entityref &str)
 {
 	if (json.is_null())
@@ -422,36 +493,562 @@ inline void json_serializer_read(const json &json, serializer &stream, savable<T
 		return;
 	}
 
-	if constexpr(is_function_pointer_v<T>)
+	str = FindSavable<T>(s);
+}
+
+#elif defined(COMPACT_SAVE_FORMAT)
+/*
+The compact format is a little-endian binary stream laid out as:
+
+	uint32		magic ("Q2CS")
+	uint32		version
+	varint		number of strings
+	(varint length, bytes)[] strings
+	...			body
+
+Every string, savable name, entity type and item classname is written
+once into the string table and referred to by index + 1 (0 is null).
+Structures are a list of (varint tag, varint length, payload) fields
+ended by a 0 tag, where the tag is the string index of the member's
+name. Readers skip tags they don't know about, so like JSON, saves
+stay loadable as long as member names don't change. Fields with a
+default value are not written at all.
+*/
+constexpr uint32_t COMPACT_SAVE_MAGIC = 'Q' | ('2' << 8) | ('C' << 16) | ('S' << 24);
+constexpr uint32_t COMPACT_SAVE_VERSION = 1;
+
+struct compact_serializer
+{
+	stringlit			filename;
+	bool				load;
+	dynarray<uint8_t>	body;
+	size_t				offset;
+
+	// writing; string -> index, and the table in index order
+	smap<uint32_t>		string_index;
+	dynarray<string>	string_list;
+
+	// reading; string table, and lazily resolved lookups into it
+	dynarray<string>					strings;
+	dynarray<const entity_type *>		string_types;
+	map<const save_struct *, dynarray<int32_t>>	struct_members;
+
+	compact_serializer(stringlit filename, bool load) :
+		filename(filename),
+		load(load),
+		offset(0)
 	{
-		for (auto p = registered_functions_head; p; p = p->next)
+		if (!load)
+			return;
+
+		std::ifstream f(filename, std::ios::binary | std::ios::ate);
+
+		if (!f.is_open())
+			gi.error("No file");
+
+		body.resize((size_t) f.tellg());
+		f.seekg(0);
+		f.read((char *) body.data(), body.size());
+
+		uint32_t magic, version;
+		read_bytes(&magic, sizeof(magic));
+		read_bytes(&version, sizeof(version));
+
+		if (magic != COMPACT_SAVE_MAGIC)
+			gi.errorfmt("{}: not a compact save file\n", filename);
+		else if (version > COMPACT_SAVE_VERSION)
+			gi.errorfmt("{}: save version {} is newer than {}\n", filename, version, COMPACT_SAVE_VERSION);
+
+		strings.resize(read_varint());
+		string_types.resize(strings.size());
+
+		for (string &s : strings)
+		{
+			const size_t len = read_varint();
+
+			if (offset + len > body.size())
+				gi.errorfmt("{}: corrupt string table\n", filename);
+
+			s = string((stringlit) body.data() + offset, 0, len);
+			offset += len;
+		}
+	}
+
+	~compact_serializer()
+	{
+		if (load)
+			return;
+
+		dynarray<uint8_t> header;
+		std::swap(header, body);
+
+		write_bytes(&COMPACT_SAVE_MAGIC, sizeof(COMPACT_SAVE_MAGIC));
+		write_bytes(&COMPACT_SAVE_VERSION, sizeof(COMPACT_SAVE_VERSION));
+		write_varint(string_list.size());
+
+		for (auto &s : string_list)
+		{
+			write_varint(s.length());
+			write_bytes(s.ptr(), s.length());
+		}
+
+		std::swap(header, body);
+
+		std::ofstream f(filename, std::ios::binary | std::ios::trunc);
+		f.write((const char *) header.data(), header.size());
+		f.write((const char *) body.data(), body.size());
+	}
+
+	// write routines
+	inline void write_bytes(const void *data, size_t size)
+	{
+		body.insert(body.end(), (const uint8_t *) data, (const uint8_t *) data + size);
+	}
+
+	static inline size_t encode_varint(uint8_t *out, uint64_t v)
+	{
+		size_t n = 0;
+
+		for (; v >= 0x80; v >>= 7)
+			out[n++] = (uint8_t) (v | 0x80);
+
+		out[n++] = (uint8_t) v;
+		return n;
+	}
+
+	inline void write_varint(uint64_t v)
+	{
+		uint8_t buffer[10];
+		write_bytes(buffer, encode_varint(buffer, v));
+	}
+
+	// write the index of a string, adding it to the table if need be
+	inline bool write_string(const char *data, size_t length)
+	{
+		if (!data || !length || !*data)
+		{
+			write_varint(0);
+			return false;
+		}
+
+		auto it = string_index.find(std::string_view(data, length));
+
+		if (it == string_index.end())
 		{
-			if (s == p->name)
+			const string &s = string_list.emplace_back(data, 0, length);
+			it = string_index.emplace(s, (uint32_t) string_list.size() - 1).first;
+		}
+
+		write_varint(it->second + 1);
+		return true;
+	}
+
+	inline bool write_string(stringlit s)
+	{
+		return write_string(s, s ? strlen(s) : 0);
+	}
+
+	// read routines
+	inline void read_bytes(void *data, size_t size)
+	{
+		if (offset + size > body.size())
+			gi.errorfmt("{}: unexpected end of file\n", filename);
+
+		memcpy(data, body.data() + offset, size);
+		offset += size;
+	}
+
+	inline uint64_t read_varint()
+	{
+		uint64_t v = 0;
+
+		for (uint32_t shift = 0; ; shift += 7)
+		{
+			uint8_t b;
+			read_bytes(&b, sizeof(b));
+
+			v |= (uint64_t) (b & 0x7F) << shift;
+
+			if (!(b & 0x80))
+				return v;
+			else if (shift >= 63)
+				gi.errorfmt("{}: bad varint\n", filename);
+		}
+	}
+
+	// returns 0 for a null string, otherwise index + 1
+	inline size_t read_string_index()
+	{
+		const size_t index = read_varint();
+
+		if (index > strings.size())
+			gi.errorfmt("{}: bad string index {}\n", filename, index);
+
+		return index;
+	}
+
+	inline string read_string()
+	{
+		const size_t index = read_string_index();
+		return index ? strings[index - 1] : string();
+	}
+
+	// structs; returns false if every member had its default value
+	bool write_struct(const save_struct &struc, const void *ptr)
+	{
+		bool written = false;
+
+		for (auto member = struc.members; member != struc.members + struc.num_members; member++)
+		{
+			const size_t start = body.size();
+
+			write_string(member->name);
+
+			const size_t payload = body.size();
+
+			if (!member->write(*this, ptr))
 			{
-				decltype(*registered_functions_head) t(*p);
-				str = *(registered_savable<T> *) &t;
-				return;
+				body.resize(start);
+				continue;
 			}
+
+			// prefix the payload with its length so that it can be skipped
+			uint8_t length[10];
+			body.insert(body.begin() + payload, length, length + encode_varint(length, body.size() - payload));
+			written = true;
 		}
 
-		gi.errorfmt("No function matching {}\n", s);
+		write_varint(0);
+		return written;
+	}
+
+	void read_struct(const save_struct &struc, void *ptr)
+	{
+		dynarray<int32_t> &members = struct_members[&struc];
+
+		// -2 = not looked up yet, -1 = not a member of this struct
+		if (members.empty())
+			members.resize(strings.size(), -2);
+
+		while (const size_t tag = read_string_index())
+		{
+			const size_t end = offset + read_varint();
+
+			if (end > body.size())
+				gi.errorfmt("{}: corrupt {}\n", filename, struc.name);
+
+			int32_t &index = members[tag - 1];
+
+			if (index == -2)
+			{
+				index = -1;
+
+				for (size_t i = 0; i < struc.num_members; i++)
+					if (strings[tag - 1] == struc.members[i].name)
+					{
+						index = (int32_t) i;
+						break;
+					}
+			}
+
+			if (index != -1)
+				struc.members[index].read(*this, ptr);
+
+			// always land on the next field, even if this one was unknown
+			// or its type changed since the save was written
+			offset = end;
+		}
 	}
+};
+
+// The following types are written as varints or raw floats
+template<typename T>
+static constexpr bool is_number = !std::is_pointer_v<T> && !std::is_same_v<T, bool> && (std::is_integral_v<T> || std::is_floating_point_v<T> || std::is_enum_v<T>);
+
+template<typename T> requires is_number<T>
+inline bool compact_serializer_write(serializer &stream, const T &v)
+{
+	if constexpr (std::is_enum_v<T>)
+		return compact_serializer_write(stream, (std::underlying_type_t<T>) v);
+	else if constexpr (std::is_floating_point_v<T>)
+		stream.write_bytes(&v, sizeof(v));
+	else if constexpr (std::is_signed_v<T>)
+		stream.write_varint(((uint64_t) v << 1) ^ (uint64_t) ((int64_t) v >> 63));
 	else
+		stream.write_varint(v);
+
+	return v != T();
+}
+
+template<typename T> requires std::is_same_v<T, sound_index> || std::is_same_v<T, image_index> || std::is_same_v<T, model_index> || std::is_same_v<T, player_stat>
+inline bool compact_serializer_write(serializer &stream, const T &v)
+{
+	return compact_serializer_write(stream, (int32_t) v);
+}
+
+inline bool compact_serializer_write(serializer &stream, const bool &v)
+{
+	stream.write_bytes(&v, sizeof(v));
+	return v;
+}
+
+inline bool compact_serializer_write(serializer &stream, const stringref &v)
+{
+	return stream.write_string(v.ptr(), v.length());
+}
+
+inline bool compact_serializer_write(serializer &stream, const string &v)
+{
+	return stream.write_string(v.ptr(), v.length());
+}
+
+inline bool compact_serializer_write(serializer &stream, const atom &v)
+{
+	return stream.write_string(v.ptr(), v.length());
+}
+
+inline bool compact_serializer_write(serializer &stream, const entityref &v)
+{
+	stream.write_varint(v.has_value() ? (v->number + 1) : 0);
+	return v.has_value();
+}
+
+inline bool compact_serializer_write(serializer &stream, const itemref &v)
+{
+	return stream.write_string(v ? v->classname : nullptr);
+}
+
+inline bool compact_serializer_write(serializer &stream, const entity_type_ref &v)
+{
+	return stream.write_string(v ? v->id : nullptr);
+}
+
+inline bool compact_serializer_write(serializer &stream, const vector &v)
+{
+	stream.write_bytes(&v, sizeof(v));
+	return !!v;
+}
+
+inline bool compact_serializer_write(serializer &stream, const bbox &v)
+{
+	stream.write_bytes(&v.mins, sizeof(v.mins));
+	stream.write_bytes(&v.maxs, sizeof(v.maxs));
+	return v.mins || v.maxs;
+}
+
+template<typename T>
+inline bool compact_serializer_write(serializer &stream, const savable<T> &str)
+{
+	return stream.write_string(str ? str.registry->name : nullptr);
+}
+
+template<typename T, size_t N>
+inline bool compact_serializer_write(serializer &stream, const array<T, N> &arr)
+{
+	static array<T, N> default_val;
+
+	stream.write_varint(N);
+
+	for (auto &v : arr)
+		compact_serializer_write(stream, v);
+
+	return arr != default_val;
+}
+
+template<size_t N>
+inline bool compact_serializer_write(serializer &stream, const bitset<N> &arr)
+{
+	stream.write_varint(N);
+
+	for (size_t i = 0; i < N; i += 8)
+	{
+		uint8_t bits = 0;
+
+		for (size_t b = 0; b < 8 && i + b < N; b++)
+			if (arr[i + b])
+				bits |= 1 << b;
+
+		stream.write_bytes(&bits, sizeof(bits));
+	}
+
+	return arr.any();
+}
+
+template<typename rep, typename period>
+inline bool compact_serializer_write(serializer &stream, const duration<rep, period> &v)
+{
+	return compact_serializer_write(stream, v.count());
+}
+
+template<typename T> requires is_number<T>
+inline void compact_serializer_read(serializer &stream, T &str)
+{
+	if constexpr (std::is_enum_v<T>)
+	{
+		std::underlying_type_t<T> v;
+		compact_serializer_read(stream, v);
+		str = (T) v;
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+		stream.read_bytes(&str, sizeof(str));
+	else if constexpr (std::is_signed_v<T>)
+	{
+		const uint64_t v = stream.read_varint();
+		str = (T) ((int64_t) (v >> 1) ^ -(int64_t) (v & 1));
+	}
+	else
+		str = (T) stream.read_varint();
+}
+
+template<typename T> requires std::is_same_v<T, sound_index> || std::is_same_v<T, image_index> || std::is_same_v<T, model_index> || std::is_same_v<T, player_stat>
+inline void compact_serializer_read(serializer &stream, T &str)
+{
+	int32_t v;
+	compact_serializer_read(stream, v);
+	str = { v };
+}
+
+inline void compact_serializer_read(serializer &stream, bool &str)
+{
+	uint8_t v;
+	stream.read_bytes(&v, sizeof(v));
+	str = !!v;
+}
+
+inline void compact_serializer_read(serializer &stream, stringref &str)
+{
+	str = stream.read_string();
+}
+
+inline void compact_serializer_read(serializer &stream, string &str)
+{
+	str = stream.read_string();
+}
+
+inline void compact_serializer_read(serializer &stream, atom &str)
+{
+	str = stream.read_string();
+}
+
+inline void compact_serializer_read(serializer &stream, entityref &str)
+{
+	const size_t number = stream.read_varint();
+
+	if (number > max_entities)
+		gi.errorfmt("{}: bad entity number {}\n", stream.filename, number - 1);
+
+	str = number ? entityref(itoe(number - 1)) : entityref();
+}
+
+inline void compact_serializer_read(serializer &stream, itemref &str)
+{
+	const string s = stream.read_string();
+	str = s ? FindItemByClassname(s) : itemref();
+}
+
+inline void compact_serializer_read(serializer &stream, entity_type_ref &str)
+{
+	const size_t index = stream.read_string_index();
+
+	if (!index)
 	{
-		for (auto p = registered_data_head; p; p = p->next)
+		str = ET_UNKNOWN;
+		return;
+	}
+
+	// types repeat a lot, so only look each one up once
+	const entity_type *&type = stream.string_types[index - 1];
+
+	if (!type)
+	{
+		const string &s = stream.strings[index - 1];
+
+		for (const entity_type *x = &ET_UNKNOWN; x; x = x->next)
 		{
-			if (s == p->name)
+			if (s == x->id)
 			{
-				decltype(*registered_data_head) t(*p);
-				str = *(registered_savable<T> *) &t;
-				return;
+				type = x;
+				break;
 			}
 		}
 
-		gi.errorfmt("No data matching {}\n", s);
+		if (!type)
+		{
+			gi.dprintfmt("Warning: unknown entity type {}\n", s);
+			type = &ET_UNKNOWN;
+		}
+	}
+
+	str = *type;
+}
+
+inline void compact_serializer_read(serializer &stream, vector &str)
+{
+	stream.read_bytes(&str, sizeof(str));
+}
+
+inline void compact_serializer_read(serializer &stream, bbox &str)
+{
+	stream.read_bytes(&str.mins, sizeof(str.mins));
+	stream.read_bytes(&str.maxs, sizeof(str.maxs));
+}
+
+template<typename T>
+inline void compact_serializer_read(serializer &stream, savable<T> &str)
+{
+	const string s = stream.read_string();
+
+	if (!s)
+	{
+		str = nullptr;
+		return;
+	}
+
+	str = FindSavable<T>(s);
+}
+
+template<typename T, size_t N>
+inline void compact_serializer_read(serializer &stream, array<T, N> &arr)
+{
+	const size_t count = stream.read_varint();
+
+	for (size_t i = 0; i < count; i++)
+	{
+		// array shrunk; read the extra values and throw them away
+		if (i >= N)
+		{
+			T discard {};
+			compact_serializer_read(stream, discard);
+			continue;
+		}
+
+		compact_serializer_read(stream, arr[i]);
+	}
+}
+
+template<size_t N>
+inline void compact_serializer_read(serializer &stream, bitset<N> &arr)
+{
+	const size_t count = stream.read_varint();
+
+	for (size_t i = 0; i < count; i += 8)
+	{
+		uint8_t bits;
+		stream.read_bytes(&bits, sizeof(bits));
+
+		for (size_t b = 0; b < 8 && i + b < count && i + b < N; b++)
+			arr.set(i + b, (bits >> b) & 1);
 	}
 }
 
+template<typename rep, typename period>
+inline void compact_serializer_read(serializer &stream, duration<rep, period> &arr)
+{
+	rep r;
+	compact_serializer_read<rep>(stream, r);
+	arr = duration<rep, period>(r);
+}
+
 #else
 struct binary_serializer
 {
@@ -505,6 +1102,11 @@ struct binary_serializer
 		this->operator<<(stringref(str));
 	}
 
+	inline void operator<<(const atom &str)
+	{
+		this->operator<<(str.str());
+	}
+
 	inline void operator<<(const itemref &str)
 	{
 		stream.write((char *) &str->id, sizeof(str->id));
@@ -573,6 +1175,15 @@ struct binary_serializer
 			str = string();
 	}
 
+	inline void operator>>(atom &str)
+	{
+		string s;
+
+		this->operator>>(s);
+
+		str = s;
+	}
+
 	inline void operator>>(itemref &str)
 	{
 		gitem_id id;
@@ -614,34 +1225,7 @@ struct binary_serializer
 			return;
 		}
 
-		if constexpr(is_function_pointer_v<T>)
-		{
-			for (auto p = registered_functions_head; p; p = p->next)
-			{
-				if (s == p->name)
-				{
-					decltype(*registered_functions_head) t(*p);
-					str = *(registered_savable<T> *) &t;
-					return;
-				}
-			}
-
-			gi.errorfmt("No function matching {}\n", s);
-		}
-		else
-		{
-			for (auto p = registered_data_head; p; p = p->next)
-			{
-				if (s == p->name)
-				{
-					decltype(*registered_data_head) t(*p);
-					str = *(registered_savable<T> *) &t;
-					return;
-				}
-			}
-
-			gi.errorfmt("No data matching {}\n", s);
-		}
+		str = FindSavable<T>(s);
 	}
 
 	template<typename rep, typename period>
@@ -704,6 +1288,18 @@ struct binary_serializer
 	{ #member, \
 		[](serializer &stream, const void *struc) { return json_serializer_write(stream, ((type *) struc)->get_##member(), true); }, \
 		[](const json &json, serializer &stream, void *struc) { std::invoke_result_t<decltype(&type::get_##member), type> temp; json_serializer_read(json, stream, temp); ((type *) struc)->set_##member(temp); } }
+#elif defined(COMPACT_SAVE_FORMAT)
+#define SAVE_MEMBER(type, member) \
+	{ #member, \
+		[](serializer &stream, const void *struc) { return compact_serializer_write(stream, ((type *) struc)->member); }, \
+		[](serializer &stream, void *struc) { compact_serializer_read(stream, ((type *) struc)->member); } }
+
+// A few things in our code rely on getters/setters to hide
+// protocol-based behavior.
+#define SAVE_MEMBER_PROPERTY(type, member) \
+	{ #member, \
+		[](serializer &stream, const void *struc) { return compact_serializer_write(stream, ((type *) struc)->get_##member()); }, \
+		[](serializer &stream, void *struc) { std::invoke_result_t<decltype(&type::get_##member), type> temp; compact_serializer_read(stream, temp); ((type *) struc)->set_##member(temp); } }
 #else
 #define SAVE_MEMBER(type, member) \
 	{ #member, \
@@ -730,6 +1326,11 @@ struct binary_serializer
 	DEFINE_SAVE_STRUCTURE(type); \
 	inline maybe_json json_serializer_write(serializer &stream, const type &str, const bool &) { return stream.write_struct(type##_save, &str, true); } \
 	inline void json_serializer_read(const json &json, serializer &stream, type &str) { stream.read_struct(json, type##_save, &str); }
+#elif defined(COMPACT_SAVE_FORMAT)
+#define CREATE_STRUCTURE_SERIALIZE_FUNCS(type) \
+	DEFINE_SAVE_STRUCTURE(type); \
+	inline bool compact_serializer_write(serializer &stream, const type &str) { return stream.write_struct(type##_save, &str); } \
+	inline void compact_serializer_read(serializer &stream, type &str) { stream.read_struct(type##_save, &str); }
 #else
 #define CREATE_STRUCTURE_SERIALIZE_FUNCS(type) \
 	DEFINE_SAVE_STRUCTURE(type); \
@@ -1008,6 +1609,58 @@ static save_member moveinfo_members[] = {
 
 CREATE_STRUCTURE_SERIALIZE_FUNCS(moveinfo);
 
+// pooled blocks are only saved if they were created, and only
+// created on load if they were saved
+#ifdef JSON_SAVE_FORMAT
+template<typename T>
+inline maybe_json json_serializer_write(serializer &stream, const pooled<T> &v, const bool &defaultable = false)
+{
+	if (defaultable && !v.has_value())
+		return std::nullopt;
+
+	return json_serializer_write(stream, *v, defaultable);
+}
+
+template<typename T>
+inline void json_serializer_read(const json &json, serializer &stream, pooled<T> &v)
+{
+	json_serializer_read(json, stream, v.emplace());
+}
+#elif defined(COMPACT_SAVE_FORMAT)
+template<typename T>
+inline bool compact_serializer_write(serializer &stream, const pooled<T> &v)
+{
+	return v.has_value() && compact_serializer_write(stream, *v);
+}
+
+template<typename T>
+inline void compact_serializer_read(serializer &stream, pooled<T> &v)
+{
+	compact_serializer_read(stream, v.emplace());
+}
+#else
+template<typename T>
+inline void operator<<(serializer &stream, const pooled<T> &v)
+{
+	stream << v.has_value();
+
+	if (v.has_value())
+		stream << *v;
+}
+
+template<typename T>
+inline void operator>>(serializer &stream, pooled<T> &v)
+{
+	bool has_value;
+	stream >> has_value;
+
+	if (has_value)
+		stream >> v.emplace();
+	else
+		v.reset();
+}
+#endif
+
 #ifdef SINGLE_PLAYER
 
 static save_member monsterinfo_members[] = {
@@ -1046,6 +1699,8 @@ static save_member monsterinfo_members[] = {
 	SAVE_MEMBER(monsterinfo, power_armor_type),
 	SAVE_MEMBER(monsterinfo, power_armor_power),
 	SAVE_MEMBER(monsterinfo, surprise_time),
+	SAVE_MEMBER(monsterinfo, dormant),
+	SAVE_MEMBER(monsterinfo, dormant_tick_time),
 
 #ifdef ROGUE_AI
 	SAVE_MEMBER(monsterinfo, blocked),
@@ -1112,7 +1767,7 @@ static save_member entity_members[] = {
 	SAVE_MEMBER(server_entity, owner),
 	
 	// entity
-	SAVE_MEMBER(entity, movetype),
+	SAVE_MEMBER_PROPERTY(entity, movetype),
 
 	SAVE_MEMBER(entity, flags),
 	
@@ -1152,8 +1807,8 @@ static save_member entity_members[] = {
 	SAVE_MEMBER(entity, yaw_speed),
 	SAVE_MEMBER(entity, ideal_yaw),
 	
-	SAVE_MEMBER(entity, nextthink),
-	SAVE_MEMBER(entity, prethink),
+	SAVE_MEMBER_PROPERTY(entity, nextthink),
+	SAVE_MEMBER_PROPERTY(entity, prethink),
 	SAVE_MEMBER(entity, think),
 	
 	SAVE_MEMBER(entity, blocked),
@@ -1259,6 +1914,13 @@ inline void WriteGameStream(stringlit filename)
 		clients.push_back(stream.write_struct(client_save, &e.client).value_or(json()));
 
 	stream.json["clients"] = clients;
+#elif defined(COMPACT_SAVE_FORMAT)
+	stream.write_struct(game_locals_save, &game);
+
+	stream.write_varint(game.maxclients);
+
+	for (auto &e : entity_range(1, game.maxclients))
+		stream.write_struct(client_save, &e.client);
 #else
 	stream << stringref(__DATE__);
 
@@ -1305,6 +1967,14 @@ inline void ReadGameStream(stringlit filename)
 		for (auto &e : entity_range(1, game.maxclients))
 			stream.read_struct(clients[e.number - 1], client_save, &e.client);
 	}
+#elif defined(COMPACT_SAVE_FORMAT)
+	stream.read_struct(game_locals_save, &game);
+
+	if (stream.read_varint() != game.maxclients)
+		gi.error("Savegame has a different number of clients.\n");
+
+	for (auto &e : entity_range(1, game.maxclients))
+		stream.read_struct(client_save, &e.client);
 #else
 	string date;
 
@@ -1347,6 +2017,21 @@ inline void WriteLevelStream(stringlit filename)
 		}
 
 	stream.json["entities"] = entities_obj;
+#elif defined(COMPACT_SAVE_FORMAT)
+	// write out level_locals_t
+	stream.write_struct(level_locals_save, &level);
+
+	// entities are stored as number + 1, so 0 ends the list
+	for (auto &ent : entity_range(0, num_entities - 1))
+	{
+		if (!ent.inuse)
+			continue;
+
+		stream.write_varint(ent.number + 1);
+		stream.write_struct(entity_save, &ent);
+	}
+
+	stream.write_varint(0);
 #else
 	stream << sizeof(entity);
 
@@ -1381,6 +2066,9 @@ inline uint32_t ReadLevelStream(stringlit filename)
 	// load the level locals
 	if (stream.json.contains("level_locals"))
 		stream.read_struct(stream.json["level_locals"], level_locals_save, &level);
+#elif defined(COMPACT_SAVE_FORMAT)
+	// load the level locals
+	stream.read_struct(level_locals_save, &level);
 #else
 
 	size_t entity_size;
@@ -1407,6 +2095,14 @@ inline uint32_t ReadLevelStream(stringlit filename)
 		for (const auto &cent : entities_obj.items())
 		{
 			uint32_t id = atoi(cent.key().c_str());
+#elif defined(COMPACT_SAVE_FORMAT)
+
+		while (const uint32_t number = (uint32_t) stream.read_varint())
+		{
+			const uint32_t id = number - 1;
+
+			if (id >= max_entities)
+				gi.errorfmt("ReadLevel: bad entity number {}\n", id);
 #else
 
 		while (true)
@@ -1448,8 +2144,18 @@ void ReadLevel(stringlit filename)
 {
 	WipeEntities();
 
+	// configstrings were reset by the engine
+	gi.ClearIndexCache();
+	ClearItemIndices();
+
 	num_entities = ReadLevelStream(filename);
 
+	G_RebuildFreeList();
+	G_RebuildLiveList();
+	G_RebuildTargetnames();
+	G_RebuildTypes();
+	G_RebuildThinks();
+
 #ifdef SINGLE_PLAYER
 	// mark all clients as unconnected
 	for (entity &ent : entity_range(1, game.maxclients))
@@ -1465,7 +2171,7 @@ void ReadLevel(stringlit filename)
 
 		// fire any cross-level triggers
 		if (ent.type == ET_TARGET_CROSSLEVEL_TARGET)
-			ent.nextthink = duration_cast<gtime>(level.time + ent.delay);
+			ent.set_nextthink(duration_cast<gtime>(level.time + ent.delay));
 	}
 #endif
 }
@@ -126,6 +126,9 @@ struct savable
 	bool operator!=(const T &f) const { return f != (ptr_type) *this; }
 };
 
+// Build the name index for registered savables; errors out on duplicate names.
+void InitSavables();
+
 void WriteGame(stringlit filename, qboolean autosave);
 
 void ReadGame(stringlit filename);
@@ -151,6 +154,8 @@ using savable = std::conditional_t<std::is_function_v<T>, T *, std::conditional_
 #include "lib/protocol.h"
 #include "lib/gi.h"
 
+constexpr void InitSavables() { }
+
 inline void WriteGame(stringlit, qboolean)
 {
 	gi.dprint("Saving is not enabled in this mod.\n");
@@ -0,0 +1,107 @@
+#include "config.h"
+#include "spatial.h"
+#include "entity.h"
+
+// width of a single cell; roughly the size of an average explosion
+constexpr float SPATIAL_CELL_SIZE = 128.f;
+// cells on each axis; covers the full -4096 to 4096 map range.
+// anything outside of that falls into the edge cells.
+constexpr int32_t SPATIAL_GRID_SIZE = 64;
+constexpr float SPATIAL_GRID_MIN = -(SPATIAL_CELL_SIZE * SPATIAL_GRID_SIZE) / 2;
+
+static array<dynarray<uint32_t>, SPATIAL_GRID_SIZE * SPATIAL_GRID_SIZE>	spatial_cells;
+// cell + 1 that each entity is in, or 0 if it isn't in the grid
+static array<uint32_t, MAX_EDICTS>	spatial_entity_cell;
+// query results are handed out of a scratch arena that is reset
+// every frame, so radius searches don't allocate.
+static scratch<uint32_t>	spatial_scratch;
+
+static inline int32_t G_SpatialCoord(float v)
+{
+	return (int32_t) std::clamp(floor((v - SPATIAL_GRID_MIN) / SPATIAL_CELL_SIZE), 0.f, (float) (SPATIAL_GRID_SIZE - 1));
+}
+
+static inline uint32_t G_SpatialCell(vector point)
+{
+	return (uint32_t) ((G_SpatialCoord(point.y) * SPATIAL_GRID_SIZE) + G_SpatialCoord(point.x));
+}
+
+static void G_SpatialRemove(uint32_t number)
+{
+	uint32_t &cell = spatial_entity_cell[number];
+
+	if (!cell)
+		return;
+
+	dynarray<uint32_t> &list = spatial_cells[cell - 1];
+	auto it = std::find(list.begin(), list.end(), number);
+
+	*it = list.back();
+	list.pop_back();
+	cell = 0;
+}
+
+void G_SpatialLink(entity &e)
+{
+	if (e.is_world())
+		return;
+
+	const uint32_t cell = G_SpatialCell(e.origin + e.bounds.center());
+
+	// still in the same cell
+	if (spatial_entity_cell[e.number] == cell + 1)
+		return;
+
+	G_SpatialRemove(e.number);
+
+	spatial_cells[cell].push_back(e.number);
+	spatial_entity_cell[e.number] = cell + 1;
+}
+
+void G_SpatialUnlink(entity &e)
+{
+	G_SpatialRemove(e.number);
+}
+
+void G_SpatialClear()
+{
+	for (auto &list : spatial_cells)
+		list.clear();
+
+	spatial_entity_cell.fill(0);
+}
+
+std::span<uint32_t> G_SpatialQuery(vector org, float rad)
+{
+	const int32_t x0 = G_SpatialCoord(org.x - rad), x1 = G_SpatialCoord(org.x + rad);
+	const int32_t y0 = G_SpatialCoord(org.y - rad), y1 = G_SpatialCoord(org.y + rad);
+
+	// count first so the result can be reserved in one piece
+	size_t count = 0;
+
+	for (int32_t y = y0; y <= y1; y++)
+		for (int32_t x = x0; x <= x1; x++)
+			count += spatial_cells[(y * SPATIAL_GRID_SIZE) + x].size();
+
+	std::span<uint32_t> found = spatial_scratch.reserve(count);
+	auto out = found.begin();
+
+	for (int32_t y = y0; y <= y1; y++)
+		for (int32_t x = x0; x <= x1; x++)
+		{
+			const dynarray<uint32_t> &list = spatial_cells[(y * SPATIAL_GRID_SIZE) + x];
+			out = std::copy(list.begin(), list.end(), out);
+		}
+
+	found = spatial_scratch.commit(count);
+
+	// callers expect the same order as a linear scan
+	std::sort(found.begin(), found.end());
+
+	return found;
+}
+
+void G_SpatialClearScratch()
+{
+	spatial_scratch.reset();
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "config.h"
+#include "lib/types/dynarray.h"
+#include "lib/types/scratch.h"
+#include "lib/math/vector.h"
+#include "entity_types.h"
+
+/*
+==============================================================================
+
+SPATIAL GRID
+
+==============================================================================
+
+A uniform grid over the XY plane that buckets linked entities by the
+center of their bounds. It is kept in sync by gi.linkentity and
+gi.unlinkentity, so that radius searches only have to look at
+entities near the search origin instead of every edict.
+
+Entities that have never been linked are not in the grid.
+
+*/
+
+// place the entity in the cell containing its current center.
+// called by gi.linkentity after the server has linked it.
+void G_SpatialLink(entity &e);
+
+// remove the entity from the grid.
+// called by gi.unlinkentity.
+void G_SpatialUnlink(entity &e);
+
+// empty the grid; called whenever the entity list is wiped.
+void G_SpatialClear();
+
+/*
+=================
+G_SpatialQuery
+
+Returns the numbers of all entities in cells that overlap the square
+around org with a half-size of rad, sorted by entity number. The caller
+is expected to do the exact distance test. The result lives in a scratch
+arena and is only valid until the next G_SpatialClearScratch.
+=================
+*/
+std::span<uint32_t> G_SpatialQuery(vector org, float rad);
+
+// release all of the results returned by G_SpatialQuery; called
+// once per frame.
+void G_SpatialClearScratch();
@@ -8,6 +8,8 @@
 #include "game.h"
 #include "util.h"
 #include "lib/string/format.h"
+#include "lib/types/map.h"
+#include "lib/math/random.h"
 #ifdef SINGLE_PLAYER
 #include "trail.h"
 #ifdef ROGUE_AI
@@ -28,16 +30,38 @@ static const registered_entity *registered_entities_head;
 	registered_entities_head = &ent;
 }
 
+// registration links the type back to its spawn, so there's
+// nothing to search for
 stringlit FindClassnameFromEntityType(const entity_type &type)
 {
-	for (auto e = registered_entities_head; e; e = e->next)
-		if (e->type.is_exact(type))
-			return e->classname;
+	return type.spawn ? type.spawn->classname : nullptr;
+}
+
+/*
+===============
+FindSpawnByClassname
+
+The table is built the first time it's needed; everything
+registers itself during static init, so it's complete by then.
+===============
+*/
+static const registered_entity *FindSpawnByClassname(const stringref &classname)
+{
+	static imap<const registered_entity *> spawns_by_classname;
 
-	return nullptr;
+	if (spawns_by_classname.empty())
+		for (auto spawn = registered_entities_head; spawn; spawn = spawn->next)
+			spawns_by_classname.try_emplace(spawn->classname, spawn);
+
+	if (!classname)
+		return nullptr;
+
+	auto it = spawns_by_classname.find((stringlit) classname);
+	return (it == spawns_by_classname.end()) ? nullptr : it->second;
 }
 
-using spawn_deserializer = bool(*)(const string &input, void *obj);
+// values are deserialized straight out of the entity string
+using spawn_deserializer = bool(*)(std::string_view input, void *obj);
 
 struct spawn_field
 {
@@ -46,85 +70,64 @@ struct spawn_field
 	bool				is_temp;
 };
 
-static stringref strip_newlines(const string &input)
+// the C library wants numbers terminated; they're
+// short, so they get copied to the stack for it.
+class number_token
 {
-	if (!input)
-		return input;
-
-	size_t len = 0;
-
-	for (auto it = input.ptr(); *it; it++)
-	{
-		if (*it == '\\')
-			it++;
-
-		len++;
-	}
-
-	if (len == input.length())
-		return input;
-
-	mutable_string str;
-	str.reserve(len + 1);
+	array<char, 64>	buffer;
 
-	for (auto it = input.ptr(); *it; it++)
+public:
+	number_token(std::string_view input)
 	{
-		if (*it == '\\')
-		{
-			it++;
-
-			if (*it == 'n')
-				str += '\n';
-			else
-				str += '\\';
-		}
-		else
-			str += *it;
+		const size_t length = std::min(input.size(), buffer.size() - 1);
+		memcpy(buffer.data(), input.data(), length);
+		buffer[length] = 0;
 	}
 
-	return std::move(str);
-}
+	stringlit ptr() const { return buffer.data(); }
+};
 
 template<typename T>
-concept is_string_like = std::is_same_v<T, string> || std::is_same_v<T, stringref>;
+concept is_string_like = std::is_same_v<T, string> || std::is_same_v<T, stringref> || std::is_same_v<T, atom>;
 
 template<is_string_like T>
-static bool deserialize(const string &input, T &output)
+static bool deserialize(std::string_view input, T &output)
 {
-	output = strip_newlines(input);
+	output = strunescape(input);
 	return true;
 }
 
 template<typename T> requires std::is_integral_v<T>
-static bool deserialize(const string &input, T &output)
+static bool deserialize(std::string_view input, T &output)
 {
-	if (!input) {
+	if (input.empty()) {
 		output = (T) 0;
 		return true;
 	}
 
+	const number_token number(input);
 	char *endptr;
 
 	if constexpr(std::is_unsigned_v<T>)
 	{
 		if constexpr(sizeof(T) > 4)
-			output = (T)strtoull(input.ptr(), (char **)&endptr, 10);
+			output = (T)strtoull(number.ptr(), (char **)&endptr, 10);
 		else
-			output = (T)strtoul(input.ptr(), (char **)&endptr, 10);
+			output = (T)strtoul(number.ptr(), (char **)&endptr, 10);
 	}
 	else
 	{
 		if constexpr(sizeof(T) > 4)
-			output = (T)strtoll(input.ptr(), (char **)&endptr, 10);
+			output = (T)strtoll(number.ptr(), (char **)&endptr, 10);
 		else
-			output = (T)strtol(input.ptr(), (char **)&endptr, 10);
+			output = (T)strtol(number.ptr(), (char **)&endptr, 10);
 	}
 
 	return endptr;
 }
 
 template<typename T> requires std::is_enum_v<T>
-static bool deserialize(const string &input, T &output)
+static bool deserialize(std::string_view input, T &output)
 {
 	return deserialize(input, (std::underlying_type_t<T> &) output);
 }
@@ -133,25 +136,26 @@ template<typename T>
 concept is_floating_like = std::is_floating_point_v<T>;
 
 template<is_floating_like T>
-static bool deserialize(const string &input, T &output)
+static bool deserialize(std::string_view input, T &output)
 {
-	if (!input) {
+	if (input.empty()) {
 		output = (T) 0;
 		return true;
 	}
 
+	const number_token number(input);
 	char *endptr;
 
 	if constexpr(sizeof(T) > 4)
-		output = (T)strtod(input.ptr(), (char **)&endptr);
+		output = (T)strtod(number.ptr(), (char **)&endptr);
 	else
-		output = (T)strtof(input.ptr(), (char **)&endptr);
+		output = (T)strtof(number.ptr(), (char **)&endptr);
 
 	return endptr;
 }
 
 template<typename T> requires std::is_same_v<T, gtimef>
-static bool deserialize(const string &input, T &output)
+static bool deserialize(std::string_view input, T &output)
 {
 	float v;
 
@@ -162,9 +166,10 @@ static bool deserialize(const string &input, T &output)
 	return true;
 }
 
-static bool deserialize(const string &input, vector &output)
+static bool deserialize(std::string_view input, vector &output)
 {
-	char *endptr = (char *)input.ptr();
+	const number_token number(input);
+	char *endptr = (char *)number.ptr();
 
 	for (size_t i = 0; i < 3; i++)
 	{
@@ -178,13 +183,13 @@ static bool deserialize(const string &input, vector &output)
 }
 
 #define SPAWN_EFIELD_NAMED(name, field) \
-	{ name, [](const string &input, void *obj) { return deserialize(input, ((entity *) obj)->field); }, false }
+	{ name, [](std::string_view input, void *obj) { return deserialize(input, ((entity *) obj)->field); }, false }
 
 #define SPAWN_EFIELD(name) \
 	SPAWN_EFIELD_NAMED(#name, name)
 
 #define SPAWN_TFIELD_NAMED(name, field) \
-	{ name, [](const string &input, void *obj) { return deserialize(input, ((spawn_temp *) obj)->field); }, true }
+	{ name, [](std::string_view input, void *obj) { return deserialize(input, ((spawn_temp *) obj)->field); }, true }
 
 #define SPAWN_TFIELD(name) \
 	SPAWN_TFIELD_NAMED(#name, name)
@@ -198,7 +203,8 @@ constexpr spawn_field spawn_fields[] =
 	SPAWN_EFIELD(accel),
 	SPAWN_EFIELD(decel),
 	SPAWN_EFIELD(target),
-	SPAWN_EFIELD(targetname),
+	// indexed, so it has to go through G_SetTargetname
+	{ "targetname", [](std::string_view input, void *obj) { G_SetTargetname(*(entity *) obj, strunescape(input)); return true; }, false },
 	SPAWN_EFIELD(pathtarget),
 	SPAWN_EFIELD(deathtarget),
 	SPAWN_EFIELD(killtarget),
@@ -246,10 +252,36 @@ constexpr spawn_field spawn_fields[] =
 	SPAWN_TFIELD(maxpitch)
 };
 
-static bool ED_ParseField(const string &key, const string &value, entity &ent)
+// spawn_fields, hashed by key at compile time. open addressing;
+// there's room to spare so probes stay short. each bucket holds
+// a field index plus one, or zero if it's empty.
+constexpr size_t SPAWN_FIELD_BUCKETS = 128;
+
+static_assert(std::size(spawn_fields) * 2 <= SPAWN_FIELD_BUCKETS, "spawn field table is too full");
+
+constexpr array<uint8_t, SPAWN_FIELD_BUCKETS> spawn_field_buckets = []() {
+	array<uint8_t, SPAWN_FIELD_BUCKETS> buckets {};
+
+	for (size_t i = 0; i < std::size(spawn_fields); i++)
+	{
+		size_t b = strihash(spawn_fields[i].key) & (SPAWN_FIELD_BUCKETS - 1);
+
+		// earlier fields are found first, same as a linear search
+		while (buckets[b])
+			b = (b + 1) & (SPAWN_FIELD_BUCKETS - 1);
+
+		buckets[b] = (uint8_t) (i + 1);
+	}
+
+	return buckets;
+}();
+
+static bool ED_ParseField(std::string_view key, std::string_view value, entity &ent)
 {
-	for (auto &field : spawn_fields)
+	for (size_t b = strihash(key) & (SPAWN_FIELD_BUCKETS - 1); spawn_field_buckets[b]; b = (b + 1) & (SPAWN_FIELD_BUCKETS - 1))
 	{
+		const spawn_field &field = spawn_fields[spawn_field_buckets[b] - 1];
+
 		if (!striequals(field.key, key))
 			continue;
 
@@ -267,7 +299,7 @@ static void ClearSpawnTemp()
 	st = {};
 }
 
-static void ED_ParseEdict(stringlit entities, size_t &entities_offset, entity &ent)
+static void ED_ParseEdict(tokenizer &tokens, entity &ent)
 {
 	bool init = false;
 	
@@ -275,12 +307,12 @@ static void ED_ParseEdict(stringlit entities, size_t &entities_offset, entity &e
 	while (true)
 	{
 		// parse key
-		string key = strtok(entities, entities_offset);
+		const std::string_view key = tokens.next();
 		
 		if (key == "}")
 			break;
-		else if (strempty(key))
-			gi.errorfmt("{}: EOF without closing brace");
+		else if (key.empty())
+			gi.errorfmt("{}: EOF without closing brace", __func__);
 
 		init = true;
 		
@@ -288,11 +320,11 @@ static void ED_ParseEdict(stringlit entities, size_t &entities_offset, entity &e
 		// and are immediately discarded by quake
 		if (key[0] == '_')
 		{
-			strtok(entities, entities_offset);
+			tokens.next();
 			continue;
 		}
 
-		string value = strtok(entities, entities_offset);
+		const std::string_view value = tokens.next();
 		
 		if (!ED_ParseField(key, value, ent))
 			gi.dprintfmt("{}: {} is not a field\n", __func__, key);
@@ -363,13 +395,10 @@ bool ED_CallSpawn(entity &ent)
 		return true;
 	}
 
-	for (auto spawn = registered_entities_head; spawn; spawn = spawn->next)
+	if (auto spawn = FindSpawnByClassname(st.classname))
 	{
-		if (striequals(spawn->classname, st.classname))
-		{
-			ent.type = spawn->type;
-			return ED_CallSpawn(ent);
-		}
+		G_SetType(ent, spawn->type);
+		return ED_CallSpawn(ent);
 	}
 
 	gi.dprintfmt("{}: {} doesn't have a spawn function\n", __func__, st.classname);
@@ -395,6 +424,9 @@ All but the last will have the teamchain field set to the next one
 static inline void G_FixTeams()
 {
 	size_t c = 0;
+	// every member of a team shares the same master, so
+	// only the first one we run into needs checking
+	bitset<MAX_EDICTS> checked;
 
 	for (uint32_t i = 1; i < num_entities; i++)
 	{
@@ -405,6 +437,11 @@ static inline void G_FixTeams()
 		
 		entity &master = e.teammaster;
 
+		if (checked[master.number])
+			continue;
+
+		checked.set(master.number);
+
 		// already a train, so don't worry about us
 		if (master.type == ET_FUNC_TRAIN)
 			continue;
@@ -435,7 +472,7 @@ static inline void G_FixTeams()
 			e2.teammaster = first_train;
 
 			// copy over movetype and speed
-			e2.movetype = MOVETYPE_PUSH;
+			e2.set_movetype(MOVETYPE_PUSH);
 			e2.speed = first_train->speed;
 			
 			// reached the guy before first_train
@@ -468,8 +505,13 @@ static inline void G_FixTeams()
 
 static inline void G_FindTeams()
 {
+	const auto start = std::chrono::steady_clock::now();
 	size_t c = 0, c2 = 0;
 
+	// the last entity added to each team; entities are visited
+	// in order, so the lowest numbered one becomes the master.
+	map<atom, entityref> chains;
+
 	for (uint32_t i = 1; i < num_entities; i++)
 	{
 		entity &e = itoe(i);
@@ -481,42 +523,36 @@ static inline void G_FindTeams()
 		if (e.flags & FL_TEAMSLAVE)
 			continue;
 
-		entityref chain = e;
-		e.teammaster = e;
+		auto [it, added] = chains.try_emplace(e.team, e);
+
 		e.teamchain = 0;
-		c++;
 		c2++;
 
-		for (uint32_t j = i + 1; j < num_entities ; j++)
+		if (added)
 		{
-			entity &e2 = itoe(j);
-
-			if (!e2.inuse)
-				continue;
-			if (!e2.team)
-				continue;
-			if (e2.flags & FL_TEAMSLAVE)
-				continue;
-			if (e.team == e2.team)
-			{
-				c2++;
-				chain->teamchain = e2;
-				e2.teammaster = e;
-				e2.teamchain = 0;
-				chain = e2;
-				e2.flags |= FL_TEAMSLAVE;
-			}
+			e.teammaster = e;
+			c++;
+			continue;
 		}
+
+		entity &chain = it->second;
+
+		chain.teamchain = e;
+		e.teammaster = chain.teammaster;
+		e.flags |= FL_TEAMSLAVE;
+		it->second = e;
 	}
 
-	gi.dprintfmt("{} teams with {} entities\n", c, c2);
+	const auto time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	gi.dprintfmt("{} teams with {} entities ({}us)\n", c, c2, time.count());
 	
 	G_FixTeams();
 }
 
 void SpawnEntities(stringlit mapname, stringlit entities, stringlit spawnpoint)
 {
-	size_t entities_offset = 0;
+	tokenizer tokens(entities);
 
 #ifdef SINGLE_PLAYER
 	int32_t skill_level = clamp(0, (int32_t)skill, 3);
@@ -525,6 +561,15 @@ void SpawnEntities(stringlit mapname, stringlit entities, stringlit spawnpoint)
 		gi.cvar_forcesetfmt("skill", "{}", skill_level);
 #endif
 
+	// configstrings were reset by the engine
+	gi.ClearIndexCache();
+	ClearItemIndices();
+
+	// a fixed seed makes the level play out the same way every
+	// time it gets the same input; see framehash.h
+	if (const cvarref seed = gi.cvar("g_seed", "0", CVAR_LATCH))
+		Q_srand(strtoull(seed.string, nullptr, 10));
+
 	level = {};
 	level.mapname = mapname;
 	game.spawnpoint = spawnpoint;
@@ -535,9 +580,9 @@ void SpawnEntities(stringlit mapname, stringlit entities, stringlit spawnpoint)
 	// parse ents
 	while (1)
 	{
-		string token = strtok(entities, entities_offset);
+		const std::string_view token = tokens.next();
 		
-		if (entities_offset == (size_t) -1)
+		if (tokens.done())
 			break;
 
 		if (token != "{")
@@ -548,7 +593,7 @@ void SpawnEntities(stringlit mapname, stringlit entities, stringlit spawnpoint)
 		else
 			G_InitEdict(ent);
 		
-		ED_ParseEdict(entities, entities_offset, ent);
+		ED_ParseEdict(tokens, ent);
 
 #ifdef SINGLE_PLAYER
 		// yet another map hack
@@ -609,7 +654,7 @@ void SpawnEntities(stringlit mapname, stringlit entities, stringlit spawnpoint)
 	
 	ClearSpawnTemp();
 
-	gi.dprintfmt("{} entities inhibited\n", inhibit);
+	gi.dprintfmt("{} entities inhibited, {} atoms\n", inhibit, atom::count());
 
 	G_FindTeams();
 #ifdef SINGLE_PLAYER
@@ -639,7 +684,7 @@ Only used for the world.
 */
 static void SP_worldspawn(entity &ent)
 {
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_BSP;
 	ent.modelindex = MODEL_WORLD;      // world model is always index 1
 
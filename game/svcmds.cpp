@@ -3,11 +3,141 @@
 #include "lib/gi.h"
 #include "lib/types/allocator.h"
 #include "svcmds.h"
+#include "util.h"
+#include "profile.h"
+#include "pmove.h"
+#include "monster.h"
+#include "game.h"
+
+/*
+=================
+Svcmd_Traces_f
+
+sv traces start		- start counting traces/pointcontents per call site
+sv traces stop		- stop counting
+sv traces reset		- throw away the counts so far
+sv traces [count]	- print the call sites that took the longest; 20 by default
+=================
+*/
+static void Svcmd_Traces_f()
+{
+	const string cmd = gi.argv(2);
+
+	if (cmd == "start")
+	{
+		gi.trace_accounting = true;
+		gi.dprint("Trace accounting started.\n");
+		return;
+	}
+	else if (cmd == "stop")
+	{
+		gi.trace_accounting = false;
+		gi.dprint("Trace accounting stopped.\n");
+		return;
+	}
+	else if (cmd == "reset")
+	{
+		gi.clear_trace_call_sites();
+		return;
+	}
+
+	dynarray<trace_call_site> sites = gi.trace_call_sites();
+	const size_t count = std::min(sites.size(), cmd ? (size_t) std::max(1, atoi(cmd.ptr())) : 20);
+
+	std::partial_sort(sites.begin(), sites.begin() + count, sites.end(), [](const trace_call_site &a, const trace_call_site &b) {
+		return a.time > b.time;
+	});
+
+	gi.dprintfmt("{} call sites\n", sites.size());
+	gi.dprintfmt("{:>9} {:>9} {:>10} {:>10}  {}\n", "traces", "contents", "total ms", "us/call", "location");
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const trace_call_site &site = sites[i];
+		stringlit file = site.location.file_name();
+
+		// the full path is mostly noise
+		for (stringlit c = file; *c; c++)
+			if (*c == '/' || *c == '\\')
+				file = c + 1;
+
+		gi.dprintfmt("{:>9} {:>9} {:>10.2f} {:>10.2f}  {}:{} ({})\n", site.traces, site.pointcontents, site.time.count() / 1000000.f,
+			site.time.count() / 1000.f / (site.traces + site.pointcontents), file, site.location.line(), site.location.function_name());
+	}
+}
+
+#ifdef SINGLE_PLAYER
+/*
+=================
+Svcmd_Dormancy_f
+
+sv dormancy			- print how many monsters are dormant, and the counts so far
+sv dormancy reset	- throw away the counts so far
+=================
+*/
+static void Svcmd_Dormancy_f()
+{
+	const string cmd = gi.argv(2);
+
+	if (cmd == "reset")
+	{
+		M_ResetDormancyStats();
+		return;
+	}
+
+	uint32_t monsters = 0, dormant = 0;
+
+	for (entity &ent : G_IterateLive(game.maxclients + 1))
+	{
+		if (!(ent.svflags & SVF_MONSTER) || ent.health <= 0)
+			continue;
+
+		monsters++;
+
+		if (std::as_const(ent.monsterinfo)->dormant)
+			dormant++;
+	}
+
+	const dormancy_stats &stats = M_DormancyStats();
+
+	gi.dprintfmt("dormancy is {}\n", g_ai_dormancy ? "on" : "off");
+	gi.dprintfmt("dormant: {}/{}, slept: {}, idle ticks: {}\n", dormant, monsters, stats.sleeps, stats.idle_ticks);
+	gi.dprintfmt("woken by sight: {}, sound: {}, damage: {}, use: {}\n", stats.wakes[WAKE_SIGHT], stats.wakes[WAKE_SOUND],
+		stats.wakes[WAKE_DAMAGE], stats.wakes[WAKE_USE]);
+}
+#endif
 
 void ServerCommand()
 {
 	string s = gi.argv(1);
 
 	if (s == "mem")
+	{
 		gi.dprintfmt("{}, {}\n", internal::game_count, internal::non_game_count);
+
+		const free_list_stats &stats = G_FreeListStats();
+
+		gi.dprintfmt("free slots: {}, reused: {} ({} early), appended: {}, last age: {}ms, mean age: {}ms\n",
+			stats.depth, stats.reused, stats.early, stats.appended, stats.last_age.count(),
+			stats.reused ? (stats.total_age / stats.reused).count() : 0);
+
+		gi.dprintfmt("moveinfo: {}/{}\n", pool<moveinfo>::get().count(), pool<moveinfo>::get().capacity());
+#ifdef SINGLE_PLAYER
+		gi.dprintfmt("monsterinfo: {}/{}\n", pool<monsterinfo>::get().count(), pool<monsterinfo>::get().capacity());
+#endif
+	}
+	else if (s == "traces")
+		Svcmd_Traces_f();
+#ifdef SINGLE_PLAYER
+	else if (s == "dormancy")
+		Svcmd_Dormancy_f();
+#endif
+#ifdef PROFILING
+	else if (s == "prof")
+		Svcmd_Prof_f();
+#endif
+#ifdef CUSTOM_PMOVE
+	else if (s == "pmove")
+		Svcmd_Pmove_f();
+#endif
 }
\ No newline at end of file
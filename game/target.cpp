@@ -272,7 +272,7 @@ static void use_target_explosion(entity &self, entity &, entity &cactivator)
 	}
 
 	self.think = SAVABLE(target_explosion_explode);
-	self.nextthink = duration_cast<gtime>(level.time + self.delay);
+	self.set_nextthink(duration_cast<gtime>(level.time + self.delay));
 }
 
 REGISTER_STATIC_SAVABLE(use_target_explosion);
@@ -525,7 +525,7 @@ static void SP_target_crosslevel_target(entity &self)
 	self.svflags = SVF_NOCLIENT;
 
 	self.think = SAVABLE(target_crosslevel_target_think);
-	self.nextthink = duration_cast<gtime>(level.time + self.delay);
+	self.set_nextthink(duration_cast<gtime>(level.time + self.delay));
 }
 
 REGISTER_ENTITY(TARGET_CROSSLEVEL_TARGET, target_crosslevel_target);
@@ -603,7 +603,7 @@ void target_laser_think(entity &self)
 
 	self.old_origin = tr.endpos;
 
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_SAVABLE(target_laser_think);
@@ -621,7 +621,7 @@ static void target_laser_off(entity &self)
 {
 	self.spawnflags &= ~LASER_ON;
 	self.svflags |= SVF_NOCLIENT;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 }
 
 static void target_laser_use(entity &self, entity &, entity &cactivator)
@@ -637,7 +637,7 @@ REGISTER_STATIC_SAVABLE(target_laser_use);
 
 static void target_laser_start(entity &self)
 {
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.solid = SOLID_NOT;
 	self.renderfx |= RF_BEAM | RF_TRANSLUCENT;
 	self.modelindex = MODEL_WORLD;         // must be non-zero
@@ -664,7 +664,7 @@ static void target_laser_start(entity &self)
 	{
 		if (self.target)
 		{
-			entityref ent = G_FindFunc<&entity::targetname>(world, self.target, striequals);
+			entityref ent = G_FindTargetname(world, self.target);
 			if (!ent.has_value())
 				gi.dprintfmt("{}: {} is a bad target\n", self, self.target);
 			self.enemy = ent;
@@ -694,7 +694,7 @@ static void SP_target_laser(entity &self)
 {
 	// let everything else get spawned before we start firing
 	self.think = SAVABLE(target_laser_start);
-	self.nextthink = level.time + 1s;
+	self.set_nextthink(level.time + 1s);
 }
 
 static REGISTER_ENTITY(TARGET_LASER, target_laser);
@@ -714,7 +714,7 @@ static void target_lightramp_think(entity &self)
 	gi.configstringfmt((config_string)(CS_LIGHTS + self.enemy->style), "{}", (char) ('a' + self.movedir.x + diff * self.movedir.z));
 
 	if (diff < self.speed)
-		self.nextthink = level.time + 100ms;
+		self.set_nextthink(level.time + 100ms);
 	else if (self.spawnflags & 1)
 	{
 		int temp = (int) self.movedir.x;
@@ -731,7 +731,7 @@ static void target_lightramp_use(entity &self, entity &, entity &)
 	if (!self.enemy.has_value())
 	{
 		// check all the targets
-		for (entity &e : G_IterateFunc<&entity::targetname>(self.target, striequals))
+		for (entity &e : G_IterateTargetname(self.target))
 		{
 			if (e.type != ET_LIGHT)
 				gi.dprintfmt("{}: target \"{}\" ({}) is not a light\n", self, self.target, e);
@@ -807,11 +807,8 @@ static void target_earthquake_think(entity &self)
 		self.last_move_time = level.time + 500ms;
 	}
 
-	for (uint32_t i = 1; i < num_entities; i++)
+	for (entity &e : G_IterateLive(1))
 	{
-		entity &e = itoe(i);
-		if (!e.inuse)
-			continue;
 		if (!e.is_client)
 			continue;
 		if (!e.groundentity.has_value())
@@ -824,7 +821,7 @@ static void target_earthquake_think(entity &self)
 	}
 
 	if (level.time < self.timestamp)
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(target_earthquake_think);
@@ -832,7 +829,7 @@ REGISTER_STATIC_SAVABLE(target_earthquake_think);
 static void target_earthquake_use(entity &self, entity &, entity &cactivator)
 {
 	self.timestamp = level.time + seconds(self.count);
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	self.activator = cactivator;
 	self.last_move_time = gtime::zero();
 }
@@ -0,0 +1,222 @@
+#include "config.h"
+#include "lib/types/dynarray.h"
+#include "game.h"
+#include "entity.h"
+#include "util.h"
+#include "think.h"
+
+// frames covered by each slot of the near wheel, and slots in it
+constexpr uint64_t THINK_NEAR_BITS = 8;
+constexpr uint64_t THINK_NEAR_SLOTS = 1 << THINK_NEAR_BITS;
+// slots in the far wheel, each covering a full turn of the near one
+constexpr uint64_t THINK_FAR_BITS = 6;
+constexpr uint64_t THINK_FAR_SLOTS = 1 << THINK_FAR_BITS;
+
+struct think_entry
+{
+	uint32_t	number;
+	gtime		time;
+};
+
+static array<dynarray<think_entry>, THINK_NEAR_SLOTS>	think_near;
+static array<dynarray<think_entry>, THINK_FAR_SLOTS>	think_far;
+// anything more than a full turn of the far wheel away
+static dynarray<think_entry>	think_overflow;
+// the last frame that the wheel was advanced to
+static uint64_t	think_frame;
+
+// one bit per entity number, 64 to a word, so that G_NextFrameEntity
+// can skip over a word's worth of idle entities at a time
+using entity_bits = array<uint64_t, (MAX_EDICTS + 63) / 64>;
+
+static entity_bits	think_due;
+// entities that aren't idle, and so run every frame
+static entity_bits	frame_active;
+
+static inline void G_SetBit(entity_bits &bits, uint32_t number)
+{
+	bits[number >> 6] |= 1ull << (number & 63);
+}
+
+static inline void G_ResetBit(entity_bits &bits, uint32_t number)
+{
+	bits[number >> 6] &= ~(1ull << (number & 63));
+}
+
+static inline bool G_TestBit(const entity_bits &bits, uint32_t number)
+{
+	return bits[number >> 6] & (1ull << (number & 63));
+}
+
+// the first frame at which the given time has come
+static inline uint64_t G_ThinkFrame(gtime time)
+{
+	return (uint64_t) ((time + framerate_ms - 1ms) / framerate_ms);
+}
+
+static void G_FileThink(const think_entry &e)
+{
+	const uint64_t frame = G_ThinkFrame(e.time);
+
+	if (frame <= think_frame)
+	{
+		if (itoe(e.number).get_nextthink() == e.time)
+			G_SetBit(think_due, e.number);
+	}
+	else if (frame - think_frame < THINK_NEAR_SLOTS)
+		think_near[frame & (THINK_NEAR_SLOTS - 1)].push_back(e);
+	else if ((frame >> THINK_NEAR_BITS) - (think_frame >> THINK_NEAR_BITS) < THINK_FAR_SLOTS)
+		think_far[(frame >> THINK_NEAR_BITS) & (THINK_FAR_SLOTS - 1)].push_back(e);
+	else
+		think_overflow.push_back(e);
+}
+
+// move everything in the list back through G_FileThink
+static void G_RefileThinks(dynarray<think_entry> &list)
+{
+	dynarray<think_entry> entries;
+	entries.swap(list);
+
+	for (const think_entry &e : entries)
+		G_FileThink(e);
+}
+
+void entity::set_nextthink(gtime time)
+{
+	nextthink = time;
+	G_ResetBit(think_due, number);
+
+	if (time > gtime::zero())
+		G_ScheduleThink(*this);
+}
+
+void entity::set_movetype(move_type type)
+{
+	movetype = type;
+	G_UpdateIdle(*this);
+}
+
+void entity::set_prethink(savable<ethinkfunc> func)
+{
+	prethink = func;
+	G_UpdateIdle(*this);
+}
+
+void G_ScheduleThink(entity &ent)
+{
+	G_FileThink({ ent.number, ent.get_nextthink() });
+}
+
+bool G_ThinkDue(const entity &ent)
+{
+	return G_TestBit(think_due, ent.number);
+}
+
+void G_AdvanceThinks()
+{
+	const uint64_t target = G_ThinkFrame(level.time);
+
+	while (think_frame < target)
+	{
+		think_frame++;
+
+		// a turn of the near wheel is done; bring down the next far slot,
+		// and anything in the overflow that is in range now
+		if (!(think_frame & (THINK_NEAR_SLOTS - 1)))
+		{
+			if (!((think_frame >> THINK_NEAR_BITS) & (THINK_FAR_SLOTS - 1)))
+				G_RefileThinks(think_overflow);
+
+			G_RefileThinks(think_far[(think_frame >> THINK_NEAR_BITS) & (THINK_FAR_SLOTS - 1)]);
+		}
+
+		dynarray<think_entry> &slot = think_near[think_frame & (THINK_NEAR_SLOTS - 1)];
+
+		for (const think_entry &e : slot)
+		{
+			const entity &ent = itoe(e.number);
+
+			if (ent.inuse && ent.get_nextthink() == e.time)
+				G_SetBit(think_due, e.number);
+		}
+
+		slot.clear();
+	}
+}
+
+void G_ClearThinks()
+{
+	for (auto &slot : think_near)
+		slot.clear();
+
+	for (auto &slot : think_far)
+		slot.clear();
+
+	think_overflow.clear();
+	think_due = {};
+	frame_active = {};
+	think_frame = 0;
+}
+
+void G_RebuildThinks()
+{
+	G_ClearThinks();
+
+	think_frame = G_ThinkFrame(level.time);
+
+	for (entity &ent : G_IterateLive())
+	{
+		G_UpdateIdle(ent);
+
+		if (ent.get_nextthink() > gtime::zero())
+			G_ScheduleThink(ent);
+	}
+}
+
+static inline bool G_IsIdle(const entity &ent)
+{
+	return ent.get_movetype() == MOVETYPE_NONE && !ent.get_prethink() && !ent.is_client;
+}
+
+// idle entities don't get the old_origin copy at the top of every frame,
+// so keep it in step with origin here. beams keep their end point in it.
+static inline void G_SyncOldOrigin(entity &ent)
+{
+	if (!(ent.renderfx & RF_BEAM))
+		ent.old_origin = ent.origin;
+}
+
+void G_UpdateIdle(entity &ent)
+{
+	const bool idle = G_IsIdle(ent);
+
+	if (ent.inuse && !idle)
+		G_SetBit(frame_active, ent.number);
+	else
+		G_ResetBit(frame_active, ent.number);
+
+	if (idle)
+		G_SyncOldOrigin(ent);
+}
+
+void G_IdleLinked(entity &ent)
+{
+	if (G_IsIdle(ent))
+		G_SyncOldOrigin(ent);
+}
+
+uint32_t G_NextFrameEntity(uint32_t first)
+{
+	for (uint32_t w = first >> 6; w < frame_active.size() && (w << 6) < num_entities; w++)
+	{
+		uint64_t bits = think_due[w] | frame_active[w];
+
+		if (w == first >> 6)
+			bits &= ~0ull << (first & 63);
+
+		if (bits)
+			return std::min((w << 6) + (uint32_t) std::countr_zero(bits), num_entities);
+	}
+
+	return num_entities;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "config.h"
+#include "entity.h"
+
+/*
+==============================================================================
+
+THINK WHEEL
+
+==============================================================================
+
+Keeps track of when every entity is due to think, so that RunFrame only
+has to visit the entities that move and the ones that are thinking, rather
+than every entity on the map. Setting nextthink files the entity into a
+hierarchical timing wheel: one slot per frame for the next 256 frames, one
+slot per 256 frames after that, and an overflow list for anything further
+out. Each frame only the slots that have come due are looked at, and the
+entities in them are flagged as due.
+
+Entries aren't removed when nextthink changes; an entry only counts if the
+entity still has the nextthink it was filed with when its slot comes up.
+
+An entity is idle when all RunFrame would do with it is run its think:
+movetype NONE, no prethink, and not a client. Those make up most of a
+map (triggers, targets, lights, path corners), and G_IterateFrame skips
+them on every frame that their think isn't due. On those frames they
+miss the old_origin copy at the top of the frame, and the client lerps
+from old_origin when an entity first comes into view, so for idle
+entities it is instead set to origin whenever they are linked or become
+idle. They also miss the groundentity check, which only matters for
+something that is being moved around.
+*/
+
+// file the entity under its current nextthink; called by entity::set_nextthink
+void G_ScheduleThink(entity &ent);
+
+// whether the entity's nextthink has come due
+bool G_ThinkDue(const entity &ent);
+
+// flag every entity whose nextthink is now <= level.time as due;
+// called by RunFrame after the level time moves forward.
+void G_AdvanceThinks();
+
+// empty the wheel; called whenever the entity list is wiped.
+void G_ClearThinks();
+
+// refill the wheel from the entities' nextthinks after a load
+void G_RebuildThinks();
+
+// re-check whether the entity is idle; called when anything that decides
+// that changes, which is set_movetype, set_prethink and the live list.
+void G_UpdateIdle(entity &ent);
+
+// keep an idle entity's old_origin at its origin; called by gi.linkentity.
+void G_IdleLinked(entity &ent);
+
+// the first entity number at or after first that isn't idle or has its
+// think due, or num_entities if there isn't one
+uint32_t G_NextFrameEntity(uint32_t first);
+
+struct frame_entity_sentinel { };
+
+struct frame_entity_iterator
+{
+	uint32_t	number;
+
+	using difference_type = ptrdiff_t;
+	using value_type = entity;
+	using pointer = entity *;
+	using reference = entity &;
+	using iterator_category = std::forward_iterator_tag;
+
+	entity &operator*() const { return itoe(number); }
+	entity *operator->() const { return &itoe(number); }
+
+	frame_entity_iterator &operator++()
+	{
+		number = G_NextFrameEntity(number + 1);
+		return *this;
+	}
+
+	bool operator==(const frame_entity_sentinel &) const { return number >= num_entities; }
+};
+
+struct frame_entity_container
+{
+	uint32_t	first;
+
+	frame_entity_iterator begin() const { return { G_NextFrameEntity(first) }; }
+	frame_entity_sentinel end() const { return { }; }
+};
+
+/*
+=================
+G_IterateFrame
+
+Iterate every entity that RunFrame has to run this frame, in number
+order: the ones that aren't idle, and idle ones whose think is due.
+Like G_IterateLive, ones that start to need running during the loop
+are picked up if they come after the current one.
+=================
+*/
+inline frame_entity_container G_IterateFrame(uint32_t first = 0)
+{
+	return { first };
+}
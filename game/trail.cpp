@@ -66,7 +66,7 @@ entityref PlayerTrail_PickFirst(entity &self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self.monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self.monsterinfo->trail_time)
 			marker = NEXT(marker);
 		else
 			break;
@@ -90,7 +90,7 @@ entityref PlayerTrail_PickNext(entity &self)
 		return null_entity;
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--) {
-		if (trail[marker]->timestamp <= self.monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self.monsterinfo->trail_time)
 			marker = NEXT(marker);
 		else
 			break;
@@ -24,7 +24,7 @@ void InitTrigger(entity &self)
 		G_SetMovedir(self.angles, self.movedir);
 
 	self.solid = SOLID_TRIGGER;
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	gi.setmodel(self, self.model);
 	self.svflags = SVF_NOCLIENT;
 }
@@ -32,7 +32,7 @@ void InitTrigger(entity &self)
 // the wait time has passed, so set back up for another activation
 static void multi_wait(entity &ent)
 {
-	ent.nextthink = gtime::zero();
+	ent.set_nextthink(gtime::zero());
 }
 
 REGISTER_STATIC_SAVABLE(multi_wait);
@@ -42,7 +42,7 @@ REGISTER_STATIC_SAVABLE(multi_wait);
 // so wait for the delay time before firing
 static void multi_trigger(entity &ent)
 {
-	if (ent.nextthink != gtime::zero())
+	if (ent.get_nextthink() != gtime::zero())
 		return;     // already been triggered
 
 	G_UseTargets(ent, ent.activator);
@@ -50,14 +50,14 @@ static void multi_trigger(entity &ent)
 	if (ent.wait.count() > 0)
 	{
 		ent.think = SAVABLE(multi_wait);
-		ent.nextthink = duration_cast<gtime>(level.time + ent.wait);
+		ent.set_nextthink(duration_cast<gtime>(level.time + ent.wait));
 	}
 	else
 	{
 		// we can't just remove (self) here, because this is a touch function
 		// called while looping through area links...
 		ent.touch = nullptr;
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 		ent.think = SAVABLE(G_FreeEdict);
 	}
 }
@@ -147,7 +147,7 @@ static void SP_trigger_multiple(entity &ent)
 	if (ent.wait == gtimef::zero())
 		ent.wait = 0.2s;
 	ent.touch = SAVABLE(Touch_Multi);
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.svflags |= SVF_NOCLIENT;
 
 
@@ -486,13 +486,13 @@ REGISTER_STATIC_SAVABLE(trigger_push_active);
 static void trigger_push_inactive(entity &self)
 {
 	if (self.delay > level.time)
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 	else
 	{
 		self.touch = SAVABLE(trigger_push_touch);
 		self.think = SAVABLE(trigger_push_active);
-		self.nextthink = level.time + 1_hz;
-		self.delay = self.nextthink + self.wait;  
+		self.set_nextthink(level.time + 1_hz);
+		self.delay = self.get_nextthink() + self.wait;  
 	}
 }
 
@@ -502,15 +502,15 @@ static void trigger_push_active(entity &self)
 {
 	if (self.delay > level.time)
 	{
-		self.nextthink = level.time + 1_hz;
+		self.set_nextthink(level.time + 1_hz);
 		trigger_effect (self);
 	}
 	else
 	{
 		self.touch = nullptr;
 		self.think = SAVABLE(trigger_push_inactive);
-		self.nextthink = level.time + 1_hz;
-		self.delay = self.nextthink + self.wait;  
+		self.set_nextthink(level.time + 1_hz);
+		self.delay = self.get_nextthink() + self.wait;  
 	}
 }
 #endif
@@ -543,8 +543,8 @@ static void SP_trigger_push(entity &self)
 			self.wait = 10s;
   
 		self.think = SAVABLE(trigger_push_active);
-		self.nextthink = level.time + 1_hz;
-		self.delay = self.nextthink + self.wait;
+		self.set_nextthink(level.time + 1_hz);
+		self.delay = self.get_nextthink() + self.wait;
 	}
 #endif
 	
@@ -1,12 +1,15 @@
 #include "config.h"
 #include "util.h"
 #include "lib/types/dynarray.h"
+#include "lib/types/map.h"
 #include "combat.h"
 #include "lib/math/random.h"
 #include "lib/gi.h"
 #include "game.h"
 #include "game/func.h"
 #include "game/misc.h"
+#include "game/profile.h"
+#include "game/think.h"
 
 void G_InitEdict(entity &e)
 {
@@ -15,48 +18,230 @@ void G_InitEdict(entity &e)
 
 	e.__init();
 	e.inuse = true;
+	G_AddLiveEntity(e);
 	e.gravity = 1.0f;
 #ifdef ROGUE_AI
 	e.gravityVector = MOVEDIR_DOWN;
 #endif
 }
 
-entity &G_Spawn()
+// freed entity slots waiting to be re-used, as a ring buffer.
+// level.time never goes backwards, so pushing to the back keeps
+// this sorted by freeframenum and the front is always the slot
+// that has been free the longest.
+static array<uint32_t, MAX_EDICTS>	free_slots;
+static size_t						free_head;
+static free_list_stats				free_stats;
+
+static void G_PushFreeSlot(const entity &e)
+{
+	free_slots[(free_head + free_stats.depth) % free_slots.size()] = (uint32_t) etoi(e);
+	free_stats.depth++;
+}
+
+static entityref G_PopFreeSlot()
+{
+	while (free_stats.depth)
+	{
+		entity &e = itoe(free_slots[free_head]);
+
+		free_head = (free_head + 1) % free_slots.size();
+		free_stats.depth--;
+
+		// slot was claimed without going through G_Spawn
+		if (e.inuse)
+			continue;
+
+		return e;
+	}
+
+	return null_entity;
+}
+
+void G_ClearFreeList()
+{
+	free_head = 0;
+	free_stats = {};
+}
+
+void G_RebuildFreeList()
 {
-	// fatal if we ever hit this point
-	if (num_entities == max_entities)
-		gi.errorfmt("{}: reached max entity slots", __func__);
+	G_ClearFreeList();
 
-	// guaranteed to have a free entity at the end, but
-	// let's try to re-use IDs first
-	entityref best;
-	// the first couple seconds of server time can involve a lot of
-	// freeing and allocating
-	const bool quick_replace = level.time < 100ms;
+	dynarray<entityref> slots;
 
 	for (entity &e : entity_range(game.maxclients + 1, num_entities - 1))
+		if (!e.inuse)
+			slots.push_back(e);
+
+	std::stable_sort(slots.begin(), slots.end(), [](const entityref &a, const entityref &b) { return a->freeframenum < b->freeframenum; });
+
+	for (entity &e : slots)
+		G_PushFreeSlot(e);
+}
+
+const free_list_stats &G_FreeListStats()
+{
+	return free_stats;
+}
+
+static dynarray<uint32_t> live_list;
+const dynarray<uint32_t> &live_entities = live_list;
+static array<uint32_t, MAX_EDICTS> spawn_ids;
+
+void G_AddLiveEntity(entity &e)
+{
+	const uint32_t number = (uint32_t) etoi(e);
+	auto it = std::lower_bound(live_list.begin(), live_list.end(), number);
+
+	if (it == live_list.end() || *it != number)
 	{
+		live_list.insert(it, number);
+		spawn_ids[number]++;
+	}
+
+	G_UpdateIdle(e);
+}
+
+void G_RemoveLiveEntity(entity &e)
+{
+	const uint32_t number = (uint32_t) etoi(e);
+	auto it = std::lower_bound(live_list.begin(), live_list.end(), number);
+
+	if (it != live_list.end() && *it == number)
+		live_list.erase(it);
+
+	G_UpdateIdle(e);
+}
+
+uint32_t G_SpawnId(const entity &e)
+{
+	return spawn_ids[etoi(e)];
+}
+
+void G_ClearLiveList()
+{
+	live_list.clear();
+}
+
+void G_RebuildLiveList()
+{
+	G_ClearLiveList();
+
+	for (entity &e : entity_range(0, num_entities - 1))
 		if (e.inuse)
-			continue;
+			live_list.push_back((uint32_t) etoi(e));
+}
 
-		// if this is a really good entity, mark it down immediately
-		if (quick_replace || (level.time - e.freeframenum) > 500ms)
-		{
-			best = e;
-			break;
-		}
-		// otherwise we may have no choice but to re-use the first free one we come across
-		else if (!best.has_value())
-			best = e;
+entity &G_Spawn()
+{
+	// try to re-use IDs first; even if the oldest free slot was freed
+	// recently, re-using it is still better than growing the list.
+	entityref best = G_PopFreeSlot();
+
+	if (best.has_value())
+	{
+		const gtime age = level.time - best->freeframenum;
+
+		free_stats.reused++;
+		free_stats.last_age = age;
+		free_stats.total_age += age;
+
+		// the first couple seconds of server time can involve a lot of
+		// freeing and allocating, so these don't count
+		if (level.time >= 100ms && age <= 500ms)
+			free_stats.early++;
 	}
+	else
+	{
+		// fatal if we ever hit this point
+		if (num_entities == max_entities)
+			gi.errorfmt("{}: reached max entity slots", __func__);
 
-	if (!best.has_value())
 		best = itoe(num_entities++);
+		free_stats.appended++;
+	}
 
 	G_InitEdict(best);
 	return best;
 }
 
+// numbers of the entities with each targetname, sorted
+static map<atom, dynarray<uint32_t>> targetname_index;
+
+static void G_IndexTargetname(entity &e)
+{
+	if (!e.targetname)
+		return;
+
+	dynarray<uint32_t> &list = targetname_index[e.targetname];
+	const uint32_t number = (uint32_t) etoi(e);
+
+	list.insert(std::lower_bound(list.begin(), list.end(), number), number);
+}
+
+static void G_UnindexTargetname(entity &e)
+{
+	if (!e.targetname)
+		return;
+
+	auto it = targetname_index.find(e.targetname);
+
+	if (it == targetname_index.end())
+		return;
+
+	dynarray<uint32_t> &list = it->second;
+	auto num = std::lower_bound(list.begin(), list.end(), (uint32_t) etoi(e));
+
+	if (num != list.end() && *num == etoi(e))
+		list.erase(num);
+
+	if (list.empty())
+		targetname_index.erase(it);
+}
+
+// numbers of the entities of each type, and of all its subtypes, sorted
+static map<const entity_type *, dynarray<uint32_t>> type_index;
+
+static void G_IndexType(entity &e)
+{
+	if (!e.type)
+		return;
+
+	const uint32_t number = (uint32_t) etoi(e);
+
+	for (const entity_type *type = e.type.type; type; type = type->parent)
+	{
+		dynarray<uint32_t> &list = type_index[type];
+		list.insert(std::lower_bound(list.begin(), list.end(), number), number);
+	}
+}
+
+static void G_UnindexType(entity &e)
+{
+	if (!e.type)
+		return;
+
+	const uint32_t number = (uint32_t) etoi(e);
+
+	for (const entity_type *type = e.type.type; type; type = type->parent)
+	{
+		auto it = type_index.find(type);
+
+		if (it == type_index.end())
+			continue;
+
+		dynarray<uint32_t> &list = it->second;
+		auto num = std::lower_bound(list.begin(), list.end(), number);
+
+		if (num != list.end() && *num == number)
+			list.erase(num);
+
+		if (list.empty())
+			type_index.erase(it);
+	}
+}
+
 void G_FreeEdict(entity &e)
 {
 	if (!e.inuse)
@@ -65,16 +250,110 @@ void G_FreeEdict(entity &e)
 		throw bad_entity_operation("entity is reserved; cannot free");
 
 	gi.unlinkentity(e);        // unlink from world
+	G_UnindexTargetname(e);
+	G_UnindexType(e);
+	e.set_nextthink(gtime::zero());
 
 	e.__free();
 	e.inuse = false;
+	G_RemoveLiveEntity(e);
 	e.type = ET_UNKNOWN;
 	e.freeframenum = level.time;
+
+	G_PushFreeSlot(e);
 }
 
 REGISTER_SAVABLE(G_FreeEdict);
 
-entityref G_PickTarget(const stringref &stargetname)
+void G_SetType(entity &e, const entity_type &type)
+{
+	G_UnindexType(e);
+	e.type = type;
+	G_IndexType(e);
+}
+
+void G_ClearTypes()
+{
+	type_index.clear();
+}
+
+void G_RebuildTypes()
+{
+	G_ClearTypes();
+
+	for (entity &e : G_IterateLive())
+		G_IndexType(e);
+}
+
+entityref G_FindType(entityref from, const entity_type &type)
+{
+	auto it = type_index.find(&type);
+
+	if (it == type_index.end())
+		return null_entity;
+
+	// same starting rules as G_Find
+	const uint32_t start = (!from.has_value() || etoi(from) <= game.maxclients) ? (game.maxclients + 1) : (uint32_t) (etoi(from) + 1);
+	const dynarray<uint32_t> &list = it->second;
+
+	for (auto num = std::lower_bound(list.begin(), list.end(), start); num != list.end(); num++)
+	{
+		entity &e = itoe(*num);
+
+		if (e.inuse)
+			return e;
+	}
+
+	return null_entity;
+}
+
+void G_SetTargetname(entity &e, atom targetname)
+{
+	G_UnindexTargetname(e);
+	e.targetname = targetname;
+	G_IndexTargetname(e);
+}
+
+void G_ClearTargetnames()
+{
+	targetname_index.clear();
+}
+
+void G_RebuildTargetnames()
+{
+	G_ClearTargetnames();
+
+	for (entity &e : entity_range(0, num_entities - 1))
+		if (e.inuse)
+			G_IndexTargetname(e);
+}
+
+entityref G_FindTargetname(entityref from, atom targetname)
+{
+	if (!targetname)
+		return null_entity;
+
+	auto it = targetname_index.find(targetname);
+
+	if (it == targetname_index.end())
+		return null_entity;
+
+	// same starting rules as G_Find
+	const uint32_t start = (!from.has_value() || etoi(from) <= game.maxclients) ? (game.maxclients + 1) : (uint32_t) (etoi(from) + 1);
+	const dynarray<uint32_t> &list = it->second;
+
+	for (auto num = std::lower_bound(list.begin(), list.end(), start); num != list.end(); num++)
+	{
+		entity &e = itoe(*num);
+
+		if (e.inuse)
+			return e;
+	}
+
+	return null_entity;
+}
+
+entityref G_PickTarget(atom stargetname)
 {
 	if (!stargetname)
 	{
@@ -84,7 +363,7 @@ entityref G_PickTarget(const stringref &stargetname)
 
 	dynarray<entityref>	choice;
 
-	for (auto &ent : G_IterateFunc<&entity::targetname>(stargetname, striequals))
+	for (auto &ent : G_IterateTargetname(stargetname))
 		choice.push_back(ent);
 
 	if (!choice.size())
@@ -113,7 +392,7 @@ void G_UseTargets(entity &ent, entity &cactivator)
 	{
 		// create a temp object to fire at a later time
 		entity &t = G_Spawn();
-		t.nextthink = duration_cast<gtime>(level.time + ent.delay);
+		t.set_nextthink(duration_cast<gtime>(level.time + ent.delay));
 		t.think = SAVABLE(Think_Delay);
 		t.activator = cactivator;
 		t.message = ent.message;
@@ -140,7 +419,7 @@ void G_UseTargets(entity &ent, entity &cactivator)
 	//
 	if (ent.killtarget)
 	{
-		for (entity &t : G_IterateFunc<&entity::targetname>(ent.killtarget, striequals))
+		for (entity &t : G_IterateTargetname(ent.killtarget))
 		{
 #ifdef GROUND_ZERO
 			// PMM - if this entity is part of a train, cleanly remove it
@@ -172,7 +451,7 @@ void G_UseTargets(entity &ent, entity &cactivator)
 	//
 	if (ent.target)
 	{
-		for (entity &t : G_IterateFunc<&entity::targetname>(ent.target, striequals))
+		for (entity &t : G_IterateTargetname(ent.target))
 		{
 			// doors fire area portals in a specific way
 			if (t.type == ET_FUNC_AREAPORTAL &&
@@ -261,7 +540,7 @@ void G_TouchTriggers(entity &ent)
 	if ((ent.is_client || (ent.svflags & SVF_MONSTER)) && (ent.health <= 0))
 		return;
 
-	dynarray<entityref> touches = gi.BoxEdicts(ent.absbounds, AREA_TRIGGERS);
+	std::span<entityref> touches = gi.BoxEdicts(ent.absbounds, AREA_TRIGGERS);
 
 	// be careful, it is possible to have an entity in this
 	// list removed before we get to it (killtriggered)
@@ -271,6 +550,8 @@ void G_TouchTriggers(entity &ent)
 			continue;
 		if (!hit.touch)
 			continue;
+
+		profile_scope scope(hit.touch, PROFILE_TOUCH);
 		hit.touch(hit, ent, vec3_origin, null_surface);
 	}
 }
@@ -5,6 +5,7 @@
 #include "game.h"
 #include "entity.h"
 #include "savables.h"
+#include "spatial.h"
 
 constexpr vector MOVEDIR_UP		= { 0, 0, 1 };
 constexpr vector MOVEDIR_DOWN	= { 0, 0, -1 };
@@ -53,6 +54,114 @@ void G_FreeEdict(entity &e);
 
 DECLARE_SAVABLE(G_FreeEdict);
 
+// counters for the free entity slot list, shown by "sv mem"
+struct free_list_stats
+{
+	// free slots waiting to be re-used
+	size_t	depth;
+	// spawns that re-used a free slot
+	size_t	reused;
+	// spawns that had to grow num_entities
+	size_t	appended;
+	// re-used slots that had been free for 500ms or less
+	size_t	early;
+	// how long re-used slots had been free for
+	gtime	last_age, total_age;
+};
+
+// empty the free slot list; called whenever the entity list is wiped.
+void G_ClearFreeList();
+
+// rebuild the free slot list from the current entity list,
+// after it has been loaded from a save.
+void G_RebuildFreeList();
+
+const free_list_stats &G_FreeListStats();
+
+// numbers of every entity that is in use, sorted. G_InitEdict and
+// G_FreeEdict keep this up to date; code that flips inuse on its own
+// has to call G_AddLiveEntity/G_RemoveLiveEntity to match.
+extern const dynarray<uint32_t> &live_entities;
+
+void G_AddLiveEntity(entity &e);
+
+void G_RemoveLiveEntity(entity &e);
+
+// empty the live list; called whenever the entity list is wiped.
+void G_ClearLiveList();
+
+// rebuild the live list from the inuse flags, after a load.
+void G_RebuildLiveList();
+
+// changes every time the entity's slot is put in use, so that code that
+// holds on to an entity number can tell if it's been freed and re-used
+uint32_t G_SpawnId(const entity &e);
+
+struct live_entity_sentinel { };
+
+struct live_entity_iterator
+{
+	// our place in live_entities, and the entity that was there
+	size_t		index;
+	uint32_t	number;
+
+	live_entity_iterator(uint32_t first) :
+		index(std::lower_bound(live_entities.begin(), live_entities.end(), first) - live_entities.begin()),
+		number(index < live_entities.size() ? live_entities[index] : 0)
+	{
+	}
+
+	using difference_type = ptrdiff_t;
+	using value_type = entity;
+	using pointer = entity *;
+	using reference = entity &;
+	using iterator_category = std::forward_iterator_tag;
+
+	entity &operator*() const { return itoe(number); }
+	entity *operator->() const { return &itoe(number); }
+
+	live_entity_iterator &operator++()
+	{
+		// entities spawned or freed during the loop shift the list
+		// around, so find our place again if they did
+		if (index < live_entities.size() && live_entities[index] == number)
+			index++;
+		else
+			index = std::upper_bound(live_entities.begin(), live_entities.end(), number) - live_entities.begin();
+
+		if (index < live_entities.size())
+			number = live_entities[index];
+
+		return *this;
+	}
+
+	bool operator==(const live_entity_sentinel &) const { return index >= live_entities.size(); }
+};
+
+struct live_entity_container
+{
+	uint32_t	first;
+
+	live_entity_iterator begin() const { return live_entity_iterator(first); }
+	live_entity_sentinel end() const { return { }; }
+};
+
+/*
+=================
+G_IterateLive
+
+Iterate every entity in use with a number of at least first, in
+number order. This visits the same entities as walking every slot up
+to num_entities and checking inuse: ones spawned during the loop are
+picked up if they come after the current one, and freed ones are
+skipped.
+=================
+*/
+inline live_entity_container G_IterateLive(uint32_t first = 0)
+{
+	return { first };
+}
+
 constexpr vector G_ProjectSource(vector point, vector distance, vector forward, vector right, vector up = { 0, 0, 1 })
 {
 	return point + (forward * distance.x) + (right * distance.y) + (up * distance.z);
@@ -130,6 +239,36 @@ struct entity_chain_container
 	entity_chain_sentinel end() { return { }; }
 };
 
+/*
+=============
+G_SetType
+
+Change an entity's type. Always use this instead of assigning to type
+directly, so that the type index stays current. An entity is indexed
+under its type and every parent of it, so a lookup for a type finds
+the subtypes too, the same as entity_type's operator== does.
+=============
+*/
+void G_SetType(entity &e, const entity_type &type);
+
+// empty the type index; called whenever the entity list is wiped.
+void G_ClearTypes();
+
+// rebuild the type index from the current entity list,
+// after it has been loaded from a save.
+void G_RebuildTypes();
+
+/*
+=============
+G_FindType
+
+Same as G_FindEquals<&entity::type>(from, type), but only visits
+entities of that type; G_FindEquals and G_IterateEquals on type go
+through this. ET_UNKNOWN isn't indexed, so it gets the full scan.
+=============
+*/
+entityref G_FindType(entityref from, const entity_type &type);
+
 template<typename T, typename C>
 using is_entity_matcher = std::is_invocable_r<bool, C, entity &, const T &>;
 
@@ -150,14 +289,11 @@ from is null/world/a client. null_entity will be returned if the end of the list
 template<typename T, typename C> requires is_entity_matcher_v<T, C>
 inline entityref G_Find(entityref from, const T &match, C matcher)
 {
-	if (!from.has_value() || etoi(from) <= game.maxclients)
-		from = itoe(game.maxclients + 1);
-	else
-		from = next_ent(from);
+	const uint32_t first = (!from.has_value() || etoi(from) <= game.maxclients) ? (game.maxclients + 1) : (uint32_t) (etoi(from) + 1);
 
-	for (; etoi(from) < num_entities; from = next_ent(from))
-		if (from->inuse && matcher(from, match))
-			return from;
+	for (entity &e : G_IterateLive(first))
+		if (matcher(e, match))
+			return e;
 
 	return null_entity;
 }
@@ -188,6 +324,10 @@ inline auto G_IterateFunc(const field &match, bool (*matcher)(const field &a, co
 template<auto member, typename field = entity_field_type<member>>
 inline entityref G_FindEquals(entityref from, const field &match)
 {
+	if constexpr (std::is_same_v<field, entity_type_ref>)
+		if (match)
+			return G_FindType(from, match);
+
 	return G_Find<field>(from, match, [](const entity &e, const field &m) { return e.*member == m; });
 }
 
@@ -210,35 +350,72 @@ inline auto G_IterateChain(entityref start)
 =================
 G_IterateRadius
 
-Iterate entities that have origins within a spherical area
+Iterate entities that have origins within a spherical area.
+
+Candidates come from the spatial grid, so only linked entities are
+found; a solid entity that is in use but has never been linked, or
+is currently unlinked, is skipped. The iterator must not be kept
+past the end of the frame.
 =================
 */
 inline auto G_IterateRadius(vector org, float rad)
 {
-	return entity_chain_container([org, rad] (entityref e) {
+	return entity_chain_container([org, rad, candidates = G_SpatialQuery(org, rad)] (entityref e) -> entityref {
 
-		if (!e.has_value())
-			e = itoe(1);
-		else
-			e = next_ent(e);
+		// candidates are sorted, so pick up after the last one returned
+		auto it = e.has_value() ? std::upper_bound(candidates.begin(), candidates.end(), (uint32_t) etoi(e)) : candidates.begin();
 
-		for (; etoi(e) < num_entities; e = next_ent(e))
+		for (; it != candidates.end(); it++)
 		{
-			if (e->solid == SOLID_NOT)
+			entity &ent = itoe(*it);
+
+			if (ent.solid == SOLID_NOT)
 				continue;
 
-			vector eorg = org - (e->origin + e->bounds.center());
+			vector eorg = org - (ent.origin + ent.bounds.center());
 
 			if (VectorLength(eorg) > rad)
 				continue;
 
-			return e;
+			return ent;
 		}
 
 		return null_entity;
 	});
 }
 
+/*
+=============
+G_SetTargetname
+
+Change an entity's targetname. Always use this instead of assigning
+to targetname directly, so that the targetname index stays current.
+=============
+*/
+void G_SetTargetname(entity &e, atom targetname);
+
+// empty the targetname index; called whenever the entity list is wiped.
+void G_ClearTargetnames();
+
+// rebuild the targetname index from the current entity list,
+// after it has been loaded from a save.
+void G_RebuildTargetnames();
+
+/*
+=============
+G_FindTargetname
+
+Same as G_FindEquals<&entity::targetname>(from, targetname),
+but only visits entities that have this targetname.
+=============
+*/
+entityref G_FindTargetname(entityref from, atom targetname);
+
+inline auto G_IterateTargetname(atom targetname)
+{
+	return entity_chain_container([targetname] (entityref e) { return G_FindTargetname(e, targetname); });
+}
+
 /*
 =============
 G_PickTarget
@@ -246,7 +423,7 @@ G_PickTarget
 Pick a random entity that matches the specified targetname.
 =============
 */
-entityref G_PickTarget(const stringref &stargetname);
+entityref G_PickTarget(atom stargetname);
 
 /*
 ==============================
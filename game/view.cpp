@@ -27,7 +27,7 @@ static inline void P_WorldEffects(entity &current_player)
 	bool	envirosuit;
 	int32_t	current_waterlevel, old_waterlevel;
 
-	if (current_player.movetype == MOVETYPE_NOCLIP)
+	if (current_player.get_movetype() == MOVETYPE_NOCLIP)
 	{
 		current_player.air_finished_time = level.time + 12s; // don't need air
 		return;
@@ -221,7 +221,7 @@ static inline void P_FallingDamage(entity &ent)
 	if (ent.modelindex != MODEL_PLAYER)
 		return;     // not in the player model
 
-	if (ent.movetype == MOVETYPE_NOCLIP)
+	if (ent.get_movetype() == MOVETYPE_NOCLIP)
 		return;
 
 	if ((ent.client.oldvelocity[2] < 0.f) && (ent.velocity[2] > ent.client.oldvelocity[2]) && !ent.groundentity.has_value())
@@ -6,6 +6,7 @@
 #include "game/weaponry/handgrenade.h"
 #include "game/player_frames.h"
 #include "weaponry.h"
+#include "ai.h"
 
 #ifdef THE_RECKONING
 #include "game/xatrix/weaponry/trap.h"
@@ -80,7 +81,7 @@ void PlayerNoise(entity &who, vector where, player_noise type)
 	{
 		{
 			entity &noise = G_Spawn();
-			noise.type = ET_PLAYER_NOISE;
+			G_SetType(noise, ET_PLAYER_NOISE);
 			noise.bounds = bbox::sized(8.f);
 			noise.owner = who;
 			noise.svflags = SVF_NOCLIENT;
@@ -89,7 +90,7 @@ void PlayerNoise(entity &who, vector where, player_noise type)
 
 		{
 			entity &noise = G_Spawn();
-			noise.type = ET_PLAYER_NOISE;
+			G_SetType(noise, ET_PLAYER_NOISE);
 			noise.bounds = bbox::sized(8.f);
 			noise.owner = who;
 			noise.svflags = SVF_NOCLIENT;
@@ -116,6 +117,8 @@ void PlayerNoise(entity &who, vector where, player_noise type)
 	noise->absbounds = noise->bounds.offsetted(where);
 	noise->last_sound_time = level.time;
 	gi.linkentity(noise);
+
+	AI_WakeDormant(where);
 }
 #endif
 
@@ -160,7 +163,7 @@ void ChangeWeapon(entity &ent)
 
 	ent.client.weaponstate = WEAPON_ACTIVATING;
 	ent.client.ps.gunframe = 0;
-	ent.client.ps.gunindex = gi.modelindex(ent.client.pers.weapon->view_model);
+	ent.client.ps.gunindex = ent.client.pers.weapon->get_view_model();
 
 	ent.client.anim_priority = ANIM_PAIN;
 	if (ent.client.ps.pmove.pm_flags & PMF_DUCKED)
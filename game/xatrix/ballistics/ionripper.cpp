@@ -55,7 +55,7 @@ void fire_ionripper(entity &self, vector start, vector dir, int32_t damage, int3
 	ion.angles = vectoangles(dir);
 	ion.velocity = dir * speed;
 
-	ion.movetype = MOVETYPE_WALLBOUNCE;
+	ion.set_movetype(MOVETYPE_WALLBOUNCE);
 	ion.clipmask = MASK_SHOT;
 	ion.solid = SOLID_BBOX;
 	ion.effects |= effect;
@@ -66,7 +66,7 @@ void fire_ionripper(entity &self, vector start, vector dir, int32_t damage, int3
 	ion.sound = gi.soundindex("misc/lasfly.wav");
 	ion.owner = self;
 	ion.touch = SAVABLE(ionripper_touch);
-	ion.nextthink = level.time + 3s;
+	ion.set_nextthink(level.time + 3s);
 	ion.think = SAVABLE(ionripper_sparks);
 	ion.dmg = damage;
 	ion.dmg_radius = 100.f;
@@ -50,13 +50,13 @@ void fire_plasma(entity &self, vector start, vector dir, int32_t damage, int32_t
 	plasma.movedir = dir;
 	plasma.angles = vectoangles(dir);
 	plasma.velocity = dir * speed;
-	plasma.movetype = MOVETYPE_FLYMISSILE;
+	plasma.set_movetype(MOVETYPE_FLYMISSILE);
 	plasma.clipmask = MASK_SHOT;
 	plasma.solid = SOLID_BBOX;
 
 	plasma.owner = self;
 	plasma.touch = SAVABLE(plasma_touch);
-	plasma.nextthink = level.time + seconds(8000 / speed);
+	plasma.set_nextthink(level.time + seconds(8000 / speed));
 	plasma.think = SAVABLE(G_FreeEdict);
 	plasma.dmg = damage;
 	plasma.radius_dmg = radius_damage;
@@ -35,7 +35,7 @@ static void Trap_Gib_Think(entity &ent)
 
 	gi.linkentity(ent);
 
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(Trap_Gib_Think);
@@ -48,7 +48,7 @@ static void Trap_Think(entity &ent)
 		return;
 	}
 
-	ent.nextthink = level.time + 100ms;
+	ent.set_nextthink(level.time + 100ms);
 
 	if (ent.groundentity == null_entity)
 		return;
@@ -87,12 +87,13 @@ static void Trap_Think(entity &ent)
 
 					best.dmg_radius = (360.0f / 3) * i;
 					best.think = SAVABLE(Trap_Gib_Think);
-					best.nextthink = level.time + 1_hz;
+					best.set_nextthink(level.time + 1_hz);
 					best.angles = ent.angles;
 					best.solid = SOLID_NOT;
 					best.takedamage = true;
-					best.movetype = MOVETYPE_NONE;
+					best.set_movetype(MOVETYPE_NONE);
 					best.svflags |= SVF_MONSTER;
+					best.monsterinfo.emplace();
 					best.deadflag = true;
 					best.owner = ent;
 					best.watertype = gi.pointcontents(best.origin);
@@ -114,7 +115,7 @@ static void Trap_Think(entity &ent)
 		ent.frame++;
 		if (ent.frame == 8)
 		{
-			ent.nextthink = level.time + 1s;
+			ent.set_nextthink(level.time + 1s);
 			ent.think = SAVABLE(G_FreeEdict);
 
 			entity &best = G_Spawn();
@@ -238,7 +239,7 @@ void fire_trap(entity &self, vector start, vector aimdir, int32_t speed, bool he
 	trap.velocity += random(190.f, 210.f) * up;
 	trap.velocity += crandom(10.f) * right;
 	trap.avelocity = { 0, 300, 0 };
-	trap.movetype = MOVETYPE_BOUNCE;
+	trap.set_movetype(MOVETYPE_BOUNCE);
 	trap.clipmask = MASK_SHOT;
 	trap.solid = SOLID_BBOX;
 	trap.bounds = {
@@ -247,9 +248,9 @@ void fire_trap(entity &self, vector start, vector aimdir, int32_t speed, bool he
 	};
 	trap.modelindex = gi.modelindex("models/weapons/z_trap/tris.md2");
 	trap.owner = self;
-	trap.nextthink = level.time + 1s;
+	trap.set_nextthink(level.time + 1s);
 	trap.think = SAVABLE(Trap_Think);
-	trap.type = ET_GRENADE;
+	G_SetType(trap, ET_GRENADE);
 	trap.sound = gi.soundindex("weapons/traploop.wav");
 	if (held)
 		trap.spawnflags = (spawn_flag) 3;
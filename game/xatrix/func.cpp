@@ -25,12 +25,12 @@ static void rotating_light_alarm(entity &self)
 	if (self.spawnflags & START_OFF)
 	{
 		self.think = nullptr;
-		self.nextthink = gtime::zero();	
+		self.set_nextthink(gtime::zero());	
 	}
 	else
 	{
-		gi.sound (self, CHAN_NO_PHS_ADD | CHAN_VOICE, self.moveinfo.sound_start, ATTN_STATIC);
-		self.nextthink = level.time + 1s;
+		gi.sound (self, CHAN_NO_PHS_ADD | CHAN_VOICE, self.moveinfo->sound_start, ATTN_STATIC);
+		self.set_nextthink(level.time + 1s);
 	}
 }
 
@@ -44,7 +44,7 @@ static void rotating_light_killed(entity &self, entity &, entity &, int32_t, vec
 	self.use = nullptr;
 
 	self.think = SAVABLE(G_FreeEdict);	
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 }
 
 REGISTER_STATIC_SAVABLE(rotating_light_killed);
@@ -59,7 +59,7 @@ static void rotating_light_use(entity &self, entity &, entity &)
 		if (self.spawnflags & 2)
 		{
 			self.think = SAVABLE(rotating_light_alarm);
-			self.nextthink = level.time + 1_hz;
+			self.set_nextthink(level.time + 1_hz);
 		}
 	}
 	else
@@ -73,7 +73,7 @@ REGISTER_STATIC_SAVABLE(rotating_light_use);
 
 static void SP_rotating_light(entity &self)
 {
-	self.movetype = MOVETYPE_STOP;
+	self.set_movetype(MOVETYPE_STOP);
 	self.solid = SOLID_BBOX;
 	
 	self.modelindex = gi.modelindex ("models/objects/light/tris.md2");
@@ -107,9 +107,11 @@ static void SP_rotating_light(entity &self)
 		self.takedamage = true;
 	}
 	
+	self.moveinfo.emplace();
+
 	if (self.spawnflags & 2)
 	{
-		self.moveinfo.sound_start = gi.soundindex ("misc/alarm.wav");	
+		self.moveinfo->sound_start = gi.soundindex ("misc/alarm.wav");	
 	}
 	
 	gi.linkentity (self);
@@ -125,7 +127,7 @@ The default delay is 1 second
 */
 static void object_repair_fx(entity &ent)
 {
-	ent.nextthink = duration_cast<gtime>(level.time + ent.delay);
+	ent.set_nextthink(duration_cast<gtime>(level.time + ent.delay));
 
 	if (ent.health <= 100)
 		ent.health++;
@@ -138,7 +140,7 @@ REGISTER_STATIC_SAVABLE(object_repair_fx);
 static void object_repair_dead(entity &ent)
 {
 	G_UseTargets (ent, ent);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.think = SAVABLE(object_repair_fx);
 }
 
@@ -148,12 +150,12 @@ static void object_repair_sparks(entity &ent)
 {
 	if (ent.health < 0)
 	{
-		ent.nextthink = level.time + 1_hz;
+		ent.set_nextthink(level.time + 1_hz);
 		ent.think = SAVABLE(object_repair_dead);
 		return;
 	}
 
-	ent.nextthink = duration_cast<gtime>(level.time + ent.delay);
+	ent.set_nextthink(duration_cast<gtime>(level.time + ent.delay));
 	
 	gi.ConstructMessage(svc_temp_entity, TE_WELDING_SPARKS, uint8_t { 10 }, ent.origin, vecdir { vec3_origin }, uint8_t { 0xe0 + (Q_rand()&7) }).multicast (ent.origin, MULTICAST_PVS);
 }
@@ -162,11 +164,11 @@ REGISTER_STATIC_SAVABLE(object_repair_sparks);
 
 static void SP_func_object_repair(entity &ent)
 {
-	ent.movetype = MOVETYPE_NONE;
+	ent.set_movetype(MOVETYPE_NONE);
 	ent.solid = SOLID_BBOX;
 	ent.bounds = bbox::sized(8.f);
 	ent.think = SAVABLE(object_repair_sparks);
-	ent.nextthink = level.time + 1s;
+	ent.set_nextthink(level.time + 1s);
 	ent.health = 100;
 
 	if (ent.delay == gtimef::zero())
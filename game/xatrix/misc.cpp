@@ -5,6 +5,7 @@
 #include "game/misc.h"
 #include "game/spawn.h"
 #include "game/game.h"
+#include "game/util.h"
 #include "lib/string/format.h"
 #include "misc.h"
 
@@ -52,7 +53,7 @@ static void SP_misc_crashviper(entity &ent)
 	if (!ent.speed)
 		ent.speed = 300.f;
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_NOT;
 	ent.modelindex = gi.modelindex ("models/ships/bigviper/tris.md2");
 	ent.bounds = {
@@ -61,10 +62,11 @@ static void SP_misc_crashviper(entity &ent)
 	};
 
 	ent.think = SAVABLE(func_train_find);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.use = SAVABLE(misc_viper_use);
 	ent.svflags |= SVF_NOCLIENT;
-	ent.moveinfo.accel = ent.moveinfo.decel = ent.moveinfo.speed = ent.speed;
+	ent.moveinfo.emplace();
+	ent.moveinfo->accel = ent.moveinfo->decel = ent.moveinfo->speed = ent.speed;
 
 	gi.linkentity (ent);
 }
@@ -73,7 +75,6 @@ static REGISTER_ENTITY(MISC_CRASHVIPER, misc_crashviper);
 
 #ifdef SINGLE_PLAYER
 #include "game/combat.h"
-#include "game/util.h"
 
 // RAFAEL
 /*QUAKED misc_viper_missile (1 0 0) (-8 -8 -8) (8 8 8)
@@ -81,7 +82,7 @@ static REGISTER_ENTITY(MISC_CRASHVIPER, misc_crashviper);
 */
 static void misc_viper_missile_use(entity &self, entity &, entity &)
 {
-	self.enemy = G_FindEquals<&entity::targetname>(world, self.target);
+	self.enemy = G_FindTargetname(world, self.target);
 	
 	vector vec = self.enemy->origin;
 	vec[2] += 16;	// Knightmare fixed
@@ -92,7 +93,7 @@ static void misc_viper_missile_use(entity &self, entity &, entity &)
 	
 	monster_fire_rocket (self, start, dir, self.dmg, 500, MZ2_CHICK_ROCKET_1);
 	
-	self.nextthink = level.time + 1_hz;
+	self.set_nextthink(level.time + 1_hz);
 	self.think = SAVABLE(G_FreeEdict);
 }
 
@@ -100,7 +101,7 @@ REGISTER_STATIC_SAVABLE(misc_viper_missile_use);
 
 static void SP_misc_viper_missile(entity &self)
 {
-	self.movetype = MOVETYPE_NONE;
+	self.set_movetype(MOVETYPE_NONE);
 	self.solid = SOLID_NOT;
 	self.bounds = bbox::sized(8.f);
 
@@ -134,7 +135,7 @@ static void SP_misc_transport(entity &ent)
 	if (!ent.speed)
 		ent.speed = 300.f;
 
-	ent.movetype = MOVETYPE_PUSH;
+	ent.set_movetype(MOVETYPE_PUSH);
 	ent.solid = SOLID_NOT;
 	ent.modelindex = gi.modelindex ("models/objects/ship/tris.md2");
 
@@ -144,10 +145,11 @@ static void SP_misc_transport(entity &ent)
 	};
 
 	ent.think = SAVABLE(func_train_find);
-	ent.nextthink = level.time + 1_hz;
+	ent.set_nextthink(level.time + 1_hz);
 	ent.use = SAVABLE(misc_strogg_ship_use);
 	ent.svflags |= SVF_NOCLIENT;
-	ent.moveinfo.accel = ent.moveinfo.decel = ent.moveinfo.speed = ent.speed;
+	ent.moveinfo.emplace();
+	ent.moveinfo->accel = ent.moveinfo->decel = ent.moveinfo->speed = ent.speed;
 
 	if (!(ent.spawnflags & TRAIN_START_ON))
 		ent.spawnflags |= TRAIN_START_ON;
@@ -164,7 +166,7 @@ static sound_index amb4sound;
 
 static void amb4_think(entity &ent)
 {
-	ent.nextthink = duration_cast<gtime>(level.time + 2.7s);
+	ent.set_nextthink(duration_cast<gtime>(level.time + 2.7s));
 	gi.sound(ent, CHAN_VOICE, amb4sound, ATTN_NONE);
 }
 
@@ -173,7 +175,7 @@ REGISTER_STATIC_SAVABLE(amb4_think);
 static void SP_misc_amb4(entity &ent)
 {
 	ent.think = SAVABLE(amb4_think);
-	ent.nextthink = level.time + 1s;
+	ent.set_nextthink(level.time + 1s);
 	amb4sound = gi.soundindex ("world/amb4.wav");
 	gi.linkentity (ent);
 }
@@ -36,13 +36,13 @@ static entityref fixbot_FindDeadMonster(entity &self)
 			continue;
 		if (!(ent.svflags & SVF_MONSTER))
 			continue;
-		if (ent.monsterinfo.aiflags & AI_GOOD_GUY)
+		if (std::as_const(ent.monsterinfo)->aiflags & AI_GOOD_GUY)
 			continue;
 		if (ent.owner.has_value())
 			continue;
 		if (ent.health > 0)
 			continue;
-		if (ent.nextthink != gtime::zero())
+		if (ent.get_nextthink() != gtime::zero())
 			continue;
 		if (!visible(self, ent))
 			continue;
@@ -68,7 +68,7 @@ static bool fixbot_search(entity &self)
 	self.oldenemy = self.enemy;
 	self.enemy = ent;
 	self.enemy->owner = self;
-	self.monsterinfo.aiflags |= AI_MEDIC;
+	self.monsterinfo->aiflags |= AI_MEDIC;
 	FoundTarget (self);
 
 	return true;
@@ -146,13 +146,13 @@ REGISTER_STATIC_SAVABLE(fixbot_move_stand);
 static void weldstate(entity &self)
 {
 	if (self.frame == FRAME_weldstart_10)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_weld);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_weld);
 	else if (self.frame == FRAME_weldmiddle_07)
 	{
 		if (self.goalentity->health < 0) 
 		{
 			self.enemy->owner = 0;
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_weld_end);
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_weld_end);
 		}
 		else
 			self.goalentity->health -= 10;
@@ -160,7 +160,7 @@ static void weldstate(entity &self)
 	else
 	{
 		self.goalentity = self.enemy = 0;
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 	}
 }
 
@@ -194,7 +194,7 @@ static void use_scanner(entity &self)
 			// remove the old one
 			if (self.goalentity->type == ET_BOT_GOAL)
 			{
-				self.goalentity->nextthink = level.time + 1_hz;
+				self.goalentity->set_nextthink(level.time + 1_hz);
 				self.goalentity->think = SAVABLE(G_FreeEdict);
 			}	
 					
@@ -205,7 +205,7 @@ static void use_scanner(entity &self)
 
 			if (len < 32)
 			{
-				self.monsterinfo.currentmove = &SAVABLE(fixbot_move_weld_start);
+				self.monsterinfo->currentmove = &SAVABLE(fixbot_move_weld_start);
 				return;
 			}
 			return;
@@ -218,13 +218,13 @@ static void use_scanner(entity &self)
 	if (len < 32)
 	{
 		if (self.goalentity->type == ET_OBJECT_REPAIR)
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_weld_start);
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_weld_start);
 		else 
 		{
-			self.goalentity->nextthink = level.time + 1_hz;
+			self.goalentity->set_nextthink(level.time + 1_hz);
 			self.goalentity->think = SAVABLE(G_FreeEdict);
 			self.goalentity = self.enemy = 0;
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 		}
 		return;
 	}
@@ -237,13 +237,13 @@ static void use_scanner(entity &self)
 
 	// bot is stuck get new goalentity
 	if (self.goalentity->type == ET_OBJECT_REPAIR)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 	else 
 	{
-		self.goalentity->nextthink = level.time + 1_hz;
+		self.goalentity->set_nextthink(level.time + 1_hz);
 		self.goalentity->think = SAVABLE(G_FreeEdict);
 		self.goalentity = self.enemy = 0;
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 	}
 }
 
@@ -263,7 +263,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_forward);
 static void ai_facing(entity &self, float)
 {
 	if (infront (self, self.goalentity))
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_forward);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_forward);
 	else
 	{
 		vector v = self.goalentity->origin - self.origin;
@@ -283,7 +283,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_turn);
 static void roam_goal(entity &self)
 {
 	entity &ent = G_Spawn ();	
-	ent.type = ET_BOT_GOAL;
+	G_SetType(ent, ET_BOT_GOAL);
 	ent.solid = SOLID_BBOX;
 	ent.owner = self;
 	gi.linkentity (ent);
@@ -319,7 +319,7 @@ static void roam_goal(entity &self)
 	ent.origin = whichvec;
 	self.goalentity = self.enemy = ent;
 	
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_turn);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_turn);
 }
 
 /*
@@ -435,7 +435,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_landing);
 inline void landing_goal(entity &self) 
 {
 	entity &ent = G_Spawn ();	
-	ent.type = ET_BOT_GOAL;
+	G_SetType(ent, ET_BOT_GOAL);
 	ent.solid = SOLID_BBOX;
 	ent.owner = self;
 	gi.linkentity (ent);
@@ -454,7 +454,7 @@ inline void landing_goal(entity &self)
 	ent.origin = tr.endpos;
 	
 	self.goalentity = self.enemy = ent;
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_landing);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_landing);
 }
 
 static void fly_vertical(entity &self);
@@ -486,7 +486,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_takeoff);
 inline void takeoff_goal(entity &self)
 {
 	entity &ent = G_Spawn ();	
-	ent.type = ET_BOT_GOAL;
+	G_SetType(ent, ET_BOT_GOAL);
 	ent.solid = SOLID_BBOX;
 	ent.owner = self;
 	gi.linkentity (ent);
@@ -505,7 +505,7 @@ inline void takeoff_goal(entity &self)
 	ent.origin = tr.endpos;
 	
 	self.goalentity = self.enemy = ent;
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_takeoff);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_takeoff);
 }
 
 static void change_to_roam(entity &self)
@@ -513,7 +513,7 @@ static void change_to_roam(entity &self)
 	if (fixbot_search(self))
 		return;
 
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_roamgoal);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_roamgoal);
 	
 	if (self.spawnflags & 16)
 	{
@@ -529,13 +529,13 @@ static void change_to_roam(entity &self)
 	}
 	if (self.spawnflags & 4)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_roamgoal);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_roamgoal);
 		self.spawnflags &= (spawn_flag) ~4;
 		self.spawnflags = (spawn_flag) 32;
 	}
 
 	if (!self.spawnflags)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand2);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand2);
 }
 
 /*
@@ -551,9 +551,9 @@ static void fly_vertical2(entity &self)
 	
 	if (len < 32)
 	{
-		self.goalentity->nextthink = level.time + 1_hz;
+		self.goalentity->set_nextthink(level.time + 1_hz);
 		self.goalentity->think = SAVABLE(G_FreeEdict);
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 		self.goalentity = self.enemy = 0;
 	}
 }
@@ -575,9 +575,9 @@ static void fly_vertical(entity &self)
 	
 	if (self.frame == FRAME_landing_58 || self.frame == FRAME_takeoff_16)
 	{
-		self.goalentity->nextthink = level.time + 1_hz;
+		self.goalentity->set_nextthink(level.time + 1_hz);
 		self.goalentity->think = SAVABLE(G_FreeEdict);
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 		self.goalentity = self.enemy = null_entity;
 	}
 
@@ -612,7 +612,7 @@ static void fixbot_fire_welder(entity &self)
 
 static void fixbot_stand(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(fixbot_stand);
@@ -630,10 +630,10 @@ REGISTER_STATIC_SAVABLE(fixbot_move_run);
 
 static void fixbot_run(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
+	if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(fixbot_run);
@@ -714,8 +714,8 @@ static void fixbot_fire_laser(entity &self)
 	// critter dun got blown up while bein' fixed
 	if (self.enemy->health <= self.enemy->gib_health)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
-		self.monsterinfo.aiflags &= ~AI_MEDIC;
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
+		self.monsterinfo->aiflags &= ~AI_MEDIC;
 		return;
 	}
 
@@ -748,9 +748,9 @@ static void fixbot_fire_laser(entity &self)
 		if (check_telefrag (self)) 
 		{
 			self.enemy->spawnflags = NO_SPAWNFLAGS;
-			self.enemy->monsterinfo.aiflags = AI_NONE;
+			self.enemy->monsterinfo->aiflags = AI_NONE;
 			self.enemy->target = 0;
-			self.enemy->targetname = 0;
+			G_SetTargetname(self.enemy, nullptr);
 			self.enemy->combattarget = 0;
 			self.enemy->deathtarget = 0;
 			self.enemy->owner = self;
@@ -758,14 +758,14 @@ static void fixbot_fire_laser(entity &self)
 			self.enemy->owner = 0;
 			self.origin[2] += 1;
 		
-			self.enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+			self.enemy->monsterinfo->aiflags &= ~AI_RESURRECTING;
 
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);
-			self.monsterinfo.aiflags &= ~AI_MEDIC;
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);
+			self.monsterinfo->aiflags &= ~AI_MEDIC;
 		}
 	}
 	else
-		self.enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		self.enemy->monsterinfo->aiflags |= AI_RESURRECTING;
 }
 
 constexpr mframe_t fixbot_frames_laserattack [] =
@@ -784,7 +784,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_laserattack);
 static void fixbot_fire_blaster(entity &self)
 {
 	if (!visible(self, self.enemy))
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_run);	
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_run);	
 
 	vector forward, right;
 	AngleVectors (self.angles, &forward, &right, nullptr);
@@ -844,7 +844,7 @@ REGISTER_STATIC_SAVABLE(fixbot_move_attack2);
 
 static void fixbot_attack(entity &self)
 {
-	if (self.monsterinfo.aiflags & AI_MEDIC)
+	if (self.monsterinfo->aiflags & AI_MEDIC)
 	{
 		if (!visible (self, self.goalentity))
 			return;
@@ -852,10 +852,10 @@ static void fixbot_attack(entity &self)
 		float len = VectorLength(vec);
 
 		if (len <= 128)
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_laserattack);
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_laserattack);
 	}
 	else
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_attack2);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_attack2);
 }
 
 REGISTER_STATIC_SAVABLE(fixbot_attack);
@@ -869,12 +869,12 @@ static void fixbot_walk(entity &self)
 
 		if (len < 32)
 		{
-			self.monsterinfo.currentmove = &SAVABLE(fixbot_move_weld_start);
+			self.monsterinfo->currentmove = &SAVABLE(fixbot_move_weld_start);
 			return;
 		}
 	}
 
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(fixbot_walk);
@@ -888,11 +888,11 @@ static void fixbot_reacttodamage(entity &self, entity &, entity &, int32_t, int3
 	gi.sound (self, CHAN_VOICE, sound_pain1);
 
 	if (damage <= 10)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_pain3);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_pain3);
 	else if (damage <= 25)
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_painb);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_painb);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(fixbot_move_paina);
+		self.monsterinfo->currentmove = &SAVABLE(fixbot_move_paina);
 }
 
 REGISTER_STATIC_SAVABLE(fixbot_reacttodamage);
@@ -929,7 +929,7 @@ static void SP_monster_fixbot(entity &self)
 		.maxs = { 32, 32, 24 }
 	};
 	
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 
 	self.health = 150;
@@ -938,16 +938,17 @@ static void SP_monster_fixbot(entity &self)
 
 	self.die = SAVABLE(fixbot_die);
 
-	self.monsterinfo.stand = SAVABLE(fixbot_stand);
-	self.monsterinfo.walk = SAVABLE(fixbot_walk);
-	self.monsterinfo.run = SAVABLE(fixbot_run);
-	self.monsterinfo.attack = SAVABLE(fixbot_attack);
-	self.monsterinfo.reacttodamage = SAVABLE(fixbot_reacttodamage);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(fixbot_stand);
+	self.monsterinfo->walk = SAVABLE(fixbot_walk);
+	self.monsterinfo->run = SAVABLE(fixbot_run);
+	self.monsterinfo->attack = SAVABLE(fixbot_attack);
+	self.monsterinfo->reacttodamage = SAVABLE(fixbot_reacttodamage);
 	
 	gi.linkentity (self);
 
-	self.monsterinfo.currentmove = &SAVABLE(fixbot_move_stand);	
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->currentmove = &SAVABLE(fixbot_move_stand);	
+	self.monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start (self);
 }
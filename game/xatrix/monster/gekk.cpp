@@ -96,19 +96,19 @@ static bool gekk_checkattack(entity &self)
 
 	if (gekk_check_melee(self))
 	{
-		self.monsterinfo.attack_state = AS_MELEE;
+		self.monsterinfo->attack_state = AS_MELEE;
 		return true;
 	}
 
 	if (gekk_check_jump(self))
 	{
-		self.monsterinfo.attack_state = AS_MISSILE;
+		self.monsterinfo->attack_state = AS_MISSILE;
 		return true;
 	}
 
 	if (gekk_check_jump_close (self) && self.waterlevel <= WATER_LEGS)
 	{	
-		self.monsterinfo.attack_state = AS_MISSILE;
+		self.monsterinfo->attack_state = AS_MISSILE;
 		return true;
 	}
 
@@ -197,7 +197,7 @@ static void gekk_jump_touch(entity &self, entity &other, vector, const surface &
 	{
 		if (self.groundentity != null_entity)
 		{
-			self.monsterinfo.nextframe = FRAME_leapatk_11;
+			self.monsterinfo->nextframe = FRAME_leapatk_11;
 			self.touch = nullptr;
 		}
 
@@ -231,8 +231,8 @@ static void gekk_jump_takeoff(entity &self)
 	}
 
 	self.groundentity = null_entity;
-	self.monsterinfo.aiflags |= AI_DUCKED;
-	self.monsterinfo.attack_finished = level.time + 3s;
+	self.monsterinfo->aiflags |= AI_DUCKED;
+	self.monsterinfo->attack_finished = level.time + 3s;
 	self.touch = SAVABLE(gekk_jump_touch);
 }
 
@@ -257,8 +257,8 @@ static void gekk_jump_takeoff2(entity &self)
 	}
 
 	self.groundentity = null_entity;
-	self.monsterinfo.aiflags |= AI_DUCKED;
-	self.monsterinfo.attack_finished = level.time + 3s;
+	self.monsterinfo->aiflags |= AI_DUCKED;
+	self.monsterinfo->attack_finished = level.time + 3s;
 	self.touch = SAVABLE(gekk_jump_touch);
 }
 
@@ -273,16 +273,16 @@ static void gekk_check_landing(entity &self)
 	if (self.groundentity != null_entity)
 	{
 		gi.sound (self, CHAN_WEAPON, sound_thud);
-		self.monsterinfo.attack_finished = gtime::zero();
-		self.monsterinfo.aiflags &= ~AI_DUCKED;
+		self.monsterinfo->attack_finished = gtime::zero();
+		self.monsterinfo->aiflags &= ~AI_DUCKED;
 		self.velocity = vec3_origin;
 		return;
 	}
 
-	if (level.time > self.monsterinfo.attack_finished)
-		self.monsterinfo.nextframe = FRAME_leapatk_11;
+	if (level.time > self.monsterinfo->attack_finished)
+		self.monsterinfo->nextframe = FRAME_leapatk_11;
 	else
-		self.monsterinfo.nextframe = FRAME_leapatk_12;
+		self.monsterinfo->nextframe = FRAME_leapatk_12;
 }
 
 static void land_to_water(entity &self);
@@ -328,7 +328,7 @@ static void water_to_land(entity &self)
 	self.yaw_speed = 20.f;
 	self.viewheight = 25;
 	
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_leapatk2);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_leapatk2);
 	
 	self.bounds = bbox::sized(24.f);
 }
@@ -363,7 +363,7 @@ REGISTER_STATIC_SAVABLE(gekk_move_swim_loop);
 static void gekk_swim_loop(entity &self)
 {
 	self.flags |= FL_SWIM;	
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_swim_loop);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_swim_loop);
 }
 
 static void gekk_hit_left(entity &self)
@@ -440,7 +440,7 @@ static void land_to_water(entity &self)
 	self.yaw_speed = 10.f;
 	self.viewheight = 10;
 	
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_swim_start);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_swim_start);
 	
 	self.bounds = {
 		.mins = { -24, -24, -24 },
@@ -463,7 +463,7 @@ REGISTER_STATIC_SAVABLE(gekk_move_run);
 
 static void gekk_face(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_run);	
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_run);	
 }
 
 //
@@ -476,15 +476,15 @@ static void ai_stand2(entity &self, float dist)
 	{
 		ai_move (self, dist);
 
-		if (!(self.spawnflags & 1) && (self.monsterinfo.idle) && (level.time > self.monsterinfo.idle_time))
+		if (!(self.spawnflags & 1) && (self.monsterinfo->idle) && (level.time > self.monsterinfo->idle_time))
 		{
-			if (self.monsterinfo.idle_time != gtime::zero())
+			if (self.monsterinfo->idle_time != gtime::zero())
 			{
-				self.monsterinfo.idle (self);
-				self.monsterinfo.idle_time = level.time + random(15s, 30s);
+				self.monsterinfo->idle (self);
+				self.monsterinfo->idle_time = level.time + random(15s, 30s);
 			}
 			else
-				self.monsterinfo.idle_time = level.time + random(15s);
+				self.monsterinfo->idle_time = level.time + random(15s);
 		}
 	}
 	else
@@ -556,9 +556,9 @@ REGISTER_STATIC_SAVABLE(gekk_move_standunderwater);
 static void gekk_stand(entity &self)
 {
 	if (self.waterlevel > WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_standunderwater);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_standunderwater);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_stand);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_stand);
@@ -570,7 +570,7 @@ REGISTER_STATIC_SAVABLE(gekk_stand);
 static void gekk_idle_loop(entity &self)
 {
 	if (random() > 0.75 && self.health < self.max_health)
-		self.monsterinfo.nextframe = FRAME_idle_01;
+		self.monsterinfo->nextframe = FRAME_idle_01;
 }
 
 static void gekk_chant(entity &self);
@@ -619,7 +619,7 @@ REGISTER_STATIC_SAVABLE(gekk_move_chant);
 
 static void gekk_chant(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_chant);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_chant);
 }
 
 constexpr mframe_t gekk_frames_idle [] =
@@ -669,9 +669,9 @@ REGISTER_STATIC_SAVABLE(gekk_move_idle2);
 static void gekk_idle(entity &self)
 {
 	if (self.waterlevel <= WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_idle);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_idle);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_swim_start);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_swim_start);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_idle);
@@ -695,7 +695,7 @@ REGISTER_STATIC_SAVABLE(gekk_move_walk);
 
 static void gekk_walk(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_walk);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_walk);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_walk);
@@ -707,11 +707,11 @@ REGISTER_STATIC_SAVABLE(gekk_walk);
 static void gekk_run(entity &self)
 {
 	if (self.waterlevel > WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_swim_start);
-	else if (self.monsterinfo.aiflags & AI_STAND_GROUND)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_stand);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_swim_start);
+	else if (self.monsterinfo->aiflags & AI_STAND_GROUND)
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_stand);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_run);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_run);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_run);
@@ -728,9 +728,9 @@ REGISTER_STATIC_SAVABLE(gekk_move_run_start);
 static void gekk_run_start(entity &self)
 {
 	if (self.waterlevel > WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_swim_start);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_swim_start);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_run_start);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_run_start);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_run_start);
@@ -767,7 +767,7 @@ static void fire_loogie(entity &self, vector start, vector dir, int32_t damage,
 	loogie.old_origin = start;
 	loogie.angles = vectoangles (dir);
 	loogie.velocity = dir * speed;
-	loogie.movetype = MOVETYPE_FLYMISSILE;
+	loogie.set_movetype(MOVETYPE_FLYMISSILE);
 	loogie.clipmask = MASK_SHOT;
 	loogie.solid = SOLID_BBOX;
 	loogie.effects |= EF_BLASTER;
@@ -775,7 +775,7 @@ static void fire_loogie(entity &self, vector start, vector dir, int32_t damage,
 	loogie.modelindex = gi.modelindex ("models/objects/loogy/tris.md2");
 	loogie.owner = self;
 	loogie.touch = SAVABLE(loogie_touch);
-	loogie.nextthink = level.time + 2s;
+	loogie.set_nextthink(level.time + 2s);
 	loogie.think = SAVABLE(G_FreeEdict);
 	loogie.dmg = damage;
 	gi.linkentity (loogie);
@@ -813,7 +813,7 @@ static void reloogie(entity &self)
 {
 	if (random() > 0.8 && self.health < self.max_health)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_idle2);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_idle2);
 		return;
 	}
 		
@@ -839,7 +839,7 @@ REGISTER_STATIC_SAVABLE(gekk_move_spit);
 
 static void do_spit(entity &self)
 {
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_spit);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_spit);
 };
 
 static void gekk_check_refire(entity &self);
@@ -888,9 +888,9 @@ static void gekk_check_refire(entity &self)
 	if (random() < ((int32_t) skill * 0.1f) && VectorDistance(self.origin, self.enemy->origin) < RANGE_MELEE)
 	{
 		if (self.frame == FRAME_clawatk3_09)
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack2);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack2);
 		else if (self.frame == FRAME_clawatk5_09)
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack1);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack1);
 	}
 }
 
@@ -954,11 +954,11 @@ REGISTER_STATIC_SAVABLE(gekk_move_attack);
 static void gekk_melee(entity &self)
 {
 	if (self.waterlevel > WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack);
 	else if (random() > 0.66)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack1);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack1);
 	else 
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack2);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack2);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_melee);
@@ -972,11 +972,11 @@ static void gekk_jump(entity &self)
 	}
 
 	if (random() > 0.5 && (VectorDistance (self.origin, self.enemy->origin) > RANGE_MELEE))
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_spit);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_spit);
 	else if (random() > 0.8)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_spit);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_spit);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_leapatk);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_leapatk);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_jump);
@@ -1070,12 +1070,12 @@ static void gekk_reacttodamage(entity &self, entity &, entity &, int32_t, int32_
 		if (!(self.flags & FL_SWIM))
 			self.flags |= FL_SWIM;
 
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_pain);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_pain);
 	}
 	else if (random() > 0.5)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_pain1);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_pain1);
 	else
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_pain2);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_pain2);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_reacttodamage);
@@ -1094,9 +1094,9 @@ static void gekk_dead(entity &self)
 		.mins = { -16, -16, -24 },
 		.maxs = { 16, 16, -8 }
 	};
-	self.movetype = MOVETYPE_TOSS;
+	self.set_movetype(MOVETYPE_TOSS);
 	self.svflags |= SVF_DEADMONSTER;
-	self.nextthink = gtime::zero();
+	self.set_nextthink(gtime::zero());
 	gi.linkentity (self);
 }
 
@@ -1279,16 +1279,16 @@ static void gekk_die(entity &self, entity &, entity &, int32_t damage, vector)
 	self.skinnum = 2;
 
 	if (self.waterlevel > WATER_LEGS)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_wdeath);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_wdeath);
 	else
 	{
 		float r = random();
 		if (r > 0.66)
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_death1);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_death1);
 		else if (r > 0.33)
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_death3);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_death3);
 		else
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_death4);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_death4);
 	}
 }
 
@@ -1352,36 +1352,36 @@ static void gekk_dodge(entity &self, entity &attacker, gtimef eta)
 
 	if (self.waterlevel > WATER_LEGS)
 	{
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack);
 		return;
 	}
 	
 	if (skill == 0)
 	{
 		if (random() > 0.5)
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_lduck);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_lduck);
 		else 
-			self.monsterinfo.currentmove = &SAVABLE(gekk_move_rduck);
+			self.monsterinfo->currentmove = &SAVABLE(gekk_move_rduck);
 		return;
 	}
 
-	self.monsterinfo.pause_time = duration_cast<gtime>(level.time + eta + 0.3s);
+	self.monsterinfo->pause_time = duration_cast<gtime>(level.time + eta + 0.3s);
 
 	if (skill == 1)
 	{
 		if (random() > 0.33)
 		{
 			if (random() > 0.5)
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_lduck);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_lduck);
 			else 
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_rduck);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_rduck);
 		}
 		else
 		{
 			if (random() > 0.66)
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack1);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack1);
 			else 
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack2);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack2);
 			
 		}
 		return;
@@ -1391,24 +1391,24 @@ static void gekk_dodge(entity &self, entity &attacker, gtimef eta)
 		if (random() > 0.66)
 		{
 			if (random() > 0.5)
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_lduck);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_lduck);
 			else 
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_rduck);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_rduck);
 		}
 		else
 		{
 			if (random() > 0.66)
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack1);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack1);
 			else 
-				self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack2);
+				self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack2);
 		}
 		return;
 	}
 
 	if (random() > 0.66)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack1);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack1);
 	else 
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_attack2);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_attack2);
 }
 
 REGISTER_STATIC_SAVABLE(gekk_dodge);
@@ -1443,7 +1443,7 @@ static void SP_monster_gekk(entity &self)
 	sound_chantmid = gi.soundindex ("gek/gek_mid.wav");
 	sound_chanthigh = gi.soundindex ("gek/gek_high.wav");
 	
-	self.movetype = MOVETYPE_STEP;
+	self.set_movetype(MOVETYPE_STEP);
 	self.solid = SOLID_BBOX;
 	self.modelindex = gi.modelindex ("models/monsters/gekk/tris.md2");
 	self.bounds = bbox::sized(24.f);
@@ -1463,29 +1463,30 @@ static void SP_monster_gekk(entity &self)
 	self.pain = SAVABLE(gekk_pain);
 	self.die = SAVABLE(gekk_die);
 
-	self.monsterinfo.stand = SAVABLE(gekk_stand);
+	self.monsterinfo.emplace();
+	self.monsterinfo->stand = SAVABLE(gekk_stand);
 
-	self.monsterinfo.walk = SAVABLE(gekk_walk);
-	self.monsterinfo.run = SAVABLE(gekk_run_start);
-	self.monsterinfo.dodge = SAVABLE(gekk_dodge);
-	self.monsterinfo.attack = SAVABLE(gekk_jump);
-	self.monsterinfo.melee = SAVABLE(gekk_melee);
-	self.monsterinfo.sight = SAVABLE(gekk_sight);
+	self.monsterinfo->walk = SAVABLE(gekk_walk);
+	self.monsterinfo->run = SAVABLE(gekk_run_start);
+	self.monsterinfo->dodge = SAVABLE(gekk_dodge);
+	self.monsterinfo->attack = SAVABLE(gekk_jump);
+	self.monsterinfo->melee = SAVABLE(gekk_melee);
+	self.monsterinfo->sight = SAVABLE(gekk_sight);
 	
-	self.monsterinfo.search = SAVABLE(gekk_search);
-	self.monsterinfo.idle = SAVABLE(gekk_idle);
-	self.monsterinfo.checkattack = SAVABLE(gekk_checkattack);
-	self.monsterinfo.reacttodamage = SAVABLE(gekk_reacttodamage);
+	self.monsterinfo->search = SAVABLE(gekk_search);
+	self.monsterinfo->idle = SAVABLE(gekk_idle);
+	self.monsterinfo->checkattack = SAVABLE(gekk_checkattack);
+	self.monsterinfo->reacttodamage = SAVABLE(gekk_reacttodamage);
 
 	gi.linkentity (self);
 	
-	self.monsterinfo.currentmove = &SAVABLE(gekk_move_stand);
+	self.monsterinfo->currentmove = &SAVABLE(gekk_move_stand);
 
-	self.monsterinfo.scale = MODEL_SCALE;
+	self.monsterinfo->scale = MODEL_SCALE;
 	walkmonster_start (self);
 
 	if (self.spawnflags & GEKK_CHANT)
-		self.monsterinfo.currentmove = &SAVABLE(gekk_move_chant);
+		self.monsterinfo->currentmove = &SAVABLE(gekk_move_chant);
 }
 
 REGISTER_ENTITY(MONSTER_GEKK, monster_gekk);
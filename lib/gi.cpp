@@ -1,6 +1,10 @@
 #include "config.h"
 #include "gi.h"
 #include "lib/string/format.h"
+#include "lib/types/scratch.h"
+#include "lib/types/map.h"
+#include "game/spatial.h"
+#include "game/think.h"
 
 game_import gi;
 
@@ -29,12 +33,52 @@ void game_import::FreeTags(uint32_t tag)
 	impl.FreeTags(tag);
 }
 
+// asset indices never change during a level, so rather than having the
+// engine search its configstrings on every call, remember what it told us.
+struct asset_index_cache
+{
+	smap<int32_t>	indices;
+
+	template<typename TFunc>
+	inline int32_t find(const stringref &name, TFunc lookup)
+	{
+		if (!name)
+			return lookup(name.ptr());
+
+		if (auto it = indices.find(name.view()); it != indices.end())
+			return it->second;
+
+		const int32_t index = lookup(name.ptr());
+
+		if (index)
+			indices.emplace(string(name.view()), index);
+
+		return index;
+	}
+
+	inline void clear()
+	{
+		indices.clear();
+	}
+};
+
+static asset_index_cache sound_cache, model_cache, image_cache;
+
+// forget all cached sound/model/image indices; must be called
+// whenever the engine resets configstrings
+void game_import::ClearIndexCache()
+{
+	sound_cache.clear();
+	model_cache.clear();
+	image_cache.clear();
+}
+
 // sounds
 
 // fetch a sound index from the specified sound file
 sound_index game_import::soundindex(const stringref &name)
 {
-	return (sound_index) impl.soundindex(name.ptr());
+	return (sound_index) sound_cache.find(name, impl.soundindex);
 }
 
 // sound; play soundindex on specified entity on channel at specified volume/attn with a time offset of timeofs
@@ -60,7 +104,7 @@ void game_import::positioned_sound(vector origin, entityref ent, sound_channel c
 // fetch a model index from the specified sound file
 model_index game_import::modelindex(const stringref &name)
 {
-	return (model_index) impl.modelindex(name.ptr());
+	return (model_index) model_cache.find(name, impl.modelindex);
 }
 
 // set model to specified string value; use this for bmodels, also sets mins/maxs
@@ -74,7 +118,7 @@ void game_import::setmodel(entity &ent, const stringref &name)
 // fetch a model index from the specified sound file
 image_index game_import::imageindex(const stringref &name)
 {
-	return (image_index) impl.imageindex(name.ptr());
+	return (image_index) image_cache.find(name, impl.imageindex);
 }
 
 // entities
@@ -84,27 +128,36 @@ image_index game_import::imageindex(const stringref &name)
 // solidity changes, it must be relinked.
 void game_import::linkentity(entity &ent)
 {
+	G_IdleLinked(ent);
 	impl.linkentity(&ent);
+	G_SpatialLink(ent);
 }
 // call before removing an interactive edict
 void game_import::unlinkentity(entity &ent)
 {
 	impl.unlinkentity(&ent);
+	G_SpatialUnlink(ent);
 }
+// BoxEdicts results are handed out of a scratch arena that is
+// reset every frame, so touching triggers doesn't allocate.
+static scratch<entityref> box_edicts_scratch;
+
 // return entities within the specified box
-dynarray<entityref> game_import::BoxEdicts(bbox bounds, box_edicts_area areatype, uint32_t allocate)
+std::span<entityref> game_import::BoxEdicts(bbox bounds, box_edicts_area areatype)
 {
-	dynarray<entityref> ents;
-	ents.reserve(allocate);
+	// always leave some room, since the engine warns when maxcount is hit
+	std::span<entityref> space = box_edicts_scratch.reserve(64);
 	size_t size;
 
-	while ((size = (size_t) impl.BoxEdicts(&bounds.mins.x, &bounds.maxs.x, (entity **) ents.data(), (int32_t) allocate, areatype)) == allocate)
-	{
-		allocate *= 2;
-		ents.reserve(allocate);
-	}
+	while ((size = (size_t) impl.BoxEdicts(&bounds.mins.x, &bounds.maxs.x, (entity **) space.data(), (int32_t) space.size(), areatype)) == space.size())
+		space = box_edicts_scratch.reserve(space.size() * 2);
 
-	return dynarray<entityref>(ents.data(), ents.data() + size);
+	return box_edicts_scratch.commit(size);
+}
+// release all of the results returned by BoxEdicts
+void game_import::ClearScratch()
+{
+	box_edicts_scratch.reset();
 }
 // player movement code common with client prediction
 void game_import::Pmove(pmove &pmove)
@@ -114,14 +167,76 @@ void game_import::Pmove(pmove &pmove)
 
 // collision
 
+// call sites are keyed by where they are, not by the pointers in
+// source_location, since inline functions can have one per file.
+struct trace_site_key
+{
+	stringlit	file;
+	uint32_t	line, column;
+
+	// compare the file by content, to match trace_site_hash
+	bool operator==(const trace_site_key &other) const
+	{
+		return line == other.line && column == other.column && std::string_view(file) == std::string_view(other.file);
+	}
+};
+
+struct trace_site_hash
+{
+	inline size_t operator()(const trace_site_key &key) const
+	{
+		return std::hash<std::string_view>()(key.file) ^ (((size_t) key.line << 8) + key.column);
+	}
+};
+
+static std::unordered_map<trace_site_key, trace_call_site, trace_site_hash, std::equal_to<trace_site_key>,
+	game_allocator<std::pair<const trace_site_key, trace_call_site>>> trace_sites;
+
+using trace_clock = std::chrono::steady_clock;
+
+static void G_AccountTrace(const std::source_location &location, trace_clock::time_point start, bool is_pointcontents)
+{
+	const std::chrono::nanoseconds elapsed = trace_clock::now() - start;
+	trace_call_site &site = trace_sites[{ location.file_name(), location.line(), location.column() }];
+
+	if (!site.traces && !site.pointcontents)
+		site.location = location;
+
+	if (is_pointcontents)
+		site.pointcontents++;
+	else
+		site.traces++;
+
+	site.time += elapsed;
+}
+
+// fetch the totals for every call site seen so far
+dynarray<trace_call_site> game_import::trace_call_sites()
+{
+	dynarray<trace_call_site> sites;
+	sites.reserve(trace_sites.size());
+
+	for (auto &[key, site] : trace_sites)
+		sites.push_back(site);
+
+	return sites;
+}
+// throw away all recorded totals
+void game_import::clear_trace_call_sites()
+{
+	trace_sites.clear();
+}
+
 // perform a line trace
-[[nodiscard]] trace game_import::traceline(vector start, vector end, entityref passent, content_flags contentmask)
+[[nodiscard]] trace game_import::traceline(vector start, vector end, entityref passent, content_flags contentmask, std::source_location location)
 {
-	return trace(start, bbox_point, end, passent, contentmask);
+	return trace(start, bbox_point, end, passent, contentmask, location);
 }
 // perform a box trace
-[[nodiscard]] trace game_import::trace(vector start, bbox bounds, vector end, entityref passent, content_flags contentmask)
+[[nodiscard]] trace game_import::trace(vector start, bbox bounds, vector end, entityref passent, content_flags contentmask, std::source_location location)
 {
+	const trace_clock::time_point call_start = trace_accounting ? trace_clock::now() : trace_clock::time_point();
+
 	::trace tr = impl.trace(&start.x, &bounds.mins.x, &bounds.maxs.x, &end.x, passent, contentmask);
 
 	if (tr.fraction == 1.0f && *(void **)(&tr.contents - 1) == nullptr)
@@ -130,12 +245,22 @@ void game_import::Pmove(pmove &pmove)
 		tr = impl.trace(&start.x, &bounds.mins.x, &bounds.maxs.x, &end.x, passent, contentmask);
 	}
 
+	if (trace_accounting)
+		G_AccountTrace(location, call_start, false);
+
 	return tr;
 }
 // fetch the brush contents at the specified point
-[[nodiscard]] content_flags game_import::pointcontents(vector point)
+[[nodiscard]] content_flags game_import::pointcontents(vector point, std::source_location location)
 {
-	return (content_flags) impl.pointcontents(&point.x);
+	if (!trace_accounting)
+		return (content_flags) impl.pointcontents(&point.x);
+
+	const trace_clock::time_point call_start = trace_clock::now();
+	const content_flags contents = (content_flags) impl.pointcontents(&point.x);
+
+	G_AccountTrace(location, call_start, true);
+	return contents;
 }
 // check whether the two vectors are in the same PVS
 [[nodiscard]] bool game_import::inPVS(vector p1, vector p2)
@@ -119,6 +119,15 @@ struct anglef
 	float angle;
 };
 
+// totals for the collision calls made from a single
+// line of game code; see game_import::trace_accounting
+struct trace_call_site
+{
+	std::source_location		location;
+	uint64_t					traces, pointcontents;
+	std::chrono::nanoseconds	time;
+};
+
 struct game_import
 {
 private:
@@ -224,7 +233,7 @@ public:
 	template<typename T, typename ...Args>
 	inline sound_index soundindexfmt(T &&fmt, Args &&...args)
 	{
-		return (sound_index) impl.soundindex(format(std::forward<T>(fmt), std::forward<Args>(args)...).data());
+		return soundindex(format(std::forward<T>(fmt), std::forward<Args>(args)...));
 	}
 
 	// sound; play soundindex on specified entity on channel at specified volume/attn with a time offset of timeofs
@@ -295,7 +304,7 @@ public:
 	template<typename T, typename ...Args>
 	inline model_index modelindexfmt(T &&fmt, Args &&...args)
 	{
-		return (model_index) impl.modelindex(format(std::forward<T>(fmt), std::forward<Args>(args)...).data());
+		return modelindex(format(std::forward<T>(fmt), std::forward<Args>(args)...));
 	}
 	
 	// set model to specified string value; use this for bmodels, also sets mins/maxs
@@ -310,7 +319,7 @@ public:
 	template<typename T, typename ...Args>
 	inline image_index imageindexfmt(T &&fmt, const Args &...args)
 	{
-		return (image_index) impl.imageindex(format(std::forward<T>(fmt), std::forward<Args>(args)...).data());
+		return imageindex(format(std::forward<T>(fmt), std::forward<Args>(args)...));
 	}
 
 	// entities
@@ -321,19 +330,33 @@ public:
 	void linkentity(entity &ent);
 	// call before removing an interactive edict
 	void unlinkentity(entity &ent);
-	// return entities within the specified box
-	dynarray<entityref> BoxEdicts(bbox bounds, box_edicts_area areatype, uint32_t allocate = 16);
+	// return entities within the specified box. the result is only
+	// valid until the next ClearScratch, which happens every frame.
+	std::span<entityref> BoxEdicts(bbox bounds, box_edicts_area areatype);
+	// release all of the results returned by BoxEdicts
+	void ClearScratch();
+	// forget all cached sound/model/image indices; must be called
+	// whenever the engine resets configstrings
+	void ClearIndexCache();
 	// player movement code common with client prediction
 	void Pmove(pmove &pmove);
 
 	// collision
 	
 	// perform a line trace
-	[[nodiscard]] trace traceline(vector start, vector end, entityref passent, content_flags contentmask);
+	[[nodiscard]] trace traceline(vector start, vector end, entityref passent, content_flags contentmask, std::source_location location = std::source_location::current());
 	// perform a box trace
-	[[nodiscard]] trace trace(vector start, bbox bounds, vector end, entityref passent, content_flags contentmask);
+	[[nodiscard]] trace trace(vector start, bbox bounds, vector end, entityref passent, content_flags contentmask, std::source_location location = std::source_location::current());
 	// fetch the brush contents at the specified point
-	[[nodiscard]] content_flags pointcontents(vector point);
+	[[nodiscard]] content_flags pointcontents(vector point, std::source_location location = std::source_location::current());
+
+	// when set, the calls above count up how many times they were
+	// called and how long they took, per calling line
+	bool trace_accounting = false;
+	// fetch the totals for every call site seen so far
+	dynarray<trace_call_site> trace_call_sites();
+	// throw away all recorded totals
+	void clear_trace_call_sites();
 	// check whether the two vectors are in the same PVS
 	[[nodiscard]] bool inPVS(vector p1, vector p2);
 	// check whether the two vectors are in the same PHS
@@ -12,6 +12,13 @@ namespace internal
 	extern std::mt19937_64 rng;
 };
 
+// restart the generator from the given seed; the same seed
+// always gives the same numbers after it
+inline void Q_srand(uint64_t seed)
+{
+	internal::rng.seed(seed);
+}
+
 // return a random unsigned integer between [0, std::numeric_limits<uint64_t>::max()]
 [[nodiscard]] inline uint64_t Q_rand()
 {
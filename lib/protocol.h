@@ -181,6 +181,9 @@ MAKE_ENUM_BITWISE(pmflags);
 // will result in a prediction error of some degree.
 struct pmove_state
 {
+	// game-side Pmove works on the packed values directly
+	friend struct pmove_local;
+
 	pmtype	pm_type;
 
 private:
@@ -920,6 +923,8 @@ MAKE_ENUM_BITWISE(button_bits);
 // usercmd_t is sent to the server each client frame
 struct usercmd
 {
+	friend struct pmove_local;
+
 	uint8_t		msec;
 	button_bits	buttons;
 private:
@@ -25,4 +25,7 @@
 #include <unordered_set>
 #include <cinttypes>
 #include <cstddef>
-#include <bitset>
\ No newline at end of file
+#include <bitset>
+#include <bit>
+#include <span>
+#include <source_location>
\ No newline at end of file
@@ -21,37 +21,68 @@ class mutable_string : public std::basic_string<char, std::char_traits<char>, ga
 	using basic_string::basic_string;
 };
 
-// most strings in Q2++ are immutable. this is to remain simple
-// and allow them to be collected automatically via a smart pointer.
+// most strings in Q2++ are immutable. most of them (entity key values,
+// names) are short, so those are stored inline; longer ones go in a
+// heap block that copies share. the game only runs on one thread, so
+// the block's reference count is a plain integer.
 class string
 {
-	using ptr_type = std::shared_ptr<char[]>;
+	// heap strings are stored right after this
+	struct heap_block
+	{
+		uint32_t	refs;
+	};
+
+	// strings shorter than this (with their terminator) are inline
+	static constexpr size_t inline_size = 16;
 
-	std::variant<ptr_type, mutable_string> shared;
+	union
+	{
+		char		inline_data[inline_size];
+		heap_block	*heap;
+	};
 	size_t slength;
 
+	inline bool is_inline() const { return slength < inline_size; }
+
+	inline char *data() { return is_inline() ? inline_data : reinterpret_cast<char *>(heap + 1); }
+	inline const char *data() const { return is_inline() ? inline_data : reinterpret_cast<const char *>(heap + 1); }
+
+	inline void release()
+	{
+		if (!is_inline() && !--heap->refs)
+			game_allocator<char>().deallocate(reinterpret_cast<char *>(heap), sizeof(heap_block) + slength + 1);
+	}
+
+	// take over other's contents, leaving it empty
+	inline void steal(string &other)
+	{
+		memcpy(inline_data, other.inline_data, inline_size);
+		slength = other.slength;
+		other.slength = 0;
+		other.inline_data[0] = 0;
+	}
+
 	// copy string literal passed by argument into a new string.
 	// internal; length is not null terminated
 	inline string(stringlit lit, size_t length) :
-		shared(),
 		slength(length)
 	{
-		if (slength)
+		if (!is_inline())
 		{
-			auto ptr = std::allocate_shared<char[]>(game_allocator<char[]>(), slength + 1);
+			heap = reinterpret_cast<heap_block *>(game_allocator<char>().allocate(sizeof(heap_block) + slength + 1));
+			heap->refs = 1;
+		}
 
-			if (lit)
-			{
-				memcpy(ptr.get(), lit, slength);
-				ptr[slength] = 0;
-			}
-			else
-				ptr[0] = 0;
+		char *ptr = data();
 
-			shared = std::move(ptr);
+		if (lit)
+		{
+			memcpy(ptr, lit, slength);
+			ptr[slength] = 0;
 		}
 		else
-			shared = ptr_type(nullptr);
+			ptr[0] = 0;
 	}
 
 public:
@@ -65,19 +96,50 @@ public:
 		string(string.data(), string.length())
 	{
 	}
-	
-	// move a mutable string into a saved string
-	inline string(mutable_string &&string) noexcept :
-		shared(std::move(string)),
-		slength(std::get<mutable_string>(shared).size())
-	{
-	}
 
 	// share string passed by argument into this string
 	inline string(const string &share) :
-		shared(share.shared),
 		slength(share.slength)
 	{
+		if (is_inline())
+			memcpy(inline_data, share.inline_data, inline_size);
+		else
+		{
+			heap = share.heap;
+			heap->refs++;
+		}
+	}
+
+	inline string(string &&other) noexcept
+	{
+		steal(other);
+	}
+
+	inline string &operator=(const string &share)
+	{
+		if (this != &share)
+		{
+			release();
+			new(this) string(share);
+		}
+
+		return *this;
+	}
+
+	inline string &operator=(string &&other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			steal(other);
+		}
+
+		return *this;
+	}
+
+	inline ~string()
+	{
+		release();
 	}
 
 	// copy string literal passed by argument into a new string
@@ -100,6 +162,12 @@ public:
 	// mainly internal; start/length must be validated before calling this
 	inline string(const stringref &sub, const size_t &start, const size_t &length);
 
+	// copy a view (e.g. a token) into a new string
+	explicit inline string(std::string_view view) :
+		string(view.data(), view.size())
+	{
+	}
+
 	// allocate new string with specified length. used internally.
 	explicit inline string(const size_t &length) :
 		string(nullptr, length)
@@ -112,9 +180,7 @@ public:
 	// C library stuff.
 	inline explicit operator stringlit() const
 	{
-		if (std::holds_alternative<ptr_type>(shared))
-			return std::get<ptr_type>(shared).get();
-		return std::get<mutable_string>(shared).data();
+		return data();
 	}
 	
 	// get underlying string literal.
@@ -129,6 +195,9 @@ public:
 	inline size_t length() const { return slength; }
 	inline size_t size() const { return slength; }
 
+	// view of the whole string; same caveats as ptr()
+	inline std::string_view view() const { return std::string_view(ptr(), slength); }
+
 	inline const char &operator[](const size_t &index) const
 	{
 		static char zerochar = 0;
@@ -159,8 +228,8 @@ public:
 	inline bool operator==(const stringref &lit) const;
 	inline bool operator!=(const stringref &lit) const;
 
-	// string is "valid" if its non-null and doesn't start with a zero
-	inline explicit operator bool() const { return ptr() && slength; }
+	// string is "valid" if it isn't empty
+	inline explicit operator bool() const { return slength; }
 };
 
 // faster strlen for strings
@@ -238,6 +307,9 @@ public:
 	inline size_t length() const { return slength; }
 	inline size_t size() const { return slength; }
 
+	// view of the whole string; same caveats as ptr()
+	inline std::string_view view() const { return std::string_view(ptr(), slength); }
+
 	inline const char &operator[](const size_t &index) const
 	{
 		static char zerochar = 0;
@@ -404,7 +476,9 @@ inline double atoi(const T &str)
 template<is_string T>
 inline string strlwr(const T &str)
 {
-	string s(str);
+	// go through stringref so that we always get our own buffer;
+	// copying a string directly would share it
+	string s((stringref) str);
 
 	char *out = const_cast<char *>(s.ptr());
 	char *end = out + s.length();
@@ -419,7 +493,9 @@ inline string strlwr(const T &str)
 template<is_string T>
 inline string strupr(const T &str)
 {
-	string s(str);
+	// go through stringref so that we always get our own buffer;
+	// copying a string directly would share it
+	string s((stringref) str);
 
 	char *out = const_cast<char *>(s.ptr());
 	char *end = out + s.length();
@@ -512,6 +588,48 @@ inline bool striequals(const TA &a, const TB &b)
 	return false;
 }
 
+// case insensitive hash (FNV-1a). only ASCII is folded, which is
+// all that striequals ever sees from map data, and it means the hash
+// can be worked out at compile time.
+constexpr uint32_t strihash(std::string_view s)
+{
+	uint32_t hash = 2166136261u;
+
+	for (char c : s)
+	{
+		if (c >= 'A' && c <= 'Z')
+			c = c - 'A' + 'a';
+
+		hash = (hash ^ (uint8_t) c) * 16777619u;
+	}
+
+	return hash;
+}
+
+// hash/equality pair for containers keyed case-insensitively on literals
+struct stri_hash
+{
+	inline size_t operator()(stringlit s) const { return strihash(s); }
+};
+
+struct stri_equal
+{
+	inline bool operator()(stringlit a, stringlit b) const { return striequals(a, b); }
+};
+
+// case insensitive == for views, which aren't terminated
+inline bool striequals(std::string_view a, std::string_view b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (size_t i = 0; i < a.size(); i++)
+		if (tolower(a[i]) != tolower(b[i]))
+			return false;
+
+	return true;
+}
+
 // stringarray is a special type mainly used for interop,
 // but basically it's a static array of characters.
 template<size_t size>
@@ -562,20 +680,20 @@ public:
 
 /*
 ==============
-strtok
+strtok_view
 
-Parse a token out of a string.
+Parse a token out of a string, as a view into it.
 Handles C and C++ comments.
 ==============
 */
-inline string strtok(const stringref &data, size_t &start)
+inline std::string_view strtok_view(stringlit data, size_t &start)
 {
 	size_t token_start = start, token_end;
 
-	if (!data[0])
+	if (!data || !data[0])
 	{
 		start = (size_t)-1;
-		return "";
+		return {};
 	}
 
 // skip whitespace
@@ -587,7 +705,7 @@ skipwhite:
 		if (c == 0)
 		{
 			start = (size_t)-1;
-			return "";
+			return {};
 		}
 		token_start++;
 	}
@@ -627,12 +745,13 @@ skipwhite:
 		token_end++;
 		while ((c = data[token_end++]) && c != '\"') ;
 
-		if (!data[token_end])
+		// an unterminated quote stops at the end of the data
+		if (!c || !data[token_end])
 			start = (size_t)-1;
 		else
 			start = token_end;
 
-		return substr(data, token_start + 1, token_end - token_start - 2);
+		return std::string_view(data + token_start + 1, token_end - token_start - 2);
 	}
 
 // parse a regular word
@@ -647,5 +766,76 @@ skipwhite:
 	else
 		start = token_end;
 
-	return substr(data, token_start, token_end - token_start);
+	return std::string_view(data + token_start, token_end - token_start);
+}
+
+/*
+==============
+tokenizer
+
+Streams tokens out of a string. Tokens are views into it, so
+they're only good for as long as the string is; nothing is
+copied until a caller decides to keep one.
+==============
+*/
+class tokenizer
+{
+	stringlit	data;
+	size_t		offset = 0;
+
+public:
+	inline tokenizer(stringlit data) :
+		data(data)
+	{
+	}
+
+	// fetch the next token. an empty one means the data ran out,
+	// but so does "", so check done() if that matters.
+	inline std::string_view next()
+	{
+		if (done())
+			return {};
+
+		return strtok_view(data, offset);
+	}
+
+	// true once the last token has been returned
+	inline bool done() const
+	{
+		return offset == (size_t) -1;
+	}
+};
+
+/*
+==============
+strunescape
+
+Copy a token out, expanding \n into newlines. Any other
+escaped character comes out as a lone backslash.
+==============
+*/
+inline string strunescape(std::string_view input)
+{
+	if (input.find('\\') == std::string_view::npos)
+		return string(input);
+
+	mutable_string str;
+	str.reserve(input.size());
+
+	for (size_t i = 0; i < input.size(); i++)
+	{
+		if (input[i] == '\\')
+		{
+			i++;
+
+			if (i < input.size() && input[i] == 'n')
+				str += '\n';
+			else
+				str += '\\';
+		}
+		else
+			str += input[i];
+	}
+
+	return std::move(str);
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "config.h"
+#include "lib/types/allocator.h"
+#include "atom.h"
+
+// the pool is keyed case-insensitively, and looked up by view
+struct atom_hash
+{
+	using is_transparent = void;
+
+	inline size_t operator()(std::string_view s) const { return strihash(s); }
+	inline size_t operator()(const string &s) const { return strihash(s.view()); }
+};
+
+struct atom_equal
+{
+	using is_transparent = void;
+
+	inline bool operator()(std::string_view a, std::string_view b) const { return striequals(a, b); }
+	inline bool operator()(const string &a, std::string_view b) const { return striequals(a.view(), b); }
+	inline bool operator()(std::string_view a, const string &b) const { return striequals(a, b.view()); }
+	inline bool operator()(const string &a, const string &b) const { return striequals(a.view(), b.view()); }
+};
+
+// set nodes never move, so atoms can point right at the strings in it
+static std::unordered_set<string, atom_hash, atom_equal, game_allocator<string>> atom_pool;
+
+const string atom::empty;
+
+const string *atom::intern(std::string_view s)
+{
+	auto it = atom_pool.find(s);
+
+	if (it == atom_pool.end())
+		it = atom_pool.emplace(s).first;
+
+	return &*it;
+}
+
+atom atom::find(std::string_view s)
+{
+	atom a;
+
+	if (auto it = atom_pool.find(s); it != atom_pool.end())
+		a.text = &*it;
+
+	return a;
+}
+
+void atom::clear()
+{
+	atom_pool.clear();
+}
+
+size_t atom::count()
+{
+	return atom_pool.size();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "lib/std.h"
+#include "lib/string.h"
+#include "lib/string/format.h"
+
+/*
+==============================================================================
+
+ATOMS
+
+==============================================================================
+
+An atom is an interned string. Every atom made from the same text,
+ignoring case, refers to the same pooled copy, so two atoms are equal
+if and only if they point at the same place. The pooled copy keeps
+the spelling that was interned first.
+
+Entity key values that are matched against each other (target,
+targetname, killtarget, team...) are atoms, which turns all of the
+case-insensitive string compares between them into pointer compares.
+
+The pool only lives as long as the entities do; it's emptied every time
+the entity list is wiped, and refilled as entities are spawned or read
+back in from a save. Don't hold on to atoms anywhere else.
+*/
+class atom
+{
+	const string	*text = nullptr;
+
+	static const string *intern(std::string_view s);
+
+	static const string empty;
+
+public:
+	constexpr atom() = default;
+
+	// intern s; empty text is the null atom
+	inline atom(std::string_view s) :
+		text(s.empty() ? nullptr : intern(s))
+	{
+	}
+
+	inline atom(stringlit s) :
+		atom(s ? std::string_view(s) : std::string_view())
+	{
+	}
+
+	inline atom(const string &s) :
+		atom(s.view())
+	{
+	}
+
+	// fetch the atom for s if it has been interned, without adding it.
+	// a null atom means nothing has been interned as s.
+	static atom find(std::string_view s);
+
+	// empty the pool; every atom that's still around is left dangling
+	static void clear();
+
+	// number of atoms in the pool
+	static size_t count();
+
+	inline const string &str() const { return text ? *text : empty; }
+	inline stringlit ptr() const { return str().ptr(); }
+	inline size_t length() const { return text ? text->length() : 0; }
+	inline std::string_view view() const { return str().view(); }
+
+	inline operator const string &() const { return str(); }
+
+	inline explicit operator bool() const { return text; }
+
+	inline bool operator==(const atom &other) const { return text == other.text; }
+	inline bool operator!=(const atom &other) const { return text != other.text; }
+
+	friend struct std::hash<atom>;
+};
+
+template<>
+struct std::hash<atom>
+{
+	inline size_t operator()(const atom &a) const { return std::hash<const void *>()(a.text); }
+};
+
+template<>
+struct std::formatter<atom> : std::formatter<stringlit>
+{
+	template<typename FormatContext>
+	auto format(const atom &a, FormatContext &ctx)
+	{
+		return std::formatter<stringlit>::format(a.ptr(), ctx);
+	}
+};
@@ -2,7 +2,37 @@
 
 #include "lib/std.h"
 #include "lib/types/allocator.h"
+#include "lib/string.h"
 
 // map is an allocator-wrapped unordered_map
 template<typename TKey, typename TVal>
-using map = std::unordered_map<TKey, TVal, std::hash<TKey>, std::equal_to<TKey>, game_allocator<std::pair<const TKey, TVal>>>;
\ No newline at end of file
+using map = std::unordered_map<TKey, TVal, std::hash<TKey>, std::equal_to<TKey>, game_allocator<std::pair<const TKey, TVal>>>;
+
+// imap is a map keyed on string literals, compared case-insensitively.
+// the literals must outlive the map.
+template<typename TVal>
+using imap = std::unordered_map<stringlit, TVal, stri_hash, stri_equal, game_allocator<std::pair<const stringlit, TVal>>>;
+
+// transparent hash/equality for string keys, so that they can
+// be looked up by view without making a string first
+struct string_hash
+{
+	using is_transparent = void;
+
+	inline size_t operator()(std::string_view s) const { return std::hash<std::string_view>()(s); }
+	inline size_t operator()(const string &s) const { return (*this)(s.view()); }
+};
+
+struct string_equal
+{
+	using is_transparent = void;
+
+	inline bool operator()(std::string_view a, std::string_view b) const { return a == b; }
+	inline bool operator()(const string &a, std::string_view b) const { return a.view() == b; }
+	inline bool operator()(std::string_view a, const string &b) const { return a == b.view(); }
+	inline bool operator()(const string &a, const string &b) const { return a.view() == b.view(); }
+};
+
+// smap is a map keyed on strings it owns; find() takes views.
+template<typename TVal>
+using smap = std::unordered_map<string, TVal, string_hash, string_equal, game_allocator<std::pair<const string, TVal>>>;
\ No newline at end of file
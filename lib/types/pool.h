@@ -0,0 +1,159 @@
+#pragma once
+
+#include "lib/std.h"
+#include "lib/types/allocator.h"
+#include "lib/types/dynarray.h"
+
+// pool hands out T one at a time from chunks that it never gives back,
+// and keeps released ones on a free list for re-use. Use pool<T>::get()
+// for the shared pool of a type.
+template<typename T>
+class pool
+{
+	static constexpr size_t CHUNK_SIZE = 64;
+
+	union slot
+	{
+		T		value;
+		slot	*next;
+
+		slot() { }
+		~slot() { }
+	};
+
+	dynarray<slot *>	chunks;
+	slot	*free_head = nullptr;
+	size_t	used = 0;
+
+	void grow()
+	{
+		slot *chunk = game_allocator<slot>().allocate(CHUNK_SIZE);
+
+		chunks.push_back(chunk);
+
+		for (size_t i = CHUNK_SIZE; i > 0; i--)
+		{
+			chunk[i - 1].next = free_head;
+			free_head = &chunk[i - 1];
+		}
+	}
+
+public:
+	// fetch a value-initialized T
+	[[nodiscard]] T *acquire()
+	{
+		if (!free_head)
+			grow();
+
+		slot *s = free_head;
+		free_head = s->next;
+		used++;
+
+		return new(&s->value) T();
+	}
+
+	// destroy the T and put it back on the free list
+	void release(T *value)
+	{
+		value->~T();
+
+		slot *s = reinterpret_cast<slot *>(value);
+		s->next = free_head;
+		free_head = s;
+		used--;
+	}
+
+	// number of Ts handed out
+	size_t count() const { return used; }
+
+	// number of Ts that have room, handed out or not
+	size_t capacity() const { return chunks.size() * CHUNK_SIZE; }
+
+	static pool &get()
+	{
+		static pool instance;
+		return instance;
+	}
+};
+
+// thrown when a pooled is used for writing before its T was created
+class empty_pooled : public std::exception
+{
+public:
+	empty_pooled() :
+		std::exception("attempted to use a pooled block that hasn't been emplaced", 1)
+	{
+	}
+};
+
+// pooled is an optional T that lives in pool<T> instead of inline,
+// for large blocks that most owners never touch. The T is only ever
+// created by emplace(), which the owners that need one call when they
+// are set up. Reading through a const pooled without one sees a
+// value-initialized T; reaching it through a non-const one throws, so
+// a stray access can't quietly create one.
+template<typename T>
+class pooled
+{
+	T	*ptr = nullptr;
+
+	static const T &empty()
+	{
+		static const T value {};
+		return value;
+	}
+
+public:
+	pooled() = default;
+
+	pooled(const pooled &other)
+	{
+		if (other.ptr)
+			emplace() = *other.ptr;
+	}
+
+	pooled &operator=(const pooled &other)
+	{
+		if (this == &other)
+			return *this;
+		else if (other.ptr)
+			emplace() = *other.ptr;
+		else
+			reset();
+
+		return *this;
+	}
+
+	~pooled()
+	{
+		reset();
+	}
+
+	// whether the T has been created
+	bool has_value() const { return !!ptr; }
+
+	// fetch the T, creating it if need be
+	T &emplace()
+	{
+		if (!ptr)
+			ptr = pool<T>::get().acquire();
+
+		return *ptr;
+	}
+
+	// give the T back to the pool
+	void reset()
+	{
+		if (!ptr)
+			return;
+
+		pool<T>::get().release(ptr);
+		ptr = nullptr;
+	}
+
+	T *operator->() { return ptr ? ptr : throw empty_pooled(); }
+	const T *operator->() const { return ptr ? ptr : &empty(); }
+
+	T &operator*() { return ptr ? *ptr : throw empty_pooled(); }
+	const T &operator*() const { return ptr ? *ptr : empty(); }
+};
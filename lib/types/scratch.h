@@ -0,0 +1,54 @@
+#pragma once
+
+#include "lib/std.h"
+#include "lib/types/dynarray.h"
+
+// scratch is a bump allocator for short-lived results. memory
+// is handed out as spans that stay valid until the next reset,
+// and blocks are kept around between resets, so once it has
+// warmed up it never touches the heap.
+template<typename T, size_t block_size = 1024>
+class scratch
+{
+	dynarray<dynarray<T>>	blocks;
+	size_t					block = 0, used = 0;
+
+public:
+	// fetch at least min_size free elements without using them up;
+	// any spans handed out earlier remain valid.
+	std::span<T> reserve(size_t min_size)
+	{
+		if (block < blocks.size() && blocks[block].size() - used >= min_size)
+			return std::span<T>(blocks[block]).subspan(used);
+
+		// current block is full; blocks after it are unused, so
+		// they are free to be resized
+		if (block < blocks.size())
+			block++;
+
+		used = 0;
+
+		if (block == blocks.size())
+			blocks.emplace_back();
+
+		if (blocks[block].size() < min_size)
+			blocks[block].resize(std::max(min_size, block_size));
+
+		return std::span<T>(blocks[block]);
+	}
+
+	// mark count elements of the last reserve as used, and
+	// return them.
+	std::span<T> commit(size_t count)
+	{
+		std::span<T> result = std::span<T>(blocks[block]).subspan(used, count);
+		used += count;
+		return result;
+	}
+
+	// release everything handed out so far
+	void reset()
+	{
+		block = used = 0;
+	}
+};
@@ -12,6 +12,10 @@
 #include "game/items/itemlist.h"
 #include "game/savables.h"
 #include "game/entity.h"
+#include "game/spatial.h"
+#include "game/util.h"
+#include "game/record.h"
+#include "game/think.h"
 
 void WipeEntities();
 
@@ -30,6 +34,8 @@ struct game_export
 	{
 		PreSpawnEntities();
 
+		G_RecordSpawn(mapname, entstring, spawnpoint);
+
 		WipeEntities();
 
 		::SpawnEntities(mapname, entstring, spawnpoint);
@@ -41,16 +47,28 @@ struct game_export
 	// ReadGame is called on a loadgame.
 	void (*WriteGame)(stringlit filename, qboolean autosave) = ::WriteGame;
 	
-	void (*ReadGame)(stringlit filename) = ::ReadGame;
+	void (*ReadGame)(stringlit filename) = [](stringlit filename)
+	{
+		G_RecordStop();
+
+		::ReadGame(filename);
+	};
 
 	// ReadLevel is called after the default map information has been
 	// loaded with SpawnEntities
 	void (*WriteLevel)(stringlit filename) = ::WriteLevel;
 	
-	void (*ReadLevel)(stringlit filename) = ::ReadLevel;
+	void (*ReadLevel)(stringlit filename) = [](stringlit filename)
+	{
+		G_RecordStop();
+
+		::ReadLevel(filename);
+	};
 
 	qboolean (*ClientConnect)(entity *ent, char *userinfo) = [](entity *ent, char *userinfo)
 	{
+		G_RecordConnect(*ent, userinfo);
+
 		string ui(userinfo);
 		
 		const qboolean success = ::ClientConnect(*ent, ui);
@@ -61,28 +79,34 @@ struct game_export
 	};
 	void (*ClientBegin)(entity *ent) = [](entity *ent)
 	{
+		G_RecordBegin(*ent);
 		::ClientBegin(*ent);
 	};
 	void (*ClientUserinfoChanged)(entity *ent, char *userinfo) = [](entity *ent, char *userinfo)
 	{
+		G_RecordUserinfo(*ent, userinfo);
 		::ClientUserinfoChanged(*ent, userinfo);
 	};
 	void (*ClientDisconnect)(entity *ent) = [](entity *ent)
 	{
+		G_RecordDisconnect(*ent);
 		::ClientDisconnect(*ent);
 	};
 	void (*ClientCommand)(entity *ent) = [](entity *ent)
 	{
+		G_RecordCommand(*ent);
 		::ClientCommand(*ent);
 	};
 	void (*ClientThink)(entity *ent, usercmd *cmd) = [](entity *ent, usercmd *cmd)
 	{
+		G_RecordThink(*ent, *cmd);
 		::ClientThink(*ent, *cmd);
 	};
 
 	void (*RunFrame)() = []()
 	{
 		::RunFrame();
+		G_RecordFrame();
 	};
 
 	// ServerCommand will be called when an "sv <command>" command is issued on the
@@ -91,6 +115,7 @@ struct game_export
 	// of the parameters
 	void (*ServerCommand)() = []()
 	{
+		G_RecordServerCommand();
 		::ServerCommand();
 	};
 
@@ -168,9 +193,19 @@ const uint32_t &max_entities = ge.max_edicts;
 
 void WipeEntities()
 {
-	for (auto &e : entity_range(0, max_entities - 1))
-		if (e.inuse)
-			e.__free();
+	for (entity &e : G_IterateLive())
+		e.__free();
+
+	G_SpatialClear();
+	G_ClearFreeList();
+	G_ClearLiveList();
+	G_ClearTargetnames();
+	G_ClearTypes();
+	G_ClearThinks();
+
+	// nothing refers to the atoms any more; SpawnEntities
+	// and ReadLevel fill the pool back up
+	atom::clear();
 }
 
 // prototype to make Clang happy